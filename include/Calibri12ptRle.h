@@ -0,0 +1,490 @@
+// Generated by tools/fontsubset.py from include/Calibri12pt8b.h
+// 191 glyphs, 77 run-length encoded
+
+#pragma once
+#include "UiText.h"
+
+const uint8_t Calibri12ptRleData[] PROGMEM = {
+  0xDB, 0x6D, 0xB6, 0xDB, 0x61, 0xBE, 0xCF, 0x3C, 0xF3, 0x8E, 0x30, 0x18,
+  0xC1, 0x8C, 0x18, 0xC7, 0xFE, 0x7F, 0xF1, 0x8C, 0x10, 0x81, 0x08, 0x31,
+  0x87, 0xFE, 0xFF, 0xE3, 0x18, 0x31, 0x83, 0x18, 0x21, 0x00, 0x52, 0x81,
+  0x91, 0x75, 0x38, 0x22, 0x51, 0x12, 0x83, 0x82, 0x85, 0x75, 0x83, 0x83,
+  0x82, 0x83, 0x62, 0x19, 0x26, 0x62, 0x82, 0x81, 0x60, 0x78, 0x19, 0x98,
+  0x32, 0x30, 0xC4, 0x23, 0x08, 0x44, 0x11, 0x98, 0x33, 0x60, 0x3C, 0x80,
+  0x03, 0x3C, 0x0C, 0xCC, 0x31, 0x18, 0x62, 0x11, 0x84, 0x26, 0x08, 0xC8,
+  0x19, 0xB0, 0x1E, 0x07, 0xC0, 0x3F, 0xC0, 0x61, 0x80, 0xC3, 0x01, 0x86,
+  0x03, 0x18, 0x03, 0xE0, 0x07, 0x86, 0x1F, 0x0C, 0x67, 0x19, 0xC7, 0x33,
+  0x07, 0xC6, 0x07, 0x86, 0x0F, 0x0F, 0xFB, 0x87, 0xC3, 0xFF, 0xA0, 0x32,
+  0x66, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC6, 0x62, 0x30, 0xC3, 0x18,
+  0x43, 0x18, 0xC6, 0x18, 0xC6, 0x31, 0x98, 0xC6, 0x31, 0x98, 0xCC, 0x00,
+  0x18, 0x18, 0xDB, 0x76, 0x18, 0x76, 0xDB, 0x18, 0x18, 0x42, 0x82, 0x82,
+  0x82, 0x82, 0x4F, 0x54, 0x28, 0x28, 0x28, 0x28, 0x24, 0x6D, 0xAD, 0x00,
+  0xFB, 0xF0, 0xFC, 0x72, 0x72, 0x62, 0x72, 0x72, 0x62, 0x72, 0x71, 0x72,
+  0x72, 0x62, 0x72, 0x72, 0x62, 0x72, 0x71, 0x72, 0x72, 0x62, 0x72, 0x70,
+  0x35, 0x38, 0x22, 0x45, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x62, 0x12, 0x42, 0x28, 0x44, 0x30, 0x1C, 0x1E, 0x3B, 0x19, 0x80, 0xC0,
+  0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC7, 0xFF, 0xFE, 0x25,
+  0x47, 0x31, 0x43, 0x82, 0x82, 0x82, 0x73, 0x72, 0x72, 0x72, 0x72, 0x72,
+  0x72, 0x7F, 0x50, 0x25, 0x47, 0x31, 0x43, 0x82, 0x82, 0x72, 0x45, 0x56,
+  0x83, 0x83, 0x73, 0x74, 0x62, 0x19, 0x35, 0x30, 0x07, 0x01, 0xC0, 0xF0,
+  0x2C, 0x1B, 0x0C, 0xC3, 0x31, 0x8C, 0x63, 0x30, 0xCF, 0xFF, 0xFF, 0x03,
+  0x00, 0xC0, 0x30, 0x18, 0x28, 0x22, 0x82, 0x82, 0x84, 0x67, 0x83, 0x83,
+  0x82, 0x82, 0x74, 0x62, 0x18, 0x36, 0x30, 0x0F, 0x8F, 0xE3, 0x01, 0x80,
+  0x60, 0x30, 0x0D, 0xF3, 0xFE, 0xC0, 0xF0, 0x3C, 0x0D, 0x83, 0x61, 0xDF,
+  0xE1, 0xF0, 0x0F, 0x58, 0x27, 0x28, 0x27, 0x28, 0x27, 0x28, 0x27, 0x37,
+  0x27, 0x37, 0x28, 0x27, 0x26, 0x1F, 0x1F, 0xE6, 0x1F, 0x83, 0x61, 0x9C,
+  0x63, 0xF0, 0x78, 0x73, 0x98, 0x7C, 0x0F, 0x03, 0xC0, 0xDF, 0xE3, 0xF0,
+  0x1E, 0x1F, 0xEE, 0x1B, 0x07, 0xC0, 0xF0, 0x3E, 0x0D, 0xFF, 0x3E, 0xC0,
+  0x30, 0x0C, 0x06, 0x03, 0xBF, 0xC7, 0xC0, 0xDF, 0x00, 0x00, 0xDF, 0x00,
+  0x67, 0x60, 0x00, 0x00, 0x77, 0x66, 0xCC, 0x82, 0x64, 0x44, 0x44, 0x44,
+  0x62, 0x84, 0x84, 0x84, 0x84, 0x82, 0x0F, 0x5F, 0xF0, 0xF5, 0x02, 0x84,
+  0x84, 0x84, 0x84, 0x82, 0x64, 0x44, 0x44, 0x44, 0x62, 0x80, 0x7C, 0xFE,
+  0x87, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x3C, 0x30, 0x30, 0x30, 0x00, 0x30,
+  0x30, 0x30, 0x00, 0x7E, 0x00, 0x7F, 0xF0, 0x1C, 0x03, 0x06, 0x00, 0x31,
+  0xC7, 0x66, 0x33, 0xFC, 0x44, 0x63, 0x09, 0x88, 0x61, 0x33, 0x0C, 0x66,
+  0x61, 0x8C, 0xCC, 0x71, 0x99, 0xFF, 0xE3, 0x1E, 0x78, 0x60, 0x00, 0x06,
+  0x00, 0x00, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0x80, 0x62, 0xA4, 0x94,
+  0x82, 0x12, 0x82, 0x22, 0x72, 0x22, 0x62, 0x33, 0x52, 0x42, 0x52, 0x42,
+  0x4A, 0x3A, 0x32, 0x62, 0x22, 0x82, 0x12, 0x85, 0x82, 0xFE, 0x3F, 0xCC,
+  0x1B, 0x06, 0xC1, 0xB0, 0xEF, 0xF3, 0xFC, 0xC1, 0xB0, 0x3C, 0x0F, 0x03,
+  0xC1, 0xFF, 0xEF, 0xE0, 0x46, 0x48, 0x22, 0x61, 0x12, 0x92, 0x83, 0x82,
+  0x92, 0x92, 0x92, 0x93, 0x92, 0x93, 0x61, 0x29, 0x46, 0x10, 0xFE, 0x0F,
+  0xF8, 0xC1, 0xCC, 0x06, 0xC0, 0x6C, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x7C,
+  0x06, 0xC0, 0x6C, 0x0E, 0xC1, 0xCF, 0xF8, 0xFE, 0x00, 0x0F, 0x36, 0x26,
+  0x26, 0x26, 0x71, 0xA6, 0x26, 0x26, 0x26, 0x26, 0xF1, 0x0F, 0x36, 0x26,
+  0x26, 0x26, 0x71, 0xA6, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x56, 0x49,
+  0x23, 0x61, 0x13, 0x92, 0x92, 0xA2, 0xA2, 0x48, 0x57, 0x82, 0x12, 0x72,
+  0x12, 0x72, 0x23, 0x52, 0x39, 0x47, 0x10, 0x02, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x7F, 0xB7, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x20, 0x0F, 0xF0,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x9F, 0xE7, 0x00,
+  0xC1, 0xF0, 0xEC, 0x33, 0x18, 0xCC, 0x36, 0x0F, 0x83, 0xE0, 0xD8, 0x33,
+  0x0C, 0x63, 0x1C, 0xC3, 0x30, 0x6C, 0x0C, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE0, 0x07,
+  0x78, 0x03, 0xFC, 0x03, 0x7B, 0x01, 0xBD, 0x81, 0x9E, 0x60, 0xCF, 0x30,
+  0x67, 0x98, 0x63, 0xC6, 0x31, 0xE3, 0x30, 0xF1, 0xD8, 0x78, 0x78, 0x3C,
+  0x3C, 0x1E, 0x0E, 0x0F, 0x06, 0x06, 0xE0, 0x3E, 0x07, 0xC0, 0xEC, 0x1D,
+  0x83, 0x98, 0x73, 0x0E, 0x31, 0xC7, 0x38, 0x67, 0x0E, 0xE0, 0xDC, 0x0F,
+  0x81, 0xF0, 0x18, 0x46, 0x6A, 0x42, 0x63, 0x22, 0x82, 0x22, 0x82, 0x13,
+  0x85, 0xA4, 0xA4, 0xA4, 0x96, 0x82, 0x22, 0x82, 0x23, 0x62, 0x49, 0x76,
+  0x40, 0x07, 0x28, 0x12, 0x54, 0x54, 0x54, 0x54, 0x4B, 0x17, 0x22, 0x72,
+  0x72, 0x72, 0x72, 0x72, 0x70, 0x46, 0x8A, 0x62, 0x62, 0x52, 0x82, 0x42,
+  0x82, 0x33, 0x83, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0x93, 0x23,
+  0x82, 0x42, 0x82, 0x43, 0x62, 0x6A, 0x86, 0x13, 0xE4, 0xE2, 0xFE, 0x3F,
+  0xCC, 0x1B, 0x06, 0xC1, 0xB0, 0x6C, 0x3B, 0xF8, 0xFE, 0x30, 0xCC, 0x33,
+  0x06, 0xC1, 0xB0, 0x3C, 0x0C, 0x25, 0x37, 0x13, 0x41, 0x12, 0x72, 0x82,
+  0x74, 0x74, 0x73, 0x73, 0x72, 0x73, 0x5B, 0x26, 0x20, 0x0B, 0x1B, 0x62,
+  0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+  0x50, 0x02, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x72, 0x12, 0x53, 0x19, 0x45, 0x30, 0xE0, 0x1B, 0x00, 0xD8, 0x0E,
+  0xE0, 0x63, 0x03, 0x18, 0x30, 0x61, 0x83, 0x0C, 0x18, 0xC0, 0x66, 0x03,
+  0x30, 0x1B, 0x00, 0x78, 0x03, 0xC0, 0x1C, 0x00, 0xC0, 0xE0, 0x3C, 0x0E,
+  0x06, 0xC0, 0xE0, 0x66, 0x0B, 0x06, 0x61, 0xB0, 0xC6, 0x1B, 0x0C, 0x71,
+  0xB0, 0xC3, 0x11, 0x8C, 0x33, 0x19, 0x83, 0x31, 0x98, 0x1B, 0x0D, 0x81,
+  0xA0, 0xD0, 0x1E, 0x0F, 0x00, 0xE0, 0xF0, 0x0E, 0x07, 0x00, 0xC0, 0xFC,
+  0x19, 0x86, 0x18, 0xC3, 0x30, 0x36, 0x07, 0x80, 0x70, 0x1E, 0x03, 0x60,
+  0xCC, 0x38, 0xC6, 0x1D, 0x81, 0xB0, 0x38, 0xE0, 0x6C, 0x0D, 0xC3, 0x18,
+  0x63, 0x98, 0x33, 0x07, 0xC0, 0x78, 0x0E, 0x00, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x09, 0x19, 0x82, 0x72, 0x73, 0x72, 0x72, 0x73,
+  0x72, 0x72, 0x73, 0x72, 0x72, 0x8F, 0x50, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xFF, 0x02, 0x82, 0x72, 0x72, 0x82, 0x72, 0x72,
+  0x82, 0x72, 0x81, 0x82, 0x72, 0x82, 0x72, 0x72, 0x82, 0x72, 0x72, 0x82,
+  0x72, 0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF, 0x0C,
+  0x07, 0x81, 0xE0, 0xC8, 0x33, 0x08, 0xC6, 0x19, 0x86, 0xC0, 0xC0, 0x0C,
+  0x31, 0x86, 0x10, 0x00, 0x3E, 0x3F, 0x90, 0x60, 0x30, 0xFB, 0xFF, 0x87,
+  0x83, 0xC3, 0xBF, 0xCF, 0x60, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x37,
+  0x8F, 0xF3, 0x86, 0xC1, 0xB0, 0x6C, 0x1F, 0x06, 0xC1, 0xB8, 0x6F, 0xF3,
+  0x78, 0x1E, 0x7F, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x7F, 0x3E,
+  0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC7, 0xB7, 0xFD, 0x87, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x77, 0xFC, 0xF3, 0x34, 0x48, 0x22, 0x42,
+  0x12, 0x6F, 0x98, 0x29, 0x28, 0x84, 0x52, 0x0E, 0x1F, 0x30, 0x30, 0x30,
+  0xFE, 0x7E, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3F,
+  0xDF, 0xEE, 0x33, 0x04, 0xC1, 0x30, 0xC7, 0xF3, 0xF8, 0xC0, 0x1F, 0xCF,
+  0xFB, 0x06, 0xC1, 0xBF, 0xE7, 0xE0, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06,
+  0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83,
+  0x04, 0x4F, 0x70, 0x33, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F,
+  0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xC6, 0xCC, 0xD8, 0xF0, 0xF8,
+  0xD8, 0xCC, 0xC6, 0xC7, 0xC3, 0x0F, 0xF2, 0xDE, 0x3D, 0xFE, 0xFF, 0x8F,
+  0x1E, 0x0C, 0x3C, 0x18, 0x78, 0x30, 0xF0, 0x61, 0xE0, 0xC3, 0xC1, 0x87,
+  0x83, 0x0F, 0x06, 0x18, 0xDE, 0x7F, 0xB8, 0xF8, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x60, 0x1F, 0x0F, 0xF1, 0x83, 0x60, 0x6C, 0x0F,
+  0x80, 0xF0, 0x3E, 0x06, 0x60, 0xCF, 0xF0, 0x7C, 0x00, 0xDE, 0x3F, 0xCE,
+  0x1B, 0x06, 0xC1, 0xB0, 0x7C, 0x1B, 0x06, 0xE1, 0xBF, 0xCD, 0xE3, 0x00,
+  0xC0, 0x30, 0x0C, 0x00, 0x1E, 0xDF, 0xF6, 0x1F, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0x61, 0xDF, 0xF3, 0xCC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0xDF,
+  0xFE, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x00, 0x3E, 0xFF, 0x06, 0x07,
+  0x07, 0x83, 0x83, 0x87, 0xFD, 0xF0, 0x30, 0x60, 0xC7, 0xF7, 0xE6, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x81, 0xE3, 0xC0, 0x02, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x4C, 0x14, 0x22, 0xE0, 0xD8, 0x36, 0x0C, 0xC6,
+  0x31, 0x8C, 0x61, 0xB0, 0x6C, 0x1B, 0x03, 0x80, 0xE0, 0xC1, 0x83, 0xC3,
+  0x86, 0xC3, 0x86, 0x62, 0x86, 0x66, 0xCC, 0x66, 0xCC, 0x26, 0x4C, 0x34,
+  0x78, 0x3C, 0x78, 0x3C, 0x78, 0x18, 0x30, 0x60, 0xDC, 0x63, 0x30, 0x6C,
+  0x1E, 0x03, 0x81, 0xE0, 0xEC, 0x33, 0x98, 0x66, 0x0C, 0xE0, 0xD8, 0x36,
+  0x0C, 0xC6, 0x31, 0x8C, 0x61, 0xB0, 0x6C, 0x1B, 0x03, 0x80, 0xE0, 0x30,
+  0x0C, 0x03, 0x01, 0x80, 0xFE, 0xFE, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x60,
+  0x60, 0xFE, 0xFF, 0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x33, 0x8E, 0x18,
+  0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0F, 0x1C, 0x0F, 0x60, 0xE1, 0xC3, 0x0C,
+  0x30, 0xC3, 0x0C, 0x10, 0x70, 0xC6, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x1C,
+  0xE0, 0x20, 0x3E, 0x1C, 0xC6, 0x1F, 0x83, 0x80, 0x7D, 0x86, 0xDB, 0x6D,
+  0xB6, 0xDB, 0x0C, 0x0C, 0x1E, 0x7F, 0x61, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x61, 0x7F, 0x3E, 0x0C, 0x0C, 0x45, 0x47, 0x22, 0x51, 0x22, 0x82, 0x82,
+  0x68, 0x28, 0x42, 0x82, 0x82, 0x82, 0x82, 0x6F, 0x50, 0xC0, 0xF0, 0x37,
+  0xF8, 0xFC, 0x61, 0x90, 0x64, 0x09, 0x06, 0x61, 0x9F, 0xC7, 0xFB, 0x86,
+  0xC0, 0xC0, 0xC0, 0xDC, 0x19, 0x86, 0x19, 0xC3, 0x30, 0x3C, 0x03, 0x80,
+  0x60, 0xFF, 0xC1, 0x80, 0x30, 0x3F, 0xCF, 0xFC, 0x18, 0x03, 0x00, 0x0F,
+  0x1A, 0xF1, 0x1F, 0x0F, 0xC3, 0x01, 0x80, 0x30, 0x0F, 0x06, 0xF1, 0x8E,
+  0xC0, 0xF8, 0x37, 0x18, 0xFE, 0x0F, 0x00, 0xC0, 0x19, 0x0C, 0x7F, 0x0F,
+  0x80, 0x33, 0x33, 0x00, 0x00, 0x07, 0xE0, 0x1E, 0x78, 0x30, 0x0C, 0x60,
+  0x86, 0x47, 0xE3, 0xCE, 0x23, 0xCC, 0x03, 0xCC, 0x03, 0xCC, 0x03, 0xCC,
+  0x03, 0xCE, 0x23, 0xC7, 0xE2, 0x61, 0x86, 0x30, 0x0C, 0x3E, 0x78, 0x0F,
+  0xE0, 0x7C, 0xFC, 0x1B, 0xF4, 0x78, 0xDF, 0xBF, 0x00, 0x03, 0xFB, 0xF0,
+  0x19, 0x98, 0xCC, 0xCC, 0xE6, 0x63, 0x31, 0x8C, 0x66, 0x31, 0x8C, 0xC0,
+  0x09, 0x1A, 0x82, 0x82, 0x82, 0xFB, 0xF0, 0x3C, 0x21, 0xAF, 0x54, 0xBB,
+  0x8D, 0x6E, 0x94, 0x86, 0x3C, 0x00, 0x26, 0x26, 0xF9, 0x3C, 0xCD, 0x9B,
+  0x33, 0xC0, 0x42, 0x82, 0x82, 0x82, 0x82, 0x4A, 0x42, 0x82, 0x82, 0x82,
+  0x82, 0xEF, 0x50, 0x7B, 0xF0, 0xC3, 0x18, 0xC6, 0x3F, 0xFC, 0x7B, 0xF0,
+  0xC6, 0x78, 0x30, 0xFF, 0xF8, 0x18, 0xCC, 0x40, 0x00, 0xC1, 0x98, 0x33,
+  0x06, 0x60, 0xCC, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC3, 0x9F, 0xFF, 0xF3,
+  0xE0, 0x0C, 0x01, 0x80, 0x30, 0x00, 0x1F, 0xEF, 0xFD, 0xF9, 0xFF, 0x3F,
+  0xE7, 0xFC, 0xDF, 0x9B, 0xF3, 0x1E, 0x60, 0xCC, 0x19, 0x83, 0x30, 0x66,
+  0x0C, 0xC1, 0x98, 0x33, 0x06, 0x60, 0xCC, 0xFC, 0x23, 0xFE, 0x37, 0x91,
+  0x11, 0x11, 0x10, 0x3C, 0x7E, 0xC3, 0xC3, 0xC3, 0xC3, 0x7E, 0x3C, 0x00,
+  0x00, 0x7E, 0x7E, 0xCC, 0x23, 0x18, 0xC6, 0x63, 0x19, 0x8C, 0xCC, 0xC6,
+  0x66, 0x66, 0x00, 0x70, 0x33, 0xC0, 0xC3, 0x06, 0x0C, 0x30, 0x30, 0x80,
+  0xC6, 0x03, 0x30, 0x0C, 0x80, 0x06, 0x38, 0x31, 0xE1, 0x85, 0x86, 0x26,
+  0x31, 0x99, 0x87, 0xF4, 0x01, 0xB0, 0x06, 0x70, 0x33, 0xC0, 0xC3, 0x06,
+  0x0C, 0x30, 0x30, 0x80, 0xC6, 0x03, 0x30, 0x0C, 0x80, 0x06, 0x78, 0x31,
+  0x31, 0x80, 0xC6, 0x03, 0x30, 0x19, 0x80, 0xC4, 0x06, 0x30, 0x1F, 0xF0,
+  0x19, 0x30, 0x30, 0x60, 0xC1, 0x83, 0x0F, 0x84, 0x03, 0x18, 0x26, 0x60,
+  0x78, 0x80, 0x03, 0x1C, 0x0C, 0x78, 0x30, 0xB0, 0x62, 0x61, 0x8C, 0xC6,
+  0x1F, 0xC8, 0x03, 0x30, 0x06, 0x0C, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x0C,
+  0x3C, 0x70, 0xE0, 0xC0, 0xC0, 0xC0, 0xE1, 0x7F, 0x3E, 0x32, 0xC2, 0xC2,
+  0xFA, 0x2A, 0x49, 0x48, 0x21, 0x28, 0x22, 0x27, 0x22, 0x26, 0x23, 0x35,
+  0x24, 0x25, 0x24, 0x24, 0xA3, 0xA3, 0x26, 0x22, 0x28, 0x21, 0x28, 0x58,
+  0x20, 0x82, 0xA2, 0xA2, 0xF9, 0x2A, 0x49, 0x48, 0x21, 0x28, 0x22, 0x27,
+  0x22, 0x26, 0x23, 0x35, 0x24, 0x25, 0x24, 0x24, 0xA3, 0xA3, 0x26, 0x22,
+  0x28, 0x21, 0x28, 0x58, 0x20, 0x63, 0x92, 0x12, 0x72, 0x32, 0xF6, 0x2A,
+  0x49, 0x48, 0x21, 0x28, 0x22, 0x27, 0x22, 0x26, 0x23, 0x35, 0x24, 0x25,
+  0x24, 0x24, 0xA3, 0xA3, 0x26, 0x22, 0x28, 0x21, 0x28, 0x58, 0x20, 0x04,
+  0x20, 0x79, 0x02, 0x78, 0x11, 0xC0, 0x00, 0x01, 0x80, 0x1E, 0x00, 0xF0,
+  0x0D, 0x80, 0x66, 0x03, 0x30, 0x31, 0xC1, 0x86, 0x0C, 0x30, 0xFF, 0xC7,
+  0xFE, 0x30, 0x33, 0x00, 0xD8, 0x07, 0xC0, 0x30, 0x42, 0x23, 0x62, 0x23,
+  0xFF, 0x42, 0xA4, 0x94, 0x82, 0x12, 0x82, 0x22, 0x72, 0x22, 0x62, 0x33,
+  0x52, 0x42, 0x52, 0x42, 0x4A, 0x3A, 0x32, 0x62, 0x22, 0x82, 0x12, 0x85,
+  0x82, 0x54, 0x91, 0x21, 0x91, 0x21, 0x94, 0xF8, 0x2A, 0x49, 0x48, 0x21,
+  0x28, 0x22, 0x27, 0x22, 0x26, 0x23, 0x35, 0x24, 0x25, 0x24, 0x24, 0xA3,
+  0xA3, 0x26, 0x22, 0x28, 0x21, 0x28, 0x58, 0x20, 0x8A, 0x8A, 0x72, 0x12,
+  0xC2, 0x22, 0xC2, 0x22, 0xB2, 0x32, 0xB2, 0x37, 0x52, 0x47, 0x52, 0x42,
+  0x99, 0x99, 0x82, 0x62, 0x73, 0x62, 0x72, 0x7B, 0x78, 0x46, 0x48, 0x22,
+  0x61, 0x12, 0x92, 0x83, 0x82, 0x92, 0x92, 0x92, 0x93, 0x92, 0x93, 0x61,
+  0x29, 0x46, 0x72, 0x92, 0x74, 0x74, 0x30, 0x22, 0x82, 0x82, 0xD8, 0x18,
+  0x12, 0x72, 0x72, 0x72, 0x77, 0x28, 0x12, 0x72, 0x72, 0x72, 0x72, 0x78,
+  0x18, 0x62, 0x52, 0x52, 0xAF, 0x36, 0x26, 0x26, 0x26, 0x71, 0xA6, 0x26,
+  0x26, 0x26, 0x26, 0xF1, 0x43, 0x52, 0x12, 0x32, 0x32, 0xA8, 0x18, 0x12,
+  0x72, 0x72, 0x72, 0x77, 0x28, 0x12, 0x72, 0x72, 0x72, 0x72, 0x78, 0x18,
+  0x22, 0x23, 0x22, 0x23, 0xF4, 0x81, 0x81, 0x27, 0x27, 0x27, 0x27, 0x72,
+  0x81, 0x27, 0x27, 0x27, 0x27, 0x27, 0x81, 0x80, 0x30, 0x60, 0xC0, 0x0C,
+  0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC0, 0x0C,
+  0x63, 0x00, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30,
+  0xC3, 0x00, 0x43, 0x52, 0x12, 0x32, 0x32, 0xD2, 0x72, 0x72, 0x72, 0x72,
+  0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x30, 0x22,
+  0x23, 0x22, 0x23, 0xF7, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+  0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x28, 0x6A, 0x42, 0x62, 0x42,
+  0x72, 0x32, 0x72, 0x32, 0x89, 0x59, 0x52, 0x22, 0x82, 0x22, 0x82, 0x22,
+  0x72, 0x32, 0x72, 0x32, 0x53, 0x49, 0x58, 0x40, 0x10, 0x87, 0x90, 0x9E,
+  0x11, 0xC0, 0x01, 0xC0, 0x7C, 0x0F, 0x81, 0xD8, 0x3B, 0x07, 0x30, 0xE6,
+  0x1C, 0x63, 0x8E, 0x70, 0xCE, 0x1D, 0xC1, 0xB8, 0x1F, 0x03, 0xE0, 0x30,
+  0x42, 0xD2, 0xD2, 0xF9, 0x66, 0xA4, 0x26, 0x32, 0x28, 0x22, 0x28, 0x21,
+  0x38, 0x5A, 0x4A, 0x4A, 0x49, 0x68, 0x22, 0x28, 0x22, 0x36, 0x24, 0x97,
+  0x64, 0x82, 0xB2, 0xB2, 0xF9, 0x66, 0xA4, 0x26, 0x32, 0x28, 0x22, 0x28,
+  0x21, 0x38, 0x5A, 0x4A, 0x4A, 0x49, 0x68, 0x22, 0x28, 0x22, 0x36, 0x24,
+  0x97, 0x64, 0x63, 0xA2, 0x12, 0x82, 0x32, 0xF6, 0x66, 0xA4, 0x26, 0x32,
+  0x28, 0x22, 0x28, 0x21, 0x38, 0x5A, 0x4A, 0x4A, 0x49, 0x68, 0x22, 0x28,
+  0x22, 0x36, 0x24, 0x97, 0x64, 0x51, 0x41, 0x74, 0x21, 0x71, 0x24, 0x71,
+  0x33, 0xF6, 0x66, 0xA4, 0x26, 0x32, 0x28, 0x22, 0x28, 0x21, 0x38, 0x5A,
+  0x4A, 0x4A, 0x49, 0x68, 0x22, 0x28, 0x22, 0x36, 0x24, 0x97, 0x64, 0x42,
+  0x23, 0x72, 0x23, 0xFF, 0x56, 0x6A, 0x42, 0x63, 0x22, 0x82, 0x22, 0x82,
+  0x13, 0x85, 0xA4, 0xA4, 0xA4, 0x96, 0x82, 0x22, 0x82, 0x23, 0x62, 0x49,
+  0x76, 0x40, 0xC0, 0xF8, 0x77, 0x38, 0xFC, 0x1E, 0x07, 0x83, 0xF1, 0xCE,
+  0xE1, 0xF0, 0x30, 0x00, 0x18, 0x00, 0xC0, 0xFF, 0x0F, 0xFC, 0x30, 0x79,
+  0x83, 0x66, 0x0D, 0xB0, 0x67, 0xC1, 0x0F, 0x0C, 0x3C, 0x60, 0xF1, 0x87,
+  0xEC, 0x19, 0xB0, 0x67, 0x83, 0x0F, 0xF8, 0x3F, 0xC0, 0xC0, 0x06, 0x00,
+  0x00, 0x22, 0xA2, 0xA2, 0xF1, 0x27, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x21, 0x25, 0x31, 0x94, 0x53, 0x72, 0x82,
+  0x82, 0xF0, 0x27, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+  0x47, 0x47, 0x21, 0x25, 0x31, 0x94, 0x53, 0x43, 0x72, 0x12, 0x52, 0x32,
+  0xD2, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x72, 0x12, 0x53, 0x19, 0x45, 0x30, 0x32, 0x23, 0x42, 0x23, 0xF8, 0x27,
+  0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x21,
+  0x25, 0x31, 0x94, 0x53, 0x82, 0x82, 0x82, 0xE3, 0x62, 0x12, 0x62, 0x13,
+  0x42, 0x32, 0x42, 0x33, 0x22, 0x52, 0x22, 0x55, 0x74, 0x73, 0x92, 0x92,
+  0x92, 0x92, 0x92, 0x92, 0x40, 0x02, 0x72, 0x75, 0x48, 0x12, 0x45, 0x54,
+  0x54, 0x54, 0x54, 0x4B, 0x17, 0x22, 0x72, 0x72, 0x70, 0x3E, 0x1F, 0xCC,
+  0x33, 0x06, 0xC1, 0x31, 0xCC, 0xC3, 0x30, 0xCC, 0x33, 0x8C, 0x7B, 0x07,
+  0xC0, 0xF0, 0x3C, 0xFB, 0x3C, 0x22, 0x72, 0x82, 0x81, 0xF9, 0x53, 0x72,
+  0x15, 0x27, 0x24, 0x51, 0xB4, 0x45, 0x44, 0x31, 0x82, 0x41, 0x20, 0x52,
+  0x72, 0x62, 0x71, 0xF9, 0x53, 0x72, 0x15, 0x27, 0x24, 0x51, 0xB4, 0x45,
+  0x44, 0x31, 0x82, 0x41, 0x20, 0x0C, 0x0F, 0x0C, 0x84, 0x60, 0x00, 0x00,
+  0xF8, 0xFE, 0x41, 0x80, 0xC3, 0xEF, 0xFE, 0x1E, 0x0F, 0x0E, 0xFF, 0x3D,
+  0x80, 0x10, 0x8F, 0x22, 0x78, 0x8C, 0x00, 0x00, 0x01, 0xF0, 0xFE, 0x20,
+  0xC0, 0x30, 0x7C, 0xFF, 0x70, 0xD8, 0x36, 0x1D, 0xFF, 0x1E, 0xC0, 0x33,
+  0x19, 0x80, 0x00, 0x03, 0xE3, 0xF9, 0x06, 0x03, 0x0F, 0xBF, 0xF8, 0x78,
+  0x3C, 0x3B, 0xFC, 0xF6, 0x1E, 0x09, 0x04, 0x83, 0x80, 0x01, 0xF1, 0xFC,
+  0x83, 0x01, 0x87, 0xDF, 0xFC, 0x3C, 0x1E, 0x1D, 0xFE, 0x7B, 0x25, 0x34,
+  0x3E, 0x21, 0x53, 0x42, 0x72, 0x52, 0x79, 0x1F, 0x34, 0x27, 0x25, 0x27,
+  0x24, 0x46, 0x71, 0x82, 0x43, 0x61, 0x1E, 0x7F, 0x61, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0x61, 0x7F, 0x3E, 0x0C, 0x0C, 0x3C, 0x3C, 0x32, 0x82, 0x92,
+  0x91, 0xFC, 0x44, 0x82, 0x24, 0x21, 0x26, 0xF9, 0x82, 0x92, 0x88, 0x45,
+  0x20, 0x62, 0x82, 0x72, 0x81, 0xFC, 0x44, 0x82, 0x24, 0x21, 0x26, 0xF9,
+  0x82, 0x92, 0x88, 0x45, 0x20, 0x42, 0x74, 0x52, 0x21, 0x51, 0x32, 0xFA,
+  0x44, 0x82, 0x24, 0x21, 0x26, 0xF9, 0x82, 0x92, 0x88, 0x45, 0x20, 0x22,
+  0x22, 0x42, 0x22, 0xFA, 0x44, 0x82, 0x24, 0x21, 0x26, 0xF9, 0x82, 0x92,
+  0x88, 0x45, 0x20, 0x30, 0xC1, 0x82, 0x00, 0x00, 0xC3, 0x0C, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x18, 0xCC, 0x40, 0x00, 0xC6, 0x31, 0x8C, 0x63,
+  0x18, 0xC6, 0x30, 0x0C, 0x1E, 0x32, 0x23, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x36, 0x6C, 0x00, 0x00,
+  0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x00, 0x0C, 0xC1,
+  0xF3, 0xF0, 0xCC, 0x01, 0x87, 0xE7, 0xFD, 0x87, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xD8, 0x67, 0xF8, 0xF8, 0x10, 0x8F, 0x22, 0x78, 0x8C, 0x00,
+  0x00, 0x06, 0xF1, 0xFE, 0x71, 0xD8, 0x36, 0x0D, 0x83, 0x60, 0xD8, 0x36,
+  0x0D, 0x83, 0x60, 0xC0, 0x32, 0x92, 0xA2, 0xA1, 0xFF, 0x05, 0x48, 0x32,
+  0x52, 0x12, 0x62, 0x12, 0x65, 0x74, 0x65, 0x62, 0x22, 0x52, 0x28, 0x55,
+  0x30, 0x62, 0x92, 0x82, 0x91, 0xFF, 0x05, 0x48, 0x32, 0x52, 0x12, 0x62,
+  0x12, 0x65, 0x74, 0x65, 0x62, 0x22, 0x52, 0x28, 0x55, 0x30, 0x52, 0x84,
+  0x62, 0x21, 0x61, 0x32, 0xFC, 0x54, 0x83, 0x25, 0x21, 0x26, 0x21, 0x26,
+  0x57, 0x46, 0x56, 0x22, 0x25, 0x22, 0x85, 0x53, 0x10, 0x87, 0x90, 0x9E,
+  0x11, 0x80, 0x00, 0x00, 0x07, 0xC3, 0xFC, 0x60, 0xD8, 0x1B, 0x03, 0xE0,
+  0x3C, 0x0F, 0x81, 0x98, 0x33, 0xFC, 0x1F, 0x00, 0x32, 0x22, 0x52, 0x22,
+  0xFC, 0x54, 0x83, 0x25, 0x21, 0x26, 0x21, 0x26, 0x57, 0x46, 0x56, 0x22,
+  0x25, 0x22, 0x85, 0x53, 0x42, 0x82, 0x82, 0xF9, 0xF5, 0xF9, 0x28, 0x28,
+  0x24, 0x00, 0xC0, 0x30, 0x7E, 0x3F, 0xC6, 0x3D, 0x85, 0xB1, 0x9E, 0x23,
+  0xCC, 0x7B, 0x19, 0xE3, 0x3F, 0xC3, 0xF0, 0x40, 0x18, 0x00, 0x22, 0x72,
+  0x82, 0x81, 0xF7, 0x25, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44,
+  0xC1, 0x42, 0x20, 0x52, 0x72, 0x62, 0x71, 0xF7, 0x25, 0x45, 0x45, 0x45,
+  0x45, 0x45, 0x45, 0x45, 0x44, 0xC1, 0x42, 0x20, 0x42, 0x64, 0x42, 0x21,
+  0x41, 0x32, 0xF4, 0x25, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44,
+  0xC1, 0x42, 0x20, 0x33, 0x19, 0x80, 0x00, 0x0C, 0x1E, 0x0F, 0x07, 0x83,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x3F, 0xFD, 0xE6, 0x03, 0x00, 0xC0, 0x60,
+  0x10, 0x00, 0x00, 0x0E, 0x0D, 0x83, 0x60, 0xCC, 0x63, 0x18, 0xC6, 0x1B,
+  0x06, 0xC1, 0xB0, 0x38, 0x0E, 0x03, 0x00, 0xC0, 0x30, 0x18, 0x00, 0xC0,
+  0x30, 0x0C, 0x03, 0x00, 0xC0, 0x37, 0x8F, 0xF3, 0x86, 0xC1, 0xB0, 0x6C,
+  0x1F, 0x06, 0xC1, 0xB8, 0x6F, 0xF3, 0x78, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+  0x19, 0x86, 0x60, 0x00, 0x00, 0xE0, 0xD8, 0x36, 0x0C, 0xC6, 0x31, 0x8C,
+  0x61, 0xB0, 0x6C, 0x1B, 0x03, 0x80, 0xE0, 0x30, 0x0C, 0x03, 0x01, 0x80,
+};
+
+const UiRleGlyph Calibri12ptRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   5,    0,    1, 0 },   // 0x20 
+  {     0,   3,  16,   8,    3,  -15, 0 },   // 0x21 !
+  {     6,   6,   6,  10,    2,  -15, 0 },   // 0x22 "
+  {    11,  12,  15,  12,    0,  -14, 0 },   // 0x23 #
+  {    34,  10,  21,  12,    1,  -17, 1 },   // 0x24 $
+  {    57,  15,  16,  17,    1,  -15, 0 },   // 0x25 %
+  {    87,  15,  16,  16,    0,  -15, 0 },   // 0x26 &
+  {   117,   2,   6,   5,    2,  -15, 0 },   // 0x27 '
+  {   119,   4,  21,   7,    2,  -16, 0 },   // 0x28 (
+  {   130,   5,  21,   7,    1,  -16, 0 },   // 0x29 )
+  {   144,   8,   9,  12,    2,  -16, 0 },   // 0x2A *
+  {   153,  10,  12,  12,    1,  -12, 1 },   // 0x2B +
+  {   165,   3,   6,   6,    1,   -2, 0 },   // 0x2C ,
+  {   168,   6,   2,   7,    1,   -6, 0 },   // 0x2D -
+  {   170,   2,   3,   6,    2,   -2, 0 },   // 0x2E .
+  {   171,   9,  20,   9,    0,  -16, 1 },   // 0x2F /
+  {   192,  10,  15,  12,    1,  -14, 1 },   // 0x30 0
+  {   210,   9,  15,  12,    2,  -14, 0 },   // 0x31 1
+  {   227,  10,  15,  12,    1,  -14, 1 },   // 0x32 2
+  {   243,  10,  15,  12,    1,  -14, 1 },   // 0x33 3
+  {   260,  10,  15,  12,    1,  -14, 0 },   // 0x34 4
+  {   279,  10,  15,  12,    1,  -14, 1 },   // 0x35 5
+  {   295,  10,  15,  12,    1,  -14, 0 },   // 0x36 6
+  {   314,  10,  15,  12,    1,  -14, 1 },   // 0x37 7
+  {   329,  10,  15,  12,    1,  -14, 0 },   // 0x38 8
+  {   348,  10,  15,  12,    1,  -14, 0 },   // 0x39 9
+  {   367,   3,  11,   6,    2,  -10, 0 },   // 0x3A :
+  {   372,   4,  14,   6,    1,  -10, 0 },   // 0x3B ;
+  {   379,  10,  11,  12,    1,  -11, 1 },   // 0x3C <
+  {   390,  10,   7,  12,    1,   -9, 1 },   // 0x3D =
+  {   394,  10,  11,  12,    1,  -11, 1 },   // 0x3E >
+  {   406,   8,  16,  11,    2,  -15, 0 },   // 0x3F ?
+  {   422,  19,  18,  21,    0,  -14, 0 },   // 0x40 @
+  {   465,  13,  15,  14,    0,  -14, 1 },   // 0x41 A
+  {   489,  10,  15,  13,    2,  -14, 0 },   // 0x42 B
+  {   508,  11,  15,  13,    1,  -14, 1 },   // 0x43 C
+  {   526,  12,  15,  15,    2,  -14, 0 },   // 0x44 D
+  {   549,   8,  15,  12,    2,  -14, 1 },   // 0x45 E
+  {   561,   8,  15,  11,    2,  -14, 1 },   // 0x46 F
+  {   574,  12,  15,  15,    1,  -14, 1 },   // 0x47 G
+  {   595,  11,  15,  15,    2,  -14, 1 },   // 0x48 H
+  {   610,   2,  15,   6,    2,  -14, 1 },   // 0x49 I
+  {   612,   6,  15,   8,    0,  -14, 0 },   // 0x4A J
+  {   624,  10,  15,  12,    2,  -14, 0 },   // 0x4B K
+  {   643,   8,  15,  10,    2,  -14, 0 },   // 0x4C L
+  {   658,  17,  15,  21,    2,  -14, 0 },   // 0x4D M
+  {   690,  11,  15,  16,    2,  -14, 0 },   // 0x4E N
+  {   711,  14,  15,  16,    1,  -14, 1 },   // 0x4F O
+  {   733,   9,  15,  12,    2,  -14, 1 },   // 0x50 P
+  {   749,  16,  17,  16,    1,  -14, 1 },   // 0x51 Q
+  {   778,  10,  15,  13,    2,  -14, 0 },   // 0x52 R
+  {   797,   9,  15,  11,    1,  -14, 1 },   // 0x53 S
+  {   813,  12,  15,  12,    0,  -14, 1 },   // 0x54 T
+  {   829,  11,  15,  15,    2,  -14, 1 },   // 0x55 U
+  {   847,  13,  15,  14,    0,  -14, 0 },   // 0x56 V
+  {   872,  20,  15,  21,    1,  -14, 0 },   // 0x57 W
+  {   910,  11,  15,  12,    1,  -14, 0 },   // 0x58 X
+  {   931,  11,  15,  12,    0,  -14, 0 },   // 0x59 Y
+  {   952,  10,  15,  11,    1,  -14, 1 },   // 0x5A Z
+  {   967,   4,  20,   7,    2,  -15, 0 },   // 0x5B [
+  {   977,   9,  20,   9,    0,  -16, 1 },   // 0x5C 
+  {   997,   4,  20,   7,    1,  -15, 0 },   // 0x5D ]
+  {  1007,  10,   9,  12,    1,  -14, 0 },   // 0x5E ^
+  {  1019,  12,   1,  12,    0,    4, 1 },   // 0x5F _
+  {  1020,   5,   6,   7,    0,  -16, 0 },   // 0x60 `
+  {  1024,   9,  11,  12,    1,  -10, 0 },   // 0x61 a
+  {  1037,  10,  16,  13,    2,  -15, 0 },   // 0x62 b
+  {  1057,   8,  11,  10,    1,  -10, 0 },   // 0x63 c
+  {  1068,  10,  16,  13,    1,  -15, 0 },   // 0x64 d
+  {  1088,  10,  11,  12,    1,  -10, 1 },   // 0x65 e
+  {  1099,   8,  16,   7,    0,  -15, 0 },   // 0x66 f
+  {  1115,  10,  15,  11,    1,  -10, 0 },   // 0x67 g
+  {  1134,   9,  16,  13,    2,  -15, 0 },   // 0x68 h
+  {  1152,   2,  15,   6,    2,  -14, 1 },   // 0x69 i
+  {  1155,   4,  19,   6,    0,  -14, 0 },   // 0x6A j
+  {  1165,   8,  16,  11,    2,  -15, 0 },   // 0x6B k
+  {  1181,   2,  16,   6,    2,  -15, 1 },   // 0x6C l
+  {  1183,  15,  11,  19,    2,  -10, 0 },   // 0x6D m
+  {  1204,   9,  11,  13,    2,  -10, 0 },   // 0x6E n
+  {  1217,  11,  11,  13,    1,  -10, 0 },   // 0x6F o
+  {  1233,  10,  15,  13,    2,  -10, 0 },   // 0x70 p
+  {  1252,  10,  15,  13,    1,  -10, 0 },   // 0x71 q
+  {  1271,   6,  11,   8,    2,  -10, 0 },   // 0x72 r
+  {  1280,   7,  11,   9,    1,  -10, 0 },   // 0x73 s
+  {  1290,   7,  14,   8,    0,  -13, 0 },   // 0x74 t
+  {  1303,   9,  11,  13,    2,  -10, 1 },   // 0x75 u
+  {  1315,  10,  11,  11,    0,  -10, 0 },   // 0x76 v
+  {  1329,  16,  11,  17,    1,  -10, 0 },   // 0x77 w
+  {  1351,  10,  11,  10,    0,  -10, 0 },   // 0x78 x
+  {  1365,  10,  15,  11,    0,  -10, 0 },   // 0x79 y
+  {  1384,   8,  11,   9,    1,  -10, 0 },   // 0x7A z
+  {  1395,   6,  21,   8,    1,  -16, 0 },   // 0x7B {
+  {  1411,   1,  21,  11,    5,  -16, 1 },   // 0x7C |
+  {  1413,   6,  21,   8,    1,  -16, 0 },   // 0x7D }
+  {  1429,  10,   5,  12,    1,  -13, 0 },   // 0x7E ~
+  {  1436,   0,   0,   5,    0,    1, 0 },   // 0xA0 
+  {  1436,   3,  16,   8,    2,  -13, 0 },   // 0xA1 
+  {  1442,   8,  15,  12,    2,  -14, 0 },   // 0xA2 
+  {  1457,  10,  15,  12,    1,  -14, 1 },   // 0xA3 
+  {  1473,  10,  13,  12,    1,  -12, 0 },   // 0xA4 
+  {  1490,  11,  15,  12,    1,  -14, 0 },   // 0xA5 
+  {  1511,   2,  21,  12,    5,  -16, 1 },   // 0xA6 
+  {  1514,  10,  18,  12,    1,  -15, 0 },   // 0xA7 
+  {  1537,   8,   4,   9,    0,  -14, 0 },   // 0xA8 
+  {  1541,  16,  16,  20,    2,  -15, 0 },   // 0xA9 
+  {  1573,   7,  12,  10,    1,  -14, 0 },   // 0xAA 
+  {  1584,   9,  10,  12,    1,  -10, 0 },   // 0xAB 
+  {  1596,  10,   5,  12,    1,   -7, 1 },   // 0xAC 
+  {  1601,   6,   2,   7,    1,   -6, 0 },   // 0xAD 
+  {  1603,   9,   9,  12,    2,  -15, 0 },   // 0xAE 
+  {  1614,   8,   5,   9,    0,  -15, 1 },   // 0xAF 
+  {  1617,   7,   5,   8,    0,  -15, 0 },   // 0xB0 
+  {  1622,  10,  14,  12,    1,  -13, 1 },   // 0xB1 
+  {  1635,   6,   9,   8,    1,  -17, 0 },   // 0xB2 
+  {  1642,   6,   9,   8,    1,  -17, 0 },   // 0xB3 
+  {  1649,   5,   6,   7,    0,  -16, 0 },   // 0xB4 
+  {  1653,  11,  15,  13,    2,  -10, 0 },   // 0xB5 
+  {  1674,  11,  18,  14,    1,  -14, 0 },   // 0xB6 
+  {  1699,   2,   3,   6,    2,   -7, 0 },   // 0xB7 
+  {  1700,   4,   4,   7,    2,    1, 0 },   // 0xB8 
+  {  1702,   4,   9,   6,    0,  -17, 0 },   // 0xB9 
+  {  1707,   8,  12,  10,    1,  -14, 0 },   // 0xBA 
+  {  1719,   9,  10,  12,    2,  -10, 0 },   // 0xBB 
+  {  1731,  14,  16,  15,    1,  -15, 0 },   // 0xBC 
+  {  1759,  14,  16,  16,    1,  -15, 0 },   // 0xBD 
+  {  1787,  15,  16,  16,    1,  -15, 0 },   // 0xBE 
+  {  1817,   8,  16,  11,    1,  -13, 0 },   // 0xBF 
+  {  1833,  13,  19,  14,    0,  -18, 1 },   // 0xC0 
+  {  1861,  13,  19,  14,    0,  -18, 1 },   // 0xC1 
+  {  1889,  13,  19,  14,    0,  -18, 1 },   // 0xC2 
+  {  1919,  13,  20,  14,    0,  -19, 0 },   // 0xC3 
+  {  1952,  13,  19,  14,    0,  -18, 1 },   // 0xC4 
+  {  1981,  13,  20,  14,    0,  -19, 1 },   // 0xC5 
+  {  2012,  18,  15,  18,   -1,  -14, 1 },   // 0xC6 
+  {  2037,  11,  19,  13,    1,  -14, 1 },   // 0xC7 
+  {  2059,   9,  19,  12,    1,  -18, 1 },   // 0xC8 
+  {  2077,   8,  19,  12,    2,  -18, 1 },   // 0xC9 
+  {  2092,   9,  19,  12,    1,  -18, 1 },   // 0xCA 
+  {  2112,   9,  19,  12,    1,  -18, 1 },   // 0xCB 
+  {  2132,   6,  19,   6,   -2,  -18, 0 },   // 0xCC 
+  {  2147,   6,  19,   6,    0,  -18, 0 },   // 0xCD 
+  {  2162,   9,  19,   6,   -2,  -18, 1 },   // 0xCE 
+  {  2183,   9,  19,   6,   -2,  -18, 1 },   // 0xCF 
+  {  2203,  14,  15,  15,    0,  -14, 1 },   // 0xD0 
+  {  2228,  11,  20,  16,    2,  -19, 0 },   // 0xD1 
+  {  2256,  14,  19,  16,    1,  -18, 1 },   // 0xD2 
+  {  2281,  14,  19,  16,    1,  -18, 1 },   // 0xD3 
+  {  2306,  14,  19,  16,    1,  -18, 1 },   // 0xD4 
+  {  2333,  14,  20,  16,    1,  -19, 1 },   // 0xD5 
+  {  2363,  14,  19,  16,    1,  -18, 1 },   // 0xD6 
+  {  2390,  10,  10,  12,    1,  -11, 0 },   // 0xD7 
+  {  2403,  14,  19,  16,    1,  -16, 0 },   // 0xD8 
+  {  2437,  11,  19,  15,    2,  -18, 1 },   // 0xD9 
+  {  2458,  11,  19,  15,    2,  -18, 1 },   // 0xDA 
+  {  2479,  11,  19,  15,    2,  -18, 1 },   // 0xDB 
+  {  2502,  11,  19,  15,    2,  -18, 1 },   // 0xDC 
+  {  2524,  11,  19,  12,    0,  -18, 1 },   // 0xDD 
+  {  2549,   9,  15,  12,    2,  -14, 1 },   // 0xDE 
+  {  2565,  10,  16,  13,    2,  -15, 0 },   // 0xDF 
+  {  2585,   9,  17,  12,    1,  -16, 1 },   // 0xE0 
+  {  2603,   9,  17,  12,    1,  -16, 1 },   // 0xE1 
+  {  2621,   9,  17,  12,    1,  -16, 0 },   // 0xE2 
+  {  2641,  10,  17,  12,    0,  -16, 0 },   // 0xE3 
+  {  2663,   9,  15,  12,    1,  -14, 0 },   // 0xE4 
+  {  2680,   9,  16,  12,    1,  -15, 0 },   // 0xE5 
+  {  2698,  16,  11,  19,    1,  -10, 1 },   // 0xE6 
+  {  2718,   8,  15,  10,    1,  -10, 0 },   // 0xE7 
+  {  2733,  10,  17,  12,    1,  -16, 1 },   // 0xE8 
+  {  2749,  10,  17,  12,    1,  -16, 1 },   // 0xE9 
+  {  2765,  10,  17,  12,    1,  -16, 1 },   // 0xEA 
+  {  2783,  10,  15,  12,    1,  -14, 1 },   // 0xEB 
+  {  2799,   6,  17,   6,   -2,  -16, 0 },   // 0xEC 
+  {  2812,   5,  17,   6,    0,  -16, 0 },   // 0xED 
+  {  2823,   8,  17,   6,   -2,  -16, 0 },   // 0xEE 
+  {  2840,   7,  15,   6,   -2,  -14, 0 },   // 0xEF 
+  {  2854,  10,  16,  13,    1,  -15, 0 },   // 0xF0 
+  {  2874,  10,  17,  13,    1,  -16, 0 },   // 0xF1 
+  {  2896,  11,  17,  13,    1,  -16, 1 },   // 0xF2 
+  {  2917,  11,  17,  13,    1,  -16, 1 },   // 0xF3 
+  {  2938,  11,  17,  13,    1,  -16, 1 },   // 0xF4 
+  {  2960,  11,  17,  13,    1,  -16, 0 },   // 0xF5 
+  {  2984,  11,  15,  13,    1,  -14, 1 },   // 0xF6 
+  {  3004,  10,  12,  12,    1,  -12, 1 },   // 0xF7 
+  {  3013,  11,  15,  13,    1,  -12, 0 },   // 0xF8 
+  {  3034,   9,  17,  13,    2,  -16, 1 },   // 0xF9 
+  {  3051,   9,  17,  13,    2,  -16, 1 },   // 0xFA 
+  {  3068,   9,  17,  13,    2,  -16, 1 },   // 0xFB 
+  {  3087,   9,  15,  13,    2,  -14, 0 },   // 0xFC 
+  {  3104,  10,  21,  11,    0,  -16, 0 },   // 0xFD 
+  {  3131,  10,  20,  13,    2,  -15, 0 },   // 0xFE 
+  {  3156,  10,  19,  11,    0,  -14, 0 },   // 0xFF 
+};
+
+const uint8_t Calibri12ptRleIndex[] PROGMEM = {
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+   16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+   32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+   48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+   64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+   80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+   95,  96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+  111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
+  127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+  143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+  159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+  175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+};
+
+const UiRleFont Calibri12ptRle PROGMEM = {
+  Calibri12ptRleData, Calibri12ptRleGlyphs, Calibri12ptRleIndex,
+  0x20, 0xFF, 19, 5, 29, 21 };
+
+// Approx. 4952 bytes
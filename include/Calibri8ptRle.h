@@ -0,0 +1,350 @@
+// Generated by tools/fontsubset.py from include/Calibri8pt8b.h
+// 191 glyphs, 5 run-length encoded
+
+#pragma once
+#include "UiText.h"
+
+const uint8_t Calibri8ptRleData[] PROGMEM = {
+  0xFF, 0x60, 0x99, 0x99, 0x22, 0x22, 0x22, 0xFF, 0x22, 0x44, 0xFF, 0x44,
+  0x44, 0x44, 0x10, 0x47, 0xA1, 0x82, 0x06, 0x06, 0x04, 0x18, 0x5E, 0x20,
+  0x80, 0x61, 0x24, 0x49, 0x22, 0x50, 0x64, 0x02, 0x60, 0xA4, 0x49, 0x22,
+  0x48, 0x60, 0x38, 0x22, 0x11, 0x09, 0x03, 0x02, 0x8A, 0x25, 0x0A, 0x82,
+  0x42, 0x9E, 0x20, 0xF0, 0x29, 0x49, 0x24, 0x92, 0x24, 0x40, 0x89, 0x12,
+  0x49, 0x24, 0xA5, 0x00, 0x25, 0x5C, 0xEA, 0x90, 0x10, 0x20, 0x47, 0xF1,
+  0x02, 0x04, 0x00, 0x56, 0xE0, 0xC0, 0x04, 0x10, 0x82, 0x10, 0x42, 0x08,
+  0x21, 0x04, 0x20, 0x80, 0x7A, 0x18, 0x61, 0x86, 0x18, 0x61, 0x85, 0xE0,
+  0x23, 0x28, 0x42, 0x10, 0x84, 0x27, 0xC0, 0x7A, 0x10, 0x41, 0x08, 0x21,
+  0x08, 0x43, 0xF0, 0x7A, 0x10, 0x41, 0x78, 0x10, 0x41, 0x85, 0xE0, 0x18,
+  0x62, 0x8A, 0x49, 0x28, 0xBF, 0x08, 0x20, 0x7D, 0x04, 0x10, 0x78, 0x10,
+  0x41, 0x85, 0xE0, 0x3D, 0x08, 0x20, 0xBB, 0x18, 0x61, 0x85, 0xE0, 0xFC,
+  0x10, 0x82, 0x10, 0x41, 0x08, 0x21, 0x00, 0x7A, 0x18, 0x61, 0x7A, 0x18,
+  0x61, 0x85, 0xE0, 0x7A, 0x18, 0x61, 0x8D, 0xD0, 0x41, 0x0B, 0xC0, 0xC6,
+  0x50, 0x15, 0x80, 0x04, 0x66, 0x20, 0x60, 0x60, 0x40, 0x07, 0xE7, 0x81,
+  0x81, 0x81, 0x19, 0x88, 0x00, 0x74, 0x42, 0x10, 0x98, 0x84, 0x01, 0x08,
+  0x0F, 0xC3, 0x02, 0x40, 0x14, 0x69, 0x89, 0x99, 0x09, 0x91, 0x19, 0x32,
+  0x8C, 0xC4, 0x00, 0x60, 0x01, 0xF8, 0x08, 0x04, 0x05, 0x02, 0x82, 0x21,
+  0x11, 0xFC, 0x82, 0x80, 0xC0, 0x40, 0xF9, 0x0A, 0x14, 0x2F, 0x90, 0xA0,
+  0xC1, 0x83, 0xF8, 0x3E, 0x41, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x41,
+  0x3E, 0xFC, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0xFC, 0xFE,
+  0x08, 0x20, 0xFA, 0x08, 0x20, 0x83, 0xF0, 0xFC, 0x21, 0x0F, 0xC2, 0x10,
+  0x84, 0x00, 0x3E, 0x41, 0x80, 0x80, 0x80, 0x8F, 0x81, 0x81, 0x41, 0x3E,
+  0x81, 0x81, 0x81, 0x81, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x0A, 0x11,
+  0x11, 0x11, 0x11, 0x1E, 0x86, 0x29, 0x28, 0xC2, 0x89, 0x24, 0x8A, 0x10,
+  0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x83, 0xF0, 0xC0, 0x78, 0x0E, 0x82,
+  0xD0, 0x59, 0x13, 0x22, 0x62, 0x8C, 0x51, 0x84, 0x30, 0x84, 0xC1, 0xA1,
+  0xA1, 0x91, 0x91, 0x89, 0x89, 0x85, 0x85, 0x83, 0x3E, 0x20, 0xA0, 0x30,
+  0x18, 0x0C, 0x06, 0x03, 0x01, 0x41, 0x1F, 0x00, 0xFA, 0x18, 0x61, 0x87,
+  0xE8, 0x20, 0x82, 0x00, 0x3E, 0x10, 0x48, 0x0A, 0x02, 0x80, 0xA0, 0x28,
+  0x0A, 0x02, 0x41, 0x0F, 0xC0, 0x0C, 0xF9, 0x0A, 0x14, 0x28, 0x5F, 0x22,
+  0x42, 0x85, 0x04, 0x74, 0x61, 0x06, 0x08, 0x21, 0x8B, 0x80, 0xFE, 0x20,
+  0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x42, 0x3C, 0x80, 0xC0, 0x50, 0x48, 0x22, 0x21, 0x10,
+  0x50, 0x28, 0x08, 0x04, 0x00, 0x84, 0x30, 0x86, 0x10, 0xA5, 0x24, 0xA4,
+  0x94, 0x94, 0x51, 0x8C, 0x20, 0x84, 0x10, 0x81, 0x42, 0x24, 0x24, 0x18,
+  0x18, 0x24, 0x24, 0x42, 0x81, 0x82, 0x89, 0x11, 0x42, 0x82, 0x04, 0x08,
+  0x10, 0x20, 0xFE, 0x04, 0x10, 0x41, 0x02, 0x08, 0x20, 0x81, 0xFC, 0xF2,
+  0x49, 0x24, 0x92, 0x49, 0xC0, 0x82, 0x04, 0x10, 0x20, 0x81, 0x04, 0x10,
+  0x20, 0x81, 0x04, 0xE4, 0x92, 0x49, 0x24, 0x93, 0xC0, 0x10, 0x50, 0xA2,
+  0x24, 0x50, 0x40, 0xFF, 0x88, 0x80, 0x7A, 0x10, 0x5F, 0x86, 0x37, 0x40,
+  0x82, 0x08, 0x20, 0xBB, 0x18, 0x61, 0x87, 0x1B, 0x80, 0x74, 0x61, 0x08,
+  0x45, 0xC0, 0x04, 0x10, 0x41, 0x76, 0x38, 0x61, 0x86, 0x37, 0x40, 0x7A,
+  0x18, 0x7F, 0x82, 0x07, 0xC0, 0x34, 0x44, 0xF4, 0x44, 0x44, 0x40, 0x7F,
+  0x0A, 0x14, 0x27, 0x90, 0x1F, 0x41, 0x82, 0xF8, 0x82, 0x08, 0x20, 0xBB,
+  0x18, 0x61, 0x86, 0x18, 0x40, 0xBF, 0x80, 0x20, 0x92, 0x49, 0x24, 0xE0,
+  0x84, 0x21, 0x08, 0xCA, 0x98, 0xA4, 0xA2, 0x0B, 0xB3, 0x66, 0x62, 0x31,
+  0x18, 0x8C, 0x46, 0x22, 0xBB, 0x18, 0x61, 0x86, 0x18, 0x40, 0x7A, 0x18,
+  0x61, 0x86, 0x17, 0x80, 0xBB, 0x18, 0x61, 0x87, 0x1B, 0xA0, 0x82, 0x00,
+  0x76, 0x38, 0x61, 0x86, 0x37, 0x41, 0x04, 0x10, 0xBC, 0x88, 0x88, 0x80,
+  0x7C, 0x20, 0xE0, 0x87, 0xC0, 0x44, 0xF4, 0x44, 0x44, 0x30, 0x86, 0x18,
+  0x61, 0x86, 0x37, 0x40, 0x8C, 0x54, 0xA5, 0x10, 0x80, 0x44, 0x51, 0x12,
+  0xA8, 0xAA, 0x2A, 0x84, 0x41, 0x10, 0x8A, 0x94, 0x45, 0x2A, 0x20, 0x8C,
+  0x54, 0xA5, 0x10, 0x84, 0x42, 0x00, 0xF1, 0x24, 0x48, 0xF0, 0x34, 0x44,
+  0x44, 0x84, 0x44, 0x44, 0x43, 0x0E, 0xC2, 0x22, 0x22, 0x12, 0x22, 0x22,
+  0x2C, 0x63, 0x26, 0x30, 0xDF, 0xE0, 0x10, 0xE4, 0x60, 0x82, 0x08, 0x11,
+  0x38, 0x40, 0x39, 0x14, 0x10, 0xF9, 0x04, 0x10, 0x43, 0xF0, 0x42, 0x3C,
+  0x42, 0x42, 0x42, 0x42, 0x3C, 0x42, 0x82, 0x89, 0x11, 0x42, 0x82, 0x1F,
+  0x08, 0x7C, 0x20, 0xFC, 0xFC, 0x39, 0x14, 0x18, 0x5A, 0x18, 0x61, 0x68,
+  0x60, 0xA2, 0x70, 0xB4, 0x1F, 0x0C, 0x19, 0x39, 0x48, 0x99, 0x03, 0x20,
+  0x64, 0x0C, 0x89, 0x4E, 0x4C, 0x18, 0x7C, 0x00, 0xE1, 0x79, 0x70, 0xF0,
+  0x25, 0x24, 0xA4, 0x49, 0x22, 0x40, 0xFE, 0x04, 0x08, 0xE0, 0x7A, 0x1B,
+  0x6D, 0x85, 0xE0, 0xF0, 0x69, 0x96, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04,
+  0x00, 0xFE, 0xE1, 0x12, 0x24, 0xF0, 0xE1, 0x16, 0x11, 0xE0, 0x2A, 0x00,
+  0x85, 0x0A, 0x14, 0x28, 0x51, 0xBD, 0xC0, 0x81, 0x00, 0x7F, 0xE7, 0xCF,
+  0x9F, 0x2E, 0x44, 0x89, 0x12, 0x24, 0x48, 0x90, 0xC0, 0x47, 0x00, 0x74,
+  0x92, 0x48, 0x74, 0x63, 0x17, 0x03, 0xE0, 0x91, 0x24, 0x89, 0x49, 0x29,
+  0x00, 0x61, 0x51, 0x08, 0x84, 0x82, 0x80, 0x58, 0x4C, 0x4A, 0x27, 0xA0,
+  0x80, 0x61, 0x28, 0x82, 0x20, 0x90, 0x28, 0x02, 0xE1, 0x04, 0x82, 0x21,
+  0x10, 0xF0, 0xE0, 0x84, 0x46, 0x10, 0x48, 0xE4, 0x01, 0x60, 0x98, 0x4A,
+  0x13, 0xC8, 0x20, 0x21, 0x00, 0x42, 0x32, 0x10, 0x84, 0x5C, 0x10, 0x04,
+  0x00, 0x01, 0x00, 0x80, 0xA0, 0x50, 0x44, 0x22, 0x3F, 0x90, 0x50, 0x18,
+  0x08, 0x04, 0x04, 0x00, 0x01, 0x00, 0x80, 0xA0, 0x50, 0x44, 0x22, 0x3F,
+  0x90, 0x50, 0x18, 0x08, 0x18, 0x12, 0x00, 0x01, 0x00, 0x80, 0xA0, 0x50,
+  0x44, 0x22, 0x3F, 0x90, 0x50, 0x18, 0x08, 0x12, 0x15, 0x09, 0x00, 0x00,
+  0x80, 0x40, 0x50, 0x28, 0x22, 0x11, 0x1F, 0xC8, 0x28, 0x0C, 0x04, 0x24,
+  0x12, 0x00, 0x01, 0x00, 0x80, 0xA0, 0x50, 0x44, 0x22, 0x3F, 0x90, 0x50,
+  0x18, 0x08, 0x1C, 0x0A, 0x07, 0x00, 0x00, 0x80, 0x40, 0x50, 0x28, 0x22,
+  0x11, 0x1F, 0xC8, 0x28, 0x0C, 0x04, 0x0F, 0xE1, 0x40, 0x48, 0x09, 0x02,
+  0x3C, 0x44, 0x10, 0x83, 0xF0, 0x82, 0x10, 0x7C, 0x3E, 0x41, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x41, 0x3E, 0x08, 0x04, 0x18, 0x20, 0x40, 0x3F,
+  0x82, 0x08, 0x3E, 0x82, 0x08, 0x20, 0xFC, 0x08, 0x40, 0x3F, 0x82, 0x08,
+  0x3E, 0x82, 0x08, 0x20, 0xFC, 0x31, 0x20, 0x3F, 0x82, 0x08, 0x3E, 0x82,
+  0x08, 0x20, 0xFC, 0x49, 0x20, 0x3F, 0x82, 0x08, 0x3E, 0x82, 0x08, 0x20,
+  0xFC, 0x91, 0x55, 0x55, 0x40, 0x62, 0xAA, 0xAA, 0x80, 0x69, 0x04, 0x44,
+  0x44, 0x44, 0x44, 0x40, 0x99, 0x04, 0x44, 0x44, 0x44, 0x44, 0x40, 0x7E,
+  0x20, 0x90, 0x28, 0x1F, 0x8A, 0x05, 0x02, 0x81, 0x41, 0x3F, 0x00, 0x12,
+  0x2A, 0x24, 0x00, 0xC1, 0xA1, 0xA1, 0x91, 0x91, 0x89, 0x89, 0x85, 0x85,
+  0x83, 0x10, 0x04, 0x00, 0x07, 0xC4, 0x14, 0x06, 0x03, 0x01, 0x80, 0xC0,
+  0x60, 0x28, 0x23, 0xE0, 0x04, 0x04, 0x00, 0x07, 0xC4, 0x14, 0x06, 0x03,
+  0x01, 0x80, 0xC0, 0x60, 0x28, 0x23, 0xE0, 0x18, 0x12, 0x00, 0x07, 0xC4,
+  0x14, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x28, 0x23, 0xE0, 0x12, 0x15,
+  0x09, 0x00, 0x03, 0xE2, 0x0A, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x14,
+  0x11, 0xF0, 0x12, 0x09, 0x00, 0x07, 0xC4, 0x14, 0x06, 0x03, 0x01, 0x80,
+  0xC0, 0x60, 0x28, 0x23, 0xE0, 0x44, 0x50, 0x41, 0x44, 0x40, 0x01, 0x00,
+  0x8F, 0x88, 0x68, 0x4C, 0x26, 0x23, 0x11, 0x90, 0xC8, 0x58, 0x47, 0xC4,
+  0x02, 0x00, 0x10, 0x08, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x42, 0x3C, 0x08, 0x10, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x42, 0x3C, 0x18, 0x24, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x42, 0x3C, 0x24, 0x24, 0x00, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x08, 0x20, 0x04, 0x14, 0x48, 0x8A,
+  0x14, 0x10, 0x20, 0x40, 0x81, 0x00, 0x82, 0x0F, 0xA1, 0x86, 0x18, 0x7E,
+  0x82, 0x00, 0x72, 0x28, 0xA2, 0x9A, 0x8A, 0x26, 0x86, 0x1B, 0x80, 0x40,
+  0x81, 0x00, 0x7A, 0x10, 0x5F, 0x86, 0x37, 0x40, 0x08, 0x42, 0x00, 0x7A,
+  0x10, 0x5F, 0x86, 0x37, 0x40, 0x10, 0xA4, 0x40, 0x7A, 0x10, 0x5F, 0x86,
+  0x37, 0x40, 0x4A, 0xA9, 0x00, 0x7A, 0x10, 0x5F, 0x86, 0x37, 0x40, 0x28,
+  0xA0, 0x1E, 0x84, 0x17, 0xE1, 0x8D, 0xD0, 0x38, 0xA3, 0x80, 0x7A, 0x10,
+  0x5F, 0x86, 0x37, 0x40, 0x77, 0xA2, 0x10, 0x85, 0xFF, 0x88, 0x22, 0x07,
+  0x7C, 0x74, 0x61, 0x08, 0x45, 0xC4, 0x13, 0x00, 0x40, 0x81, 0x00, 0x7A,
+  0x18, 0x7F, 0x82, 0x07, 0xC0, 0x08, 0x42, 0x00, 0x7A, 0x18, 0x7F, 0x82,
+  0x07, 0xC0, 0x10, 0xA4, 0x40, 0x7A, 0x18, 0x7F, 0x82, 0x07, 0xC0, 0x28,
+  0xA0, 0x1E, 0x86, 0x1F, 0xE0, 0x81, 0xF0, 0x88, 0x84, 0x92, 0x49, 0x00,
+  0x2A, 0x04, 0x92, 0x49, 0x00, 0x22, 0xA2, 0x02, 0x10, 0x84, 0x21, 0x08,
+  0xB4, 0x24, 0x92, 0x48, 0x24, 0xE4, 0x82, 0x7E, 0x18, 0x61, 0x86, 0x17,
+  0x80, 0x25, 0x54, 0x80, 0xBB, 0x18, 0x61, 0x86, 0x18, 0x40, 0x40, 0x81,
+  0x00, 0x7A, 0x18, 0x61, 0x86, 0x17, 0x80, 0x08, 0x42, 0x00, 0x7A, 0x18,
+  0x61, 0x86, 0x17, 0x80, 0x10, 0xA4, 0x40, 0x7A, 0x18, 0x61, 0x86, 0x17,
+  0x80, 0x25, 0x54, 0x80, 0x7A, 0x18, 0x61, 0x86, 0x17, 0x80, 0x28, 0xA0,
+  0x1E, 0x86, 0x18, 0x61, 0x85, 0xE0, 0x31, 0x61, 0xA7, 0xA1, 0x61, 0x30,
+  0x05, 0xE8, 0xE5, 0xA6, 0x9C, 0x5E, 0x80, 0x40, 0x81, 0x00, 0x86, 0x18,
+  0x61, 0x86, 0x37, 0x40, 0x08, 0x42, 0x00, 0x86, 0x18, 0x61, 0x86, 0x37,
+  0x40, 0x10, 0xA4, 0x40, 0x86, 0x18, 0x61, 0x86, 0x37, 0x40, 0x49, 0x20,
+  0x21, 0x86, 0x18, 0x61, 0x8D, 0xD0, 0x08, 0x88, 0x08, 0xC5, 0x4A, 0x51,
+  0x08, 0x44, 0x20, 0x82, 0x08, 0x20, 0xBB, 0x18, 0x61, 0x87, 0x1B, 0xA0,
+  0x82, 0x00, 0x52, 0x81, 0x18, 0xA9, 0x4A, 0x21, 0x08, 0x84, 0x00,
+};
+
+const UiRleGlyph Calibri8ptRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   4,    0,    1, 0 },   // 0x20 
+  {     0,   1,  11,   5,    2,  -10, 0 },   // 0x21 !
+  {     2,   4,   4,   6,    1,  -10, 0 },   // 0x22 "
+  {     4,   8,  10,   8,    0,   -9, 0 },   // 0x23 #
+  {    14,   6,  14,   8,    1,  -11, 0 },   // 0x24 $
+  {    25,  10,  10,  11,    0,   -9, 0 },   // 0x25 %
+  {    38,   9,  11,  11,    1,  -10, 0 },   // 0x26 &
+  {    51,   1,   4,   4,    1,  -10, 0 },   // 0x27 '
+  {    52,   3,  14,   5,    1,  -10, 0 },   // 0x28 (
+  {    58,   3,  14,   5,    1,  -10, 0 },   // 0x29 )
+  {    64,   5,   6,   8,    1,  -10, 0 },   // 0x2A *
+  {    68,   7,   7,   8,    0,   -7, 0 },   // 0x2B +
+  {    75,   2,   4,   4,    0,   -1, 0 },   // 0x2C ,
+  {    76,   3,   1,   5,    1,   -3, 0 },   // 0x2D -
+  {    77,   1,   2,   4,    1,   -1, 0 },   // 0x2E .
+  {    78,   6,  13,   6,    0,  -10, 0 },   // 0x2F /
+  {    88,   6,  10,   8,    1,   -9, 0 },   // 0x30 0
+  {    96,   5,  10,   8,    2,   -9, 0 },   // 0x31 1
+  {   103,   6,  10,   8,    1,   -9, 0 },   // 0x32 2
+  {   111,   6,  10,   8,    1,   -9, 0 },   // 0x33 3
+  {   119,   6,  10,   8,    1,   -9, 0 },   // 0x34 4
+  {   127,   6,  10,   8,    1,   -9, 0 },   // 0x35 5
+  {   135,   6,  10,   8,    1,   -9, 0 },   // 0x36 6
+  {   143,   6,  10,   8,    1,   -9, 0 },   // 0x37 7
+  {   151,   6,  10,   8,    1,   -9, 0 },   // 0x38 8
+  {   159,   6,  10,   8,    1,   -9, 0 },   // 0x39 9
+  {   167,   1,   7,   4,    1,   -6, 0 },   // 0x3A :
+  {   168,   2,   9,   4,    0,   -6, 0 },   // 0x3B ;
+  {   171,   6,   7,   8,    1,   -7, 0 },   // 0x3C <
+  {   177,   7,   4,   8,    0,   -6, 1 },   // 0x3D =
+  {   179,   6,   7,   8,    1,   -7, 0 },   // 0x3E >
+  {   185,   5,  11,   7,    1,  -10, 0 },   // 0x3F ?
+  {   192,  12,  12,  14,    1,   -9, 0 },   // 0x40 @
+  {   210,   9,  10,   9,    0,   -9, 0 },   // 0x41 A
+  {   222,   7,  10,   9,    1,   -9, 0 },   // 0x42 B
+  {   231,   8,  10,   9,    1,   -9, 0 },   // 0x43 C
+  {   241,   8,  10,  10,    1,   -9, 0 },   // 0x44 D
+  {   251,   6,  10,   8,    1,   -9, 0 },   // 0x45 E
+  {   259,   5,  10,   7,    1,   -9, 0 },   // 0x46 F
+  {   266,   8,  10,  10,    1,   -9, 0 },   // 0x47 G
+  {   276,   8,  10,  10,    1,   -9, 0 },   // 0x48 H
+  {   286,   1,  10,   4,    1,   -9, 1 },   // 0x49 I
+  {   287,   4,  10,   5,    0,   -9, 0 },   // 0x4A J
+  {   292,   6,  10,   8,    1,   -9, 0 },   // 0x4B K
+  {   300,   6,  10,   7,    1,   -9, 0 },   // 0x4C L
+  {   308,  11,  10,  13,    1,   -9, 0 },   // 0x4D M
+  {   322,   8,  10,  10,    1,   -9, 0 },   // 0x4E N
+  {   332,   9,  10,  11,    1,   -9, 0 },   // 0x4F O
+  {   344,   6,  10,   8,    1,   -9, 0 },   // 0x50 P
+  {   352,  10,  11,  11,    1,   -9, 0 },   // 0x51 Q
+  {   366,   7,  10,   9,    1,   -9, 0 },   // 0x52 R
+  {   375,   5,  10,   7,    1,   -9, 0 },   // 0x53 S
+  {   382,   7,  10,   8,    0,   -9, 0 },   // 0x54 T
+  {   391,   8,  10,  10,    1,   -9, 0 },   // 0x55 U
+  {   401,   9,  10,   9,    0,   -9, 0 },   // 0x56 V
+  {   413,  11,  10,  14,    1,   -9, 0 },   // 0x57 W
+  {   427,   8,  10,   8,    0,   -9, 0 },   // 0x58 X
+  {   437,   7,  10,   8,    0,   -9, 0 },   // 0x59 Y
+  {   446,   7,  10,   8,    0,   -9, 0 },   // 0x5A Z
+  {   455,   3,  14,   5,    1,  -10, 0 },   // 0x5B [
+  {   461,   6,  13,   6,    0,  -10, 0 },   // 0x5C 
+  {   471,   3,  14,   5,    1,  -10, 0 },   // 0x5D ]
+  {   477,   7,   6,   8,    0,   -9, 0 },   // 0x5E ^
+  {   483,   8,   1,   8,    0,    3, 0 },   // 0x5F _
+  {   484,   3,   3,   5,    1,  -10, 0 },   // 0x60 `
+  {   486,   6,   7,   8,    1,   -6, 0 },   // 0x61 a
+  {   492,   6,  11,   8,    1,  -10, 0 },   // 0x62 b
+  {   501,   5,   7,   7,    1,   -6, 0 },   // 0x63 c
+  {   506,   6,  11,   8,    1,  -10, 0 },   // 0x64 d
+  {   515,   6,   7,   8,    1,   -6, 0 },   // 0x65 e
+  {   521,   4,  11,   5,    0,  -10, 0 },   // 0x66 f
+  {   527,   7,  10,   8,    1,   -6, 0 },   // 0x67 g
+  {   536,   6,  11,   8,    1,  -10, 0 },   // 0x68 h
+  {   545,   1,   9,   4,    1,   -8, 0 },   // 0x69 i
+  {   547,   3,  12,   4,   -1,   -8, 0 },   // 0x6A j
+  {   552,   5,  11,   7,    1,  -10, 0 },   // 0x6B k
+  {   559,   1,  11,   4,    1,  -10, 1 },   // 0x6C l
+  {   560,   9,   7,  12,    1,   -6, 0 },   // 0x6D m
+  {   568,   6,   7,   8,    1,   -6, 0 },   // 0x6E n
+  {   574,   6,   7,   8,    1,   -6, 0 },   // 0x6F o
+  {   580,   6,  10,   8,    1,   -6, 0 },   // 0x70 p
+  {   588,   6,  10,   8,    1,   -6, 0 },   // 0x71 q
+  {   596,   4,   7,   5,    1,   -6, 0 },   // 0x72 r
+  {   600,   5,   7,   7,    1,   -6, 0 },   // 0x73 s
+  {   605,   4,   9,   5,    0,   -8, 0 },   // 0x74 t
+  {   610,   6,   7,   8,    1,   -6, 0 },   // 0x75 u
+  {   616,   5,   7,   7,    1,   -6, 0 },   // 0x76 v
+  {   621,  10,   7,  11,    0,   -6, 0 },   // 0x77 w
+  {   630,   5,   7,   7,    1,   -6, 0 },   // 0x78 x
+  {   635,   5,  10,   7,    1,   -6, 0 },   // 0x79 y
+  {   642,   4,   7,   6,    1,   -6, 0 },   // 0x7A z
+  {   646,   4,  14,   5,    1,  -10, 0 },   // 0x7B {
+  {   653,   1,  14,   7,    3,  -10, 1 },   // 0x7C |
+  {   654,   4,  14,   5,    0,  -10, 0 },   // 0x7D }
+  {   661,   7,   3,   8,    0,   -8, 0 },   // 0x7E ~
+  {   664,   0,   0,   4,    0,    1, 0 },   // 0xA0 
+  {   664,   1,  11,   5,    2,   -8, 0 },   // 0xA1 
+  {   666,   6,  10,   8,    1,   -9, 0 },   // 0xA2 
+  {   674,   6,  10,   8,    1,   -9, 0 },   // 0xA3 
+  {   682,   8,   8,   8,    0,   -8, 0 },   // 0xA4 
+  {   690,   7,  10,   8,    0,   -9, 0 },   // 0xA5 
+  {   699,   1,  14,   8,    3,  -10, 0 },   // 0xA6 
+  {   701,   6,  13,   8,    1,  -10, 0 },   // 0xA7 
+  {   711,   3,   2,   6,    1,   -9, 0 },   // 0xA8 
+  {   712,  11,  11,  13,    1,  -10, 0 },   // 0xA9 
+  {   728,   4,   7,   6,    1,   -9, 0 },   // 0xAA 
+  {   732,   6,   7,   8,    1,   -7, 0 },   // 0xAB 
+  {   738,   7,   3,   8,    0,   -4, 0 },   // 0xAC 
+  {   741,   3,   1,   5,    1,   -3, 0 },   // 0xAD 
+  {   742,   6,   6,   8,    1,  -10, 0 },   // 0xAE 
+  {   747,   4,   1,   6,    1,   -9, 0 },   // 0xAF 
+  {   748,   4,   4,   5,    1,  -10, 0 },   // 0xB0 
+  {   750,   7,   9,   8,    0,   -8, 0 },   // 0xB1 
+  {   758,   4,   7,   5,    0,  -11, 0 },   // 0xB2 
+  {   762,   4,   7,   5,    0,  -11, 0 },   // 0xB3 
+  {   766,   3,   3,   5,    1,  -10, 0 },   // 0xB4 
+  {   768,   7,  10,   9,    1,   -6, 0 },   // 0xB5 
+  {   777,   7,  12,   9,    1,   -9, 0 },   // 0xB6 
+  {   788,   1,   2,   4,    1,   -5, 0 },   // 0xB7 
+  {   789,   3,   3,   5,    1,    1, 0 },   // 0xB8 
+  {   791,   3,   7,   4,    0,  -11, 0 },   // 0xB9 
+  {   794,   5,   7,   7,    1,   -9, 0 },   // 0xBA 
+  {   799,   6,   7,   8,    1,   -7, 0 },   // 0xBB 
+  {   805,   9,  10,  10,    0,   -9, 0 },   // 0xBC 
+  {   817,  10,  10,  11,    0,   -9, 0 },   // 0xBD 
+  {   830,  10,  10,  11,    0,   -9, 0 },   // 0xBE 
+  {   843,   5,  11,   7,    1,   -8, 0 },   // 0xBF 
+  {   850,   9,  13,   9,    0,  -12, 0 },   // 0xC0 
+  {   865,   9,  13,   9,    0,  -12, 0 },   // 0xC1 
+  {   880,   9,  13,   9,    0,  -12, 0 },   // 0xC2 
+  {   895,   9,  14,   9,    0,  -13, 0 },   // 0xC3 
+  {   911,   9,  13,   9,    0,  -12, 0 },   // 0xC4 
+  {   926,   9,  14,   9,    0,  -13, 0 },   // 0xC5 
+  {   942,  11,  10,  12,    0,   -9, 0 },   // 0xC6 
+  {   956,   8,  13,   9,    1,   -9, 0 },   // 0xC7 
+  {   969,   6,  13,   8,    1,  -12, 0 },   // 0xC8 
+  {   979,   6,  13,   8,    1,  -12, 0 },   // 0xC9 
+  {   989,   6,  13,   8,    1,  -12, 0 },   // 0xCA 
+  {   999,   6,  13,   8,    1,  -12, 0 },   // 0xCB 
+  {  1009,   2,  13,   4,    0,  -12, 0 },   // 0xCC 
+  {  1013,   2,  13,   4,    1,  -12, 0 },   // 0xCD 
+  {  1017,   4,  13,   4,    0,  -12, 0 },   // 0xCE 
+  {  1024,   4,  13,   4,    0,  -12, 0 },   // 0xCF 
+  {  1031,   9,  10,  10,    0,   -9, 0 },   // 0xD0 
+  {  1043,   8,  14,  10,    1,  -13, 0 },   // 0xD1 
+  {  1057,   9,  13,  11,    1,  -12, 0 },   // 0xD2 
+  {  1072,   9,  13,  11,    1,  -12, 0 },   // 0xD3 
+  {  1087,   9,  13,  11,    1,  -12, 0 },   // 0xD4 
+  {  1102,   9,  14,  11,    1,  -13, 0 },   // 0xD5 
+  {  1118,   9,  13,  11,    1,  -12, 0 },   // 0xD6 
+  {  1133,   7,   5,   8,    0,   -6, 0 },   // 0xD7 
+  {  1138,   9,  14,  11,    1,  -11, 0 },   // 0xD8 
+  {  1154,   8,  13,  10,    1,  -12, 0 },   // 0xD9 
+  {  1167,   8,  13,  10,    1,  -12, 0 },   // 0xDA 
+  {  1180,   8,  13,  10,    1,  -12, 0 },   // 0xDB 
+  {  1193,   8,  13,  10,    1,  -12, 0 },   // 0xDC 
+  {  1206,   7,  13,   8,    0,  -12, 0 },   // 0xDD 
+  {  1218,   6,  10,   8,    1,   -9, 0 },   // 0xDE 
+  {  1226,   6,  11,   8,    1,  -10, 0 },   // 0xDF 
+  {  1235,   6,  11,   8,    1,  -10, 0 },   // 0xE0 
+  {  1244,   6,  11,   8,    1,  -10, 0 },   // 0xE1 
+  {  1253,   6,  11,   8,    1,  -10, 0 },   // 0xE2 
+  {  1262,   6,  11,   8,    1,  -10, 0 },   // 0xE3 
+  {  1271,   6,  10,   8,    1,   -9, 0 },   // 0xE4 
+  {  1279,   6,  11,   8,    1,  -10, 0 },   // 0xE5 
+  {  1288,  10,   7,  12,    1,   -6, 0 },   // 0xE6 
+  {  1297,   5,  10,   7,    1,   -6, 0 },   // 0xE7 
+  {  1304,   6,  11,   8,    1,  -10, 0 },   // 0xE8 
+  {  1313,   6,  11,   8,    1,  -10, 0 },   // 0xE9 
+  {  1322,   6,  11,   8,    1,  -10, 0 },   // 0xEA 
+  {  1331,   6,  10,   8,    1,   -9, 0 },   // 0xEB 
+  {  1339,   3,  11,   4,    0,  -10, 0 },   // 0xEC 
+  {  1344,   3,  11,   4,    0,  -10, 0 },   // 0xED 
+  {  1349,   5,  11,   4,   -1,  -10, 0 },   // 0xEE 
+  {  1356,   3,  10,   4,    0,   -9, 0 },   // 0xEF 
+  {  1360,   6,  11,   8,    1,  -10, 0 },   // 0xF0 
+  {  1369,   6,  11,   8,    1,  -10, 0 },   // 0xF1 
+  {  1378,   6,  11,   8,    1,  -10, 0 },   // 0xF2 
+  {  1387,   6,  11,   8,    1,  -10, 0 },   // 0xF3 
+  {  1396,   6,  11,   8,    1,  -10, 0 },   // 0xF4 
+  {  1405,   6,  11,   8,    1,  -10, 0 },   // 0xF5 
+  {  1414,   6,  10,   8,    1,   -9, 0 },   // 0xF6 
+  {  1422,   7,   7,   8,    0,   -7, 1 },   // 0xF7 
+  {  1428,   6,   9,   8,    1,   -7, 0 },   // 0xF8 
+  {  1435,   6,  11,   8,    1,  -10, 0 },   // 0xF9 
+  {  1444,   6,  11,   8,    1,  -10, 0 },   // 0xFA 
+  {  1453,   6,  11,   8,    1,  -10, 0 },   // 0xFB 
+  {  1462,   6,  10,   8,    1,   -9, 0 },   // 0xFC 
+  {  1470,   5,  14,   7,    1,  -10, 0 },   // 0xFD 
+  {  1479,   6,  14,   8,    1,  -10, 0 },   // 0xFE 
+  {  1490,   5,  13,   7,    1,   -9, 0 },   // 0xFF 
+};
+
+const uint8_t Calibri8ptRleIndex[] PROGMEM = {
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+   16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+   32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+   48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+   64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+   80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+   95,  96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+  111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
+  127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+  143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+  159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+  175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+};
+
+const UiRleFont Calibri8ptRle PROGMEM = {
+  Calibri8ptRleData, Calibri8ptRleGlyphs, Calibri8ptRleIndex,
+  0x20, 0xFF, 13, 4, 20, 14 };
+
+// Approx. 3271 bytes
@@ -26,7 +26,7 @@ public:
       cfg.freq_write = 40000000;          // SPI clock for transmit (max 80MHz, round 80MHz to integer divisor)
       cfg.freq_read = 16000000;           // SPI clock for receive
       cfg.spi_3wire = false;              // set to true if receive is on MOSI pin
-      cfg.use_lock = true;                // set to true if transaction lock is used
+      cfg.use_lock = false;               // set to true if transaction lock is used (false: only the render task uses the bus)
       cfg.dma_channel = SPI_DMA_CH_AUTO;  // Set DMA channel to use (0=DMA not used / 1=1ch / 2=ch / SPI_DMA_CH_AUTO=auto setting)
                                           // With the ESP-IDF version upgrade, SPI_DMA_CH_AUTO (automatic setting) is recommended for the DMA channel 
       cfg.pin_sclk = TFT_SCLK;            // set SPI SCLK pin number SCK
@@ -0,0 +1,289 @@
+/**
+ * Class        Implementation of the class methods of AudioMeter
+ *
+ * Purpose      The audio path only forwards the PCM and averages
+ *              METER_DECIMATE frames into the ring. The analysis task
+ *              takes the newest METER_FFT_SIZE frames, discards older
+ *              ones and sleeps for the rest of its time slice.
+ *
+ * Remarks      The FFT works in Q15 and halves the values in every
+ *              stage, so the result is X[k]/N and cannot overflow.
+ *              The twiddle factors and the window are computed once
+ *              in startAnalysis().
+ */
+#include "AudioMeter.h"
+
+
+/**
+ * Forward the PCM to the output first, then tap it.
+ * Never waits: frames that do not fit into the ring are dropped.
+ */
+size_t AudioMeter::write(const uint8_t *data, size_t len)
+{
+    size_t written = _out.write(data, len);
+    if (_task == nullptr || _info.bits_per_sample != 16) return written;
+
+    int channels = _info.channels;
+    int n = written / 2;
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t tail = _tail.load(std::memory_order_acquire);
+    uint32_t lost = 0;
+
+    for (int i = 0; i + channels <= n; i += channels)
+    {
+        const uint8_t *s = data + 2*i;
+        int16_t left  = s[0] | s[1] << 8;
+        int16_t right = channels > 1 ? (int16_t)(s[2] | s[3] << 8) : left;
+        _sum[0] += left;
+        _sum[1] += right;
+        if (++_nSum < METER_DECIMATE) continue;
+
+        if (head - tail < METER_RING_LEN)
+        {
+            _ring[head & (METER_RING_LEN-1)][0] = _sum[0] / METER_DECIMATE;
+            _ring[head & (METER_RING_LEN-1)][1] = _sum[1] / METER_DECIMATE;
+            head++;
+        }
+        else lost++;
+        _sum[0] = _sum[1] = 0;
+        _nSum = 0;
+    }
+    _head.store(head, std::memory_order_release);
+    if (lost) _dropped += lost;
+    if (head - tail >= METER_FFT_SIZE) xTaskNotifyGive(_task);
+    return written;
+}
+
+int AudioMeter::availableForWrite()
+{
+    return _out.availableForWrite();
+}
+
+void AudioMeter::setAudioInfo(AudioInfo info)
+{
+    _info = info;
+    _out.setAudioInfo(info);
+}
+
+
+/**
+ * Compute the tables and start the analysis task
+ */
+void AudioMeter::startAnalysis(UBaseType_t priority, BaseType_t core)
+{
+    for (int i = 0; i < METER_FFT_SIZE/2; i++)
+    {
+        _cos[i] = lroundf(32767.0f * cosf(2.0f * PI * i / METER_FFT_SIZE));
+        _sin[i] = lroundf(32767.0f * sinf(2.0f * PI * i / METER_FFT_SIZE));
+    }
+    for (int i = 0; i < METER_FFT_SIZE; i++)
+    {
+        _window[i] = lroundf(32767.0f * (0.5f - 0.5f * cosf(2.0f * PI * i / (METER_FFT_SIZE-1))));
+    }
+    // logarithmic band edges from bin 1 to bin N/2, at least one bin per band
+    _bandEdge[0] = 1;
+    for (int b = 1; b <= METER_BANDS; b++)
+    {
+        int e = lroundf(powf(METER_FFT_SIZE/2, (float)b / METER_BANDS));
+        _bandEdge[b] = max(e, _bandEdge[b-1] + 1);
+    }
+    _bandEdge[METER_BANDS] = METER_FFT_SIZE/2;
+
+    xTaskCreatePinnedToCore(task, "meter", 3072, this, priority, &_task, core);
+    log_i("==> done");
+}
+
+
+void AudioMeter::task(void *arg)
+{
+    static_cast<AudioMeter *>(arg)->run();
+}
+
+
+/**
+ * Analyse the newest block whenever one is available,
+ * at most METER_MAX_RATE times per second
+ */
+void AudioMeter::run()
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(200));
+        uint32_t head = _head.load(std::memory_order_acquire);
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        if (head - tail < METER_FFT_SIZE) continue;
+
+        analyse(head - METER_FFT_SIZE);
+        _tail.store(head, std::memory_order_release);
+        vTaskDelay(pdMS_TO_TICKS(1000 / METER_MAX_RATE));
+    }
+}
+
+
+static uint32_t isqrt(uint64_t v)
+{
+    uint64_t r = 0, bit = 1ULL << 62;
+    while (bit > v) bit >>= 2;
+    while (bit)
+    {
+        if (v >= r + bit) { v -= r + bit; r = (r >> 1) + bit; }
+        else r >>= 1;
+        bit >>= 2;
+    }
+    return (uint32_t)r;
+}
+
+
+/**
+ * Levels and spectrum of the block starting at tail
+ */
+void AudioMeter::analyse(uint32_t tail)
+{
+    uint32_t t0 = micros();
+    AudioLevels lv;
+    uint64_t sq[2] = { 0, 0 };
+    int peak[2] = { 0, 0 };
+
+    for (int i = 0; i < METER_FFT_SIZE; i++)
+    {
+        const int16_t *f = _ring[(tail + i) & (METER_RING_LEN-1)];
+        for (int c = 0; c < 2; c++)
+        {
+            int a = abs(f[c]);
+            if (a > peak[c]) peak[c] = a;
+            sq[c] += a * a;
+        }
+        _re[i] = (((f[0] + f[1]) >> 1) * _window[i]) >> 15;
+        _im[i] = 0;
+    }
+    for (int c = 0; c < 2; c++)
+    {
+        lv.peak[c] = min(peak[c], 32767);
+        lv.rms[c]  = isqrt(sq[c] / METER_FFT_SIZE);
+    }
+
+    fft(_re, _im);
+    for (int b = 0; b < METER_BANDS; b++)
+    {
+        uint64_t energy = 0;
+        for (int k = _bandEdge[b]; k < _bandEdge[b+1]; k++)
+        {
+            energy += (uint32_t)(_re[k] * _re[k]) + (uint32_t)(_im[k] * _im[k]);
+        }
+        lv.band[b] = min(isqrt(energy) * 4, (uint32_t)32767);  // a full scale sine is about -6 dB
+    }
+
+    portENTER_CRITICAL(&_mux);
+    lv.seq = _levels.seq + 1;
+    _levels = lv;
+    portEXIT_CRITICAL(&_mux);
+
+    _usAnalyseLast = micros() - t0;
+    if (_usAnalyseLast > _usAnalyseMax) _usAnalyseMax = _usAnalyseLast;
+    _usAnalyseSum += _usAnalyseLast;
+    _analyses++;
+}
+
+
+/**
+ * In-place radix-2 decimation in time FFT in Q15, scaled by 1/N
+ */
+void AudioMeter::fft(int16_t *re, int16_t *im)
+{
+    for (int i = 1, j = 0; i < METER_FFT_SIZE; i++)
+    {
+        int bit = METER_FFT_SIZE >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j |= bit;
+        if (i < j) { std::swap(re[i], re[j]); std::swap(im[i], im[j]); }
+    }
+
+    for (int len = 2; len <= METER_FFT_SIZE; len <<= 1)
+    {
+        int half = len >> 1;
+        int step = METER_FFT_SIZE / len;
+        for (int i = 0; i < METER_FFT_SIZE; i += len)
+        {
+            for (int j = 0; j < half; j++)
+            {
+                int32_t wr = _cos[j * step], wi = -_sin[j * step];
+                int a = i + j, b = a + half;
+                int32_t tr = (re[b] * wr - im[b] * wi) >> 15;
+                int32_t ti = (re[b] * wi + im[b] * wr) >> 15;
+                re[b] = (re[a] - tr) >> 1;
+                im[b] = (im[a] - ti) >> 1;
+                re[a] = (re[a] + tr) >> 1;
+                im[a] = (im[a] + ti) >> 1;
+            }
+        }
+    }
+}
+
+
+/**
+ * Copy the latest results if they are newer than seq
+ */
+bool AudioMeter::getLevels(AudioLevels &levels, uint32_t &seq)
+{
+    portENTER_CRITICAL(&_mux);
+    bool isNew = _levels.seq != seq;
+    if (isNew) levels = _levels;
+    portEXIT_CRITICAL(&_mux);
+    if (isNew) seq = levels.seq;
+    return isNew;
+}
+
+
+/**
+ * Number of lit segments for an amplitude (32767 = full scale)
+ * on a logarithmic scale covering dbRange decibels
+ */
+int AudioMeter::toSegments(uint32_t amplitude, int segments, int dbRange)
+{
+    if (amplitude == 0) return 0;
+    int e = 31 - __builtin_clz(amplitude);
+    int m = e >= 4 ? (amplitude >> (e-4)) & 15 : (amplitude << (4-e)) & 15;
+    int log2q4 = e * 16 + m;            // log2 in 1/16 octaves, 240 = full scale
+    int range = dbRange * 16 * 100 / 602;  // 6.02 dB per octave
+    int s = (log2q4 - (240 - range)) * segments / range;
+    return constrain(s, 0, segments);
+}
+
+
+uint32_t AudioMeter::usAnalyseLast()
+{
+    return _usAnalyseLast;
+}
+
+uint32_t AudioMeter::usAnalyseMax()
+{
+    return _usAnalyseMax;
+}
+
+uint32_t AudioMeter::analyses()
+{
+    return _analyses;
+}
+
+uint32_t AudioMeter::dropped()
+{
+    return _dropped;
+}
+
+void AudioMeter::printStats()
+{
+    uint32_t ms = millis();
+    uint32_t dt = ms - _msStats;
+    log_i("Meter: %u blocks (%u/s), analysis avg %u us, max %u us, dropped %u frames",
+          _analyses, dt ? _analyses * 1000 / dt : 0,
+          _analyses ? (uint32_t)(_usAnalyseSum / _analyses) : 0, _usAnalyseMax, (uint32_t)_dropped);
+}
+
+void AudioMeter::resetStats()
+{
+    _usAnalyseMax = 0;
+    _usAnalyseSum = 0;
+    _analyses = 0;
+    _dropped = 0;
+    _msStats = millis();
+}
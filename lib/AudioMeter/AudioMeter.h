@@ -0,0 +1,98 @@
+/**
+ * Header       AudioMeter.h
+ *
+ * Purpose      Declaration of the class AudioMeter, a pass-through stream
+ *              between the decoder and the volume control. It taps the
+ *              decoded PCM, decimates it into a lock-free ring and lets a
+ *              low-priority task compute
+ *              - peak and RMS level of both channels
+ *              - a spectrum of METER_BANDS logarithmic bands from a
+ *                fixed-point FFT of METER_FFT_SIZE samples
+ *              The decoder is never held up: when the ring is full, the
+ *              samples are dropped and counted. The analysis rate is
+ *              limited to METER_MAX_RATE blocks per second.
+ *
+ * Usage        AudioMeter meter(volume);
+ *              EncodedAudioStream dec(&meter, new MP3DecoderHelix());
+ *              meter.startAnalysis();
+ *              ...
+ *              AudioLevels lv;
+ *              if (meter.getLevels(lv, lastSeq)) { draw the bars }
+ */
+#pragma once
+#include <Arduino.h>
+#include <AudioTools.h>
+#include <atomic>
+
+const int METER_FFT_SIZE  = 256;   // samples per analysed block
+const int METER_FFT_BITS  = 8;     // log2(METER_FFT_SIZE)
+const int METER_DECIMATE  = 2;     // 44.1 kHz -> 22 kHz, spectrum up to 11 kHz
+const int METER_RING_LEN  = 1024;  // decimated stereo frames, power of 2
+const int METER_BANDS     = 24;    // spectrum bands
+const int METER_MAX_RATE  = 25;    // max analysed blocks per second
+
+struct AudioLevels
+{
+    uint16_t peak[2];               // 0..32767, left and right
+    uint16_t rms[2];
+    uint16_t band[METER_BANDS];     // amplitude of the bands, 0..32767
+    uint32_t seq;                   // incremented with every analysed block
+};
+
+class AudioMeter : public AudioStream
+{
+    public:
+        AudioMeter(AudioStream &out) : _out(out)
+        {}
+
+        size_t write(const uint8_t *data, size_t len) override;
+        int availableForWrite() override;
+        void setAudioInfo(AudioInfo info) override;
+
+        void startAnalysis(UBaseType_t priority=1, BaseType_t core=0);
+        bool getLevels(AudioLevels &levels, uint32_t &seq);
+        static int toSegments(uint32_t amplitude, int segments, int dbRange=48);
+
+        uint32_t usAnalyseLast();
+        uint32_t usAnalyseMax();
+        uint32_t analyses();
+        uint32_t dropped();
+        void     printStats();
+        void     resetStats();
+
+    private:
+        static void task(void *arg);
+        void run();
+        void analyse(uint32_t tail);
+        void fft(int16_t *re, int16_t *im);
+
+        AudioStream &_out;
+        AudioInfo   _info;
+        TaskHandle_t _task = nullptr;
+
+        // decimation state of the audio path
+        int32_t _sum[2] = { 0, 0 };
+        int     _nSum = 0;
+
+        // single producer (audio path), single consumer (analysis task)
+        int16_t _ring[METER_RING_LEN][2];
+        std::atomic<uint32_t> _head{0};
+        std::atomic<uint32_t> _tail{0};
+
+        int16_t  _window[METER_FFT_SIZE];       // Hann window, Q15
+        int16_t  _cos[METER_FFT_SIZE/2];        // twiddle factors, Q15
+        int16_t  _sin[METER_FFT_SIZE/2];
+        uint8_t  _bandEdge[METER_BANDS+1];      // first bin of each band
+        int16_t  _re[METER_FFT_SIZE];
+        int16_t  _im[METER_FFT_SIZE];
+
+        portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+        AudioLevels  _levels = {};
+
+        uint32_t _usAnalyseLast = 0;
+        uint32_t _usAnalyseMax = 0;
+        uint64_t _usAnalyseSum = 0;
+        uint32_t _analyses = 0;
+        uint32_t _msStats = 0;
+        std::atomic<uint32_t> _dropped{0};
+};
@@ -26,9 +26,10 @@
  *              https://github.com/aliffathoni/ESPAutoWifi             
  */
 #include "ESP32AutoConnect.h"
-#include "query.h"
+#include "WebAssets.h"
+#include "Renderer.h"
 
-extern LGFX lcd;
+extern Renderer renderer;
 
 const bool RW_MODE = false;
 const bool RO_MODE = true;
@@ -72,23 +73,17 @@ bool ESP32AutoConnect::weAreConnectedToWLAN(String ssid, String password)
 
 
 /**
- * Look for available networks and compose the 
- * option list for the query web page
+ * Template field {{networks}} of the query web page, one option
+ * per network found by the last scan:
+ * <option value="0">Dodeka2G4</option>
  */
-String ESP32AutoConnect::composeNetworkList()
+int ESP32AutoConnect::fillNetworks(const char *key, int part, char *buf, int size, void *arg)
 {
-  String networks = "";
-  int n = WiFi.scanNetworks();
-  for (int i = 0; i <n; i++)
-  {
-    // <option value="0">Dodeka2G4</option>
-    char buf[64];
-    snprintf(buf, sizeof(buf), "<option value=\"%d\">%s</option>", i, WiFi.SSID(i).c_str()); 
-    networks += String(buf);
-  }
-  //log_i("%s", networks.c_str());
-  return networks;
-} 
+  char ssid[3 * 33];
+  if (strcmp(key, "networks") != 0 || part >= WiFi.scanComplete()) return -1;
+  htmlEscape(WiFi.SSID(part).c_str(), ssid, sizeof(ssid));
+  return snprintf(buf, size, "<option value=\"%d\">%s</option>", part, ssid);
+}
 
 
 /**
@@ -101,17 +96,17 @@ void ESP32AutoConnect::requestCredentialsAndRestart()
   String& hn = _hostname;
   WiFi.disconnect();
   WiFi.softAP(_apSSID.c_str(), NULL);
-  lcd.printf("Connect your mobile phone to\n%s, call the url\nhttp://%s in a browser,\nthen select your WLAN and\nenter the password.", _apSSID.c_str(), WiFi.softAPIP().toString().c_str());
+  renderer.printf("Connect your mobile phone to\n%s, call the url\nhttp://%s in a browser,\n", _apSSID.c_str(), WiFi.softAPIP().toString().c_str());
+  renderer.printf("then select your WLAN and\nenter the password.");
 
-  String networks = composeNetworkList();
-  String query = query0;
-  query.replace("{n}", networks); // insert available networks into query web page
+  log_i("%d networks found", WiFi.scanNetworks());
+  const WebAsset *query = findWebAsset("/query");
 
   _server.on("/", 
             HTTP_GET, 
             [query](AsyncWebServerRequest *request)
               {
-                request->send(200, "text/html", query.c_str());
+                sendTemplate(request, *query, fillNetworks, nullptr); // the networks are inserted while sending
               });
 
   _server.on("/get",
@@ -161,13 +156,13 @@ void ESP32AutoConnect::autoConnect()
   {
     if (weAreConnectedToWLAN(_ssid, _password))
     {
-      lcd.printf("\nConnected to your WLAN\n%s\n as host\n%s", WiFi.SSID(), WiFi.getHostname());
+      renderer.printf("\nConnected to your WLAN\n%s\n as host\n%s", WiFi.SSID(), WiFi.getHostname());
       notConnected = false;
       vTaskDelay(pdMS_TO_TICKS(2000));
     }
     else
     {
-      lcd.printf("\nCould not connect to the stored WLAN %s, try again or select another network.", _ssid.c_str());
+      renderer.printf("\nCould not connect to the stored WLAN %s, try again or select another network.", _ssid.c_str());
       requestCredentialsAndRestart();
     }
   }
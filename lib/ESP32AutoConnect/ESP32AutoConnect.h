@@ -28,7 +28,7 @@ class ESP32AutoConnect
         bool credentialsAreAvailable();
         bool weAreConnectedToWLAN(String ssid, String password);
         void requestCredentialsAndRestart();
-        String composeNetworkList();
+        static int fillNetworks(const char *key, int part, char *buf, int size, void *arg);
         String _apSSID = "AutoConnectAP";
         String _apPassword;
         String _ssid;
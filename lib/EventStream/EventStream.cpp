@@ -0,0 +1,144 @@
+/**
+ * Class        Implementation of the class methods of EventStream
+ *
+ * Purpose      One frame per interval for all clients, built on the loop
+ *              task from the published status and the sampled telemetry.
+ *
+ * Remarks      AsyncEventSource::send() formats the event once and queues
+ *              the same message for every client.
+ */
+#include "EventStream.h"
+
+
+void EventStream::begin(AsyncWebServer &server)
+{
+    _events.onConnect([this](AsyncEventSourceClient *client) { _connected = true; });
+    server.addHandler(&_events);
+    log_i("==> done");
+}
+
+
+/**
+ * Called by loop(), samples the telemetry and sends a frame
+ * once per interval if there is anything to send
+ */
+void EventStream::update(uint32_t ms)
+{
+    if (_events.count() == 0)
+    {
+        _samples = 0;
+        return;
+    }
+    if (ms - _msSample >= SSE_SAMPLE_MS)
+    {
+        _msSample = ms;
+        sample();
+    }
+    if (ms - _msFrame >= SSE_INTERVAL_MS)
+    {
+        _msFrame = ms;
+        sendFrame();
+    }
+}
+
+
+int EventStream::clients()
+{
+    return _events.count();
+}
+
+
+void EventStream::sample()
+{
+    _telemetry(_last);
+    if (_samples == SSE_BATCH) return;
+    _buffered[_samples] = _last.buffered;
+    _peak[_samples] = _last.peak;
+    _samples++;
+}
+
+
+/**
+ * Write the changed status and the telemetry batch into one event
+ */
+void EventStream::sendFrame()
+{
+    uint32_t t0 = micros();
+    PlayerStatus s;
+    uint32_t version = _api.version();
+    bool connected = _connected.exchange(false);
+    bool changed = version != _version || connected;
+    bool backedUp = _events.avgPacketsWaiting() >= SSE_MAX_WAITING;
+
+    if (backedUp && _samples > 0) _dropped++;
+    if (backedUp) _samples = 0;
+    if (!changed && _samples == 0) return;
+    if (changed && !_api.readStatus(s))             // publishing right now, next frame
+    {
+        if (connected) _connected = true;
+        return;
+    }
+
+    _json.clear();
+    _json.beginObject();
+    if (changed)
+    {
+        _json.beginObject("status")
+             .add("station", (int)s.station)
+             .add("name", s.name)
+             .add("volume", s.volume / 1000.0f)
+             .add("title", s.title)
+             .add("recording", s.recording)
+             .add("podcast", s.podcast)
+             .add("position", (int)s.position)
+             .add("duration", (int)s.duration)
+             .endObject();
+        _changes += (version - _version) / 2;
+        _version = version;
+        _statusFrames++;
+    }
+    if (_samples > 0)
+    {
+        _json.beginObject("telemetry").beginArray("buffered");
+        for (int i = 0; i < _samples; i++) _json.add(nullptr, (int)_buffered[i]);
+        _json.endArray().beginArray("peak");
+        for (int i = 0; i < _samples; i++) _json.add(nullptr, (int)_peak[i]);
+        _json.endArray()
+             .add("rssi", (int)_last.rssi)
+             .add("underruns", _last.underruns)
+             .endObject();
+        _samples = 0;
+    }
+    _json.endObject();
+
+    if (!_json.ok())
+    {
+        log_e("Frame does not fit into %d bytes", SSE_FRAME_SIZE);
+        return;
+    }
+    _events.send(_json.c_str(), "update", ++_id);
+    _frames++;
+    _bytes += _json.length();
+    uint32_t us = micros() - t0;
+    if (us > _usFrameMax) _usFrameMax = us;
+}
+
+
+void EventStream::printStats()
+{
+    if (_frames == 0 && _events.count() == 0) return;
+    log_i("Events: %d clients, %u frames (%u with status), %u bytes, %u status changes, "
+          "%u telemetry batches dropped, frame max %u us",
+          clients(), _frames, _statusFrames, _bytes, _changes, _dropped, _usFrameMax);
+}
+
+
+void EventStream::resetStats()
+{
+    _frames = 0;
+    _statusFrames = 0;
+    _bytes = 0;
+    _changes = 0;
+    _dropped = 0;
+    _usFrameMax = 0;
+}
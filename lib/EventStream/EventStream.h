@@ -0,0 +1,94 @@
+/**
+ * Header       EventStream.h
+ *
+ * Purpose      Declaration of the class EventStream, which pushes the state
+ *              of the radio to dashboards as Server-Sent Events instead of
+ *              letting them poll /api/status.
+ *              - Station, volume and title are taken from the status the
+ *                player publishes for the RestApi. All changes within an
+ *                interval, e.g. a station change followed by its first
+ *                title, go out as one frame.
+ *              - Telemetry (receive buffer fill, peak level) is sampled
+ *                every SSE_SAMPLE_MS and sent as a batch with the RSSI
+ *                and the number of audio underruns.
+ *              - One event "update" per SSE_INTERVAL_MS at most, written
+ *                once and shared by all clients. New clients get the full
+ *                status with the next frame.
+ *              - While the clients are backed up, telemetry is dropped,
+ *                status changes are kept for the next frame.
+ *              Frames, bytes and coalesced changes are logged.
+ *
+ * Usage        EventStream events(api, readTelemetry);
+ *              events.begin(server);       // new EventSource("/api/events")
+ *              loop() { events.update(millis()); }
+ *
+ * Remarks      Frame: {"status":{"station":5,"name":..,"volume":0.33,"title":..},
+ *                      "telemetry":{"buffered":[..],"peak":[..],"rssi":-61,"underruns":0}}
+ *              status only when it changed or a client connected.
+ */
+#pragma once
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <atomic>
+#include "RestApi.h"
+#include "JsonWriter.h"
+
+const uint32_t SSE_INTERVAL_MS = 1000;  // at most one frame per interval
+const uint32_t SSE_SAMPLE_MS   = 250;   // telemetry sample period
+const int      SSE_BATCH       = 8;     // max samples per frame
+const int      SSE_FRAME_SIZE  = 768;
+const int      SSE_MAX_WAITING = 4;     // average queued frames per client before telemetry is dropped
+
+struct Telemetry
+{
+    int32_t  buffered;      // bytes in the receive buffer of the stream
+    uint16_t peak;          // 0..32767
+    int8_t   rssi;          // dBm
+    uint32_t underruns;     // copies without data since start
+};
+
+// Fills in the telemetry, called on the loop task
+using TelemetryFn = void(*)(Telemetry &t);
+
+class EventStream
+{
+    public:
+        EventStream(RestApi &api, TelemetryFn telemetry) : _api(api), _telemetry(telemetry)
+        {}
+
+        void begin(AsyncWebServer &server);
+        void update(uint32_t ms);
+        int  clients();
+
+        void printStats();
+        void resetStats();
+
+    private:
+        void sample();
+        void sendFrame();
+
+        RestApi    &_api;
+        TelemetryFn _telemetry;
+        AsyncEventSource _events{"/api/events"};
+        std::atomic<bool> _connected{false};    // a client connected since the last frame
+
+        uint32_t _msFrame = 0;
+        uint32_t _msSample = 0;
+        uint32_t _version = 0;          // of the status sent last
+        uint32_t _id = 0;
+
+        Telemetry _last = {};
+        int32_t  _buffered[SSE_BATCH];
+        uint16_t _peak[SSE_BATCH];
+        int      _samples = 0;
+
+        char _buf[SSE_FRAME_SIZE];
+        JsonWriter _json{_buf, sizeof(_buf)};
+
+        uint32_t _frames = 0;
+        uint32_t _bytes = 0;
+        uint32_t _changes = 0;          // status changes, several per frame are coalesced
+        uint32_t _statusFrames = 0;
+        uint32_t _dropped = 0;          // telemetry batches dropped for slow clients
+        uint32_t _usFrameMax = 0;
+};
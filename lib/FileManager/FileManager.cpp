@@ -0,0 +1,427 @@
+/**
+ * Class        Implementation of the class methods of FileManager
+ *
+ * Purpose      Serve the files of the SD card without a buffer of their
+ *              own: the response fillers read straight into the TCP send
+ *              buffer of the async web server.
+ *
+ * Remarks      The handlers and fillers run on the async TCP task. The
+ *              state of a transfer is shared with its filler and released
+ *              with the response, also when the client goes away, so the
+ *              file is closed in every case.
+ *              Paths with ".." are rejected.
+ */
+#include "FileManager.h"
+#include "JsonWriter.h"
+#include <memory>
+
+enum class TransferKind : uint8_t { None, Download, Listing };
+
+// A download or listing in progress, lives as long as its response
+struct FileTransfer
+{
+    FileTransfer(FileManager *owner, SpiArbiter *bus) : owner(owner), bus(bus)
+    {}
+    ~FileTransfer()
+    { owner->finish(*this); }
+
+    FileManager *owner;
+    SpiArbiter *bus;
+    TransferKind kind = TransferKind::None;
+    File     file;
+    char     path[FILES_PATH_LEN];
+    uint32_t length = 0;            // bytes of the download
+    uint32_t remaining = 0;
+    uint32_t bytes = 0;
+    uint32_t msStart = 0;
+    char     pending[FILES_ENTRY_SIZE];     // listing text not yet sent
+    int      pendingLen = 0;
+    int      pendingPos = 0;
+    int      entries = 0;
+    bool     done = false;
+};
+
+struct ContentType
+{
+    const char *ext;
+    const char *type;
+};
+
+static const ContentType contentTypes[] =
+{
+    { ".png",  "image/png" },
+    { ".bmp",  "image/bmp" },
+    { ".jpg",  "image/jpeg" },
+    { ".mp3",  "audio/mpeg" },
+    { ".aac",  "audio/aac" },
+    { ".txt",  "text/plain" },
+    { ".json", "application/json" },
+    { ".htm",  "text/html" },
+    { ".html", "text/html" },
+};
+
+
+static const char *contentType(const char *path)
+{
+    const char *ext = strrchr(path, '.');
+    if (ext)
+    {
+        for (const ContentType &c : contentTypes)
+        {
+            if (strcasecmp(ext, c.ext) == 0) return c.type;
+        }
+    }
+    return "application/octet-stream";
+}
+
+
+/**
+ * Parse "bytes=a-b", "bytes=a-" or "bytes=-n". Returns 1 for a range,
+ * 0 to send the whole file (no, several or invalid ranges) and -1 if
+ * the range lies beyond the end of the file.
+ */
+static int parseRange(const char *s, uint32_t size, uint32_t &first, uint32_t &last)
+{
+    char *end;
+    if (strncmp(s, "bytes=", 6) != 0 || strchr(s, ',')) return 0;
+    s += 6;
+    if (*s == '-')
+    {
+        uint32_t n = strtoul(s + 1, &end, 10);
+        if (end == s + 1) return 0;
+        if (n == 0 || size == 0) return -1;
+        first = n >= size ? 0 : size - n;
+        last = size - 1;
+        return 1;
+    }
+    first = strtoul(s, &end, 10);
+    if (end == s || *end != '-') return 0;
+    s = end + 1;
+    last = size - 1;
+    if (*s)
+    {
+        uint32_t l = strtoul(s, &end, 10);
+        if (end == s || l < first) return 0;
+        if (l < last) last = l;
+    }
+    if (first >= size) return -1;
+    return 1;
+}
+
+
+void FileManager::begin(AsyncWebServer &server)
+{
+    server.on("/api/files", HTTP_GET, [this](AsyncWebServerRequest *request) { handleList(request); });
+    server.on("/api/file", HTTP_GET, [this](AsyncWebServerRequest *request) { handleDownload(request); });
+    server.on("/api/file", HTTP_DELETE, [this](AsyncWebServerRequest *request) { handleDelete(request); });
+    log_i("==> done");
+}
+
+
+void FileManager::setBus(SpiArbiter &bus)
+{
+    _bus = &bus;
+}
+
+void FileManager::setBusyCheck(FileBusyFn isBusy)
+{
+    _isBusy = isBusy;
+}
+
+
+/**
+ * Copy the parameter name into path, answer 400 if it is missing,
+ * too long, relative or leads out of a directory
+ */
+bool FileManager::getPath(AsyncWebServerRequest *request, const char *name, char *path)
+{
+    if (!request->hasParam(name))
+    {
+        if (strcmp(name, "dir") != 0)
+        {
+            request->send(400, "text/plain", "Missing path");
+            return false;
+        }
+        strcpy(path, "/");
+        return true;
+    }
+    const String &value = request->getParam(name)->value();
+    if (value.length() == 0 || value.length() >= FILES_PATH_LEN || value[0] != '/' || value.indexOf("..") >= 0)
+    {
+        request->send(400, "text/plain", "Invalid path");
+        return false;
+    }
+    strcpy(path, value.c_str());
+    return true;
+}
+
+
+/**
+ * Reserve a transfer, answer 503 if all are taken
+ */
+bool FileManager::reserve(AsyncWebServerRequest *request)
+{
+    if (++_transfers > FILES_MAX_TRANSFERS)
+    {
+        _transfers--;
+        _busy++;
+        request->send(503, "text/plain", "Too many transfers");
+        return false;
+    }
+    return true;
+}
+
+
+void FileManager::handleDownload(AsyncWebServerRequest *request)
+{
+    char path[FILES_PATH_LEN];
+    if (!getPath(request, "path", path) || !reserve(request)) return;
+
+    auto t = std::make_shared<FileTransfer>(this, _bus);   // closes the file when the last copy is gone
+    strcpy(t->path, path);
+    uint32_t size = 0;
+    bool found;
+    {
+        SpiLease lease(_bus, SpiClient::Sd);             // not while sending, the filler takes it
+        t->file = _fs.open(path, FILE_READ);
+        found = t->file && !t->file.isDirectory();
+        if (found) size = t->file.size();
+    }
+    if (!found)
+    {
+        request->send(404, "text/plain", "Not found");
+        return;
+    }
+
+    uint32_t first = 0, last = size - 1;
+    int range = request->hasHeader("Range") ? parseRange(request->getHeader("Range")->value().c_str(), size, first, last) : 0;
+    if (range < 0)
+    {
+        char contentRange[32];
+        snprintf(contentRange, sizeof(contentRange), "bytes */%u", size);
+        AsyncWebServerResponse *response = request->beginResponse(416, "text/plain", "Range not satisfiable");
+        response->addHeader("Content-Range", contentRange);
+        request->send(response);
+        return;
+    }
+    if (range == 0) first = 0;
+    t->length = range ? last - first + 1 : size;
+    t->remaining = t->length;
+    if (first > 0)
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        found = t->file.seek(first);
+    }
+    if (!found)
+    {
+        request->send(500, "text/plain", "Seek failed");
+        return;
+    }
+    t->kind = TransferKind::Download;
+    t->msStart = millis();
+
+    AsyncWebServerResponse *response = request->beginResponse(contentType(path), t->length,
+        [t](uint8_t *buf, size_t maxLen, size_t index) -> size_t
+        {
+            SpiLease lease(t->bus, SpiClient::Sd);
+            size_t n = t->file.read(buf, min(maxLen, (size_t)t->remaining));
+            t->remaining -= n;
+            t->bytes += n;
+            return n;
+        });
+    if (range)
+    {
+        char contentRange[48];
+        snprintf(contentRange, sizeof(contentRange), "bytes %u-%u/%u", first, last, size);
+        response->setCode(206);
+        response->addHeader("Content-Range", contentRange);
+    }
+    char disposition[FILES_PATH_LEN + 24];
+    const char *name = strrchr(path, '/') + 1;
+    snprintf(disposition, sizeof(disposition), "inline; filename=\"%s\"", name);
+    response->addHeader("Content-Disposition", disposition);
+    response->addHeader("Accept-Ranges", "bytes");
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
+
+
+/**
+ * Hand out the pending text, then format the next entry,
+ * at the end close the array and the object
+ */
+static size_t fillListing(FileTransfer &t, uint8_t *buf, size_t maxLen)
+{
+    size_t n = 0;
+    while (n < maxLen)
+    {
+        if (t.pendingPos < t.pendingLen)
+        {
+            size_t k = min(maxLen - n, (size_t)(t.pendingLen - t.pendingPos));
+            memcpy(buf + n, t.pending + t.pendingPos, k);
+            t.pendingPos += k;
+            n += k;
+            continue;
+        }
+        if (t.done) break;
+
+        t.pendingPos = 0;
+        t.pendingLen = 0;
+        SpiLease lease(t.bus, SpiClient::Sd);
+        File entry = t.file.openNextFile();
+        if (!entry)
+        {
+            t.pendingLen = snprintf(t.pending, sizeof(t.pending), "],\"count\":%d}", t.entries);
+            t.done = true;
+            continue;
+        }
+        char *p = t.pending;
+        if (t.entries > 0) *p++ = ',';
+        JsonWriter json(p, sizeof(t.pending) - 1);
+        json.beginObject()
+            .addUtf8("name", entry.name())
+            .add("size", (uint32_t)entry.size())
+            .add("dir", entry.isDirectory())
+            .add("time", (uint32_t)entry.getLastWrite())
+            .endObject();
+        entry.close();
+        if (!json.ok())
+        {
+            log_w("Name too long, entry skipped");
+            continue;
+        }
+        t.pendingLen = p - t.pending + json.length();
+        t.entries++;
+    }
+    t.bytes += n;
+    return n;
+}
+
+
+void FileManager::handleList(AsyncWebServerRequest *request)
+{
+    char path[FILES_PATH_LEN];
+    if (!getPath(request, "dir", path) || !reserve(request)) return;
+
+    auto t = std::make_shared<FileTransfer>(this, _bus);
+    strcpy(t->path, path);
+    bool found;
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        t->file = _fs.open(path);
+        found = t->file && t->file.isDirectory();
+    }
+    if (!found)
+    {
+        request->send(404, "text/plain", "Not found");
+        return;
+    }
+    JsonWriter json(t->pending, sizeof(t->pending));
+    json.beginObject().addUtf8("dir", path).beginArray("files");
+    t->pendingLen = json.length();
+    t->kind = TransferKind::Listing;
+    t->msStart = millis();
+
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+        [t](uint8_t *buf, size_t maxLen, size_t index) -> size_t { return fillListing(*t, buf, maxLen); });
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+
+void FileManager::handleDelete(AsyncWebServerRequest *request)
+{
+    char path[FILES_PATH_LEN];
+    if (!getPath(request, "path", path)) return;
+    if (_isBusy && _isBusy(path))
+    {
+        request->send(409, "text/plain", "File in use");
+        return;
+    }
+
+    bool ok = false;
+    bool found;
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        found = _fs.exists(path);
+        if (found)
+        {
+            File file = _fs.open(path);
+            bool dir = file && file.isDirectory();
+            file.close();
+            ok = dir ? _fs.rmdir(path) : _fs.remove(path);
+        }
+    }
+
+    if (!found) request->send(404, "text/plain", "Not found");
+    else if (!ok) request->send(409, "text/plain", "Not deleted");
+    else
+    {
+        _deletes++;
+        log_i("Deleted %s", path);
+        request->send(204);
+    }
+}
+
+
+/**
+ * Called when the response is gone: close the file,
+ * free the transfer and log the throughput
+ */
+void FileManager::finish(FileTransfer &t)
+{
+    if (t.file)
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        t.file.close();
+    }
+    _transfers--;
+    uint32_t ms = millis() - t.msStart;
+
+    if (t.kind == TransferKind::Download)
+    {
+        uint32_t kbps = ms ? t.bytes / ms : 0;     // bytes per ms are KB/s
+        _bytes += t.bytes;
+        if (t.remaining > 0)
+        {
+            _aborted++;
+            log_w("Download %s aborted after %u of %u bytes", t.path, t.bytes, t.length);
+            return;
+        }
+        _downloads++;
+        _kbpsLast = kbps;
+        if (kbps > _kbpsMax) _kbpsMax = kbps;
+        log_i("Download %s: %u bytes in %u ms (%u KB/s)", t.path, t.bytes, ms, kbps);
+    }
+    else if (t.kind == TransferKind::Listing)
+    {
+        _lists++;
+        log_i("Listing %s: %d entries, %u bytes in %u ms", t.path, t.entries, t.bytes, ms);
+    }
+}
+
+
+uint32_t FileManager::kbpsLast()
+{
+    return _kbpsLast;
+}
+
+
+void FileManager::printStats()
+{
+    if (_downloads == 0 && _aborted == 0 && _lists == 0 && _deletes == 0 && _busy == 0) return;
+    log_i("Files: %u downloads (%u aborted), %u bytes, last %u KB/s, max %u KB/s, %u listings, %u deleted, %u busy",
+          _downloads, _aborted, _bytes, _kbpsLast, _kbpsMax, _lists, _deletes, _busy);
+}
+
+
+void FileManager::resetStats()
+{
+    _downloads = 0;
+    _aborted = 0;
+    _bytes = 0;
+    _kbpsMax = 0;
+    _lists = 0;
+    _deletes = 0;
+    _busy = 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * Header       FileManager.h
+ *
+ * Purpose      Declaration of the class FileManager, HTTP endpoints for the
+ *              files on the SD card.
+ *              GET    /api/files?dir=/Screenshots   list of a directory
+ *              GET    /api/file?path=/x.png         download, with Range
+ *              DELETE /api/file?path=/x.png         delete a file or an
+ *                                                   empty directory
+ *              - Files that are open for writing, e.g. a recording, are
+ *                reported by the busy check of the owner and not deleted
+ *                (409). FatFs has no file locking in the Arduino build,
+ *                removing an open file corrupts the FAT.
+ *              - Downloads are read from the card directly into the TCP
+ *                send buffer, as much as it takes at once. There is no
+ *                copy in between and no buffer of its own.
+ *              - Range: bytes=a-b, a- and -n are answered with 206 and
+ *                a Content-Range, so browsers and players can resume and
+ *                seek.
+ *              - Listings are streamed entry by entry as JSON, the size
+ *                of a directory does not matter.
+ *              The SD card shares the bus with the touch controller. With
+ *              setBus() every access to the card holds the bus, a block
+ *              or an entry at a time, the touch stays live during long
+ *              downloads. Size, time and throughput of each download are
+ *              logged.
+ *
+ * Usage        FileManager files(SD);
+ *              files.setBus(vspi);
+ *              files.setBusyCheck([](const char *path) { return recorder.isWriting(path); });
+ *              files.begin(server);
+ *              server.begin();
+ */
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+#include <ESPAsyncWebServer.h>
+#include <atomic>
+#include "SpiArbiter.h"
+
+const int FILES_PATH_LEN      = 64;
+const int FILES_ENTRY_SIZE    = 160;    // one entry of a listing as JSON
+const int FILES_MAX_TRANSFERS = 2;      // downloads and listings at the same time
+
+struct FileTransfer;
+
+// True if the file is open for writing and must not be deleted
+using FileBusyFn = bool(*)(const char *path);
+
+class FileManager
+{
+    public:
+        FileManager(fs::FS &fs) : _fs(fs)
+        {}
+
+        void begin(AsyncWebServer &server);
+        void setBus(SpiArbiter &bus);
+        void setBusyCheck(FileBusyFn isBusy);
+
+        uint32_t kbpsLast();
+        void printStats();
+        void resetStats();
+
+    private:
+        friend struct FileTransfer;
+
+        void handleList(AsyncWebServerRequest *request);
+        void handleDownload(AsyncWebServerRequest *request);
+        void handleDelete(AsyncWebServerRequest *request);
+        bool getPath(AsyncWebServerRequest *request, const char *name, char *path);
+        bool reserve(AsyncWebServerRequest *request);
+        void finish(FileTransfer &t);
+
+        fs::FS &_fs;
+        SpiArbiter *_bus = nullptr;
+        FileBusyFn _isBusy = nullptr;
+        std::atomic<int> _transfers{0};
+
+        uint32_t _downloads = 0;
+        uint32_t _aborted = 0;
+        uint32_t _bytes = 0;
+        uint32_t _kbpsLast = 0;
+        uint32_t _kbpsMax = 0;
+        uint32_t _lists = 0;
+        uint32_t _deletes = 0;
+        uint32_t _busy = 0;
+};
@@ -0,0 +1,640 @@
+/**
+ * Class        Implementation of the class methods of HlsStream
+ *
+ * Purpose      The task runs a session from begin() to end(): reload the
+ *              playlist when it is due, else fetch the next segment. The
+ *              ring between the task and loop() is the only shared data.
+ *
+ * Remarks      Every request is a new connection, HTTP/1.0 like the
+ *              podcasts; with https the handshake counts in the fetch
+ *              time. The PSI tables are expected in one TS packet, which
+ *              is the case for all audio streams. Encrypted segments
+ *              (EXT-X-KEY) and fMP4 segments are not supported.
+ */
+#include "HlsStream.h"
+
+static_assert((HLS_RING_SIZE & (HLS_RING_SIZE - 1)) == 0, "HLS_RING_SIZE must be a power of two");
+
+
+void HlsStream::startFetcher(UBaseType_t priority, BaseType_t core)
+{
+    xTaskCreatePinnedToCore(task, "hls", 8192, this, priority, &_task, core);
+    log_i("==> done");
+}
+
+
+/**
+ * Start a session and wait until the first segment tells the codec
+ */
+bool HlsStream::begin(const char *url)
+{
+    end();
+    if (_task == nullptr) return false;
+    if (_ring == nullptr) _ring = static_cast<uint8_t *>(malloc(HLS_RING_SIZE));
+    if (_ring == nullptr)
+    {
+        log_e("No memory for %d bytes", HLS_RING_SIZE);
+        return false;
+    }
+    _head = 0;
+    _tail = 0;
+    _discPending = false;
+    _discReached = false;
+    _empty = false;
+    _codec = HlsCodec::Unknown;
+    strlcpy(_playlist, url, sizeof(_playlist));
+    _busy = true;
+    _active = true;
+    xTaskNotifyGive(_task);
+
+    uint32_t t0 = millis();
+    while (_codec == HlsCodec::Unknown && _busy && millis() - t0 < HLS_BEGIN_TIMEOUT) delay(10);
+    if (_codec == HlsCodec::Unknown)
+    {
+        log_e("No audio from %s", url);
+        end();
+        return false;
+    }
+    log_i("HLS %s: %s after %u ms", _playlist, _codec == HlsCodec::Aac ? "AAC" : "MP3", millis() - t0);
+    return true;
+}
+
+
+// Stop the session, waits until the task has closed its connection
+void HlsStream::end()
+{
+    _active = false;
+    while (_busy) delay(5);
+    free(_ring);
+    _ring = nullptr;
+}
+
+
+void HlsStream::task(void *arg)
+{
+    static_cast<HlsStream *>(arg)->run();
+}
+
+
+void HlsStream::run()
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (_active) session();
+        _busy = false;
+    }
+}
+
+
+/**
+ * Reload the playlist every target duration, half of it when no
+ * segment is left, at once for a VOD playlist that had more
+ */
+void HlsStream::session()
+{
+    _loaded = false;
+    _ended = false;
+    _qHead = _qCount = 0;
+    _anyQueued = false;
+    _msTarget = 6000;
+    _msReload = millis();
+    while (_active)
+    {
+        uint32_t wait = _ended ? 0 : _qCount > 0 ? _msTarget : _msTarget / 2;
+        bool due = (!_ended || _more) && _qCount < HLS_SEGMENTS && millis() - _msReload >= wait;
+        if (!_loaded || due)
+        {
+            if (!loadPlaylist())
+            {
+                _failures++;
+                if (!_loaded) break;
+            }
+        }
+        if (_qCount > 0)
+        {
+            fetchSegment(_queue[_qHead]);
+            _qHead = (_qHead + 1) % HLS_SEGMENTS;
+            _qCount--;
+            continue;
+        }
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+    _http.end();
+}
+
+
+/**
+ * Read the playlist line by line. A master playlist is followed
+ * to the variant selected, which must be a media playlist.
+ */
+bool HlsStream::loadPlaylist()
+{
+    uint32_t t0 = millis();
+    _msReload = t0;
+    for (int level = 0; level < 2; level++)
+    {
+        int code = httpOpen(_http, _plain, _secure, _playlist, sizeof(_playlist));
+        if (code != 200)
+        {
+            log_e("HTTP %d for %s", code, _playlist);
+            _http.end();
+            return false;
+        }
+        WiFiClient *stream = _http.getStreamPtr();
+        uint8_t buf[256];
+        uint32_t msData = millis();
+        _lineLen = 0;
+        _master = false;
+        _variant[0] = '\0';
+        _variantBandwidth = 0;
+        _mediaSeq = 0;
+        _msExtinf = 0;
+        _disc = false;
+        _more = false;
+        _droppedFirst = false;
+        while (_active && millis() - msData < PODCAST_TIMEOUT)
+        {
+            int n = stream->available();
+            if (n <= 0)
+            {
+                if (!stream->connected()) break;
+                delay(1);
+                continue;
+            }
+            n = stream->read(buf, min(n, (int)sizeof(buf)));
+            for (int i = 0; i < n; i++)
+            {
+                char c = buf[i];
+                if (c == '\n')
+                {
+                    _line[_lineLen] = '\0';
+                    parseLine(_line);
+                    _lineLen = 0;
+                }
+                else if (c != '\r' && _lineLen < HLS_LINE_LEN - 1) _line[_lineLen++] = c;
+            }
+            msData = millis();
+        }
+        _line[_lineLen] = '\0';
+        parseLine(_line);
+        _http.end();
+        if (!_master) break;
+        if (_variant[0] == '\0' || level > 0) return false;
+        log_i("Variant with %u bit/s: %s", _variantBandwidth, _variant);
+        strlcpy(_playlist, _variant, sizeof(_playlist));
+    }
+
+    if (!_loaded && _ended && _droppedFirst)    // no live stream, start at the first segment
+    {
+        _qCount = 0;
+        _anyQueued = false;
+        _more = true;
+    }
+    else if (!_loaded && !_ended)
+    {
+        for (; _qCount > HLS_LIVE_SEGMENTS; _qCount--) _qHead = (_qHead + 1) % HLS_SEGMENTS;
+    }
+    _loaded = true;
+    uint32_t ms = millis() - t0;
+    if (ms > _msReloadMax) _msReloadMax = ms;
+    _reloads++;
+    return true;
+}
+
+
+/**
+ * The tags needed to play, the others are ignored
+ */
+void HlsStream::parseLine(char *line)
+{
+    if (line[0] == '\0') return;
+    if (line[0] != '#')
+    {
+        if (!_master)
+        {
+            enqueue(line);
+            return;
+        }
+        uint32_t bw = _streamInfBandwidth;
+        bool better = _variant[0] == '\0'
+                   || (bw <= HLS_MAX_BANDWIDTH && (bw > _variantBandwidth || _variantBandwidth > HLS_MAX_BANDWIDTH))
+                   || (_variantBandwidth > HLS_MAX_BANDWIDTH && bw < _variantBandwidth);
+        if (better)
+        {
+            resolve(line, _variant);
+            _variantBandwidth = bw;
+        }
+        return;
+    }
+    if (strncmp(line, "#EXTINF:", 8) == 0) _msExtinf = atof(line + 8) * 1000;
+    else if (strncmp(line, "#EXT-X-TARGETDURATION:", 22) == 0) _msTarget = max(atoi(line + 22), 1) * 1000;
+    else if (strncmp(line, "#EXT-X-MEDIA-SEQUENCE:", 22) == 0) _mediaSeq = strtoul(line + 22, nullptr, 10);
+    else if (strcmp(line, "#EXT-X-DISCONTINUITY") == 0) _disc = true;
+    else if (strcmp(line, "#EXT-X-ENDLIST") == 0) _ended = true;
+    else if (strncmp(line, "#EXT-X-KEY:", 11) == 0 && !strstr(line, "METHOD=NONE")) log_w("Encrypted segments are not supported");
+    else if (strncmp(line, "#EXT-X-STREAM-INF:", 18) == 0)
+    {
+        _master = true;
+        _streamInfBandwidth = 0;
+        for (const char *p = strstr(line, "BANDWIDTH="); p; p = strstr(p + 1, "BANDWIDTH="))
+        {
+            if (p[-1] == ':' || p[-1] == ',') _streamInfBandwidth = strtoul(p + 10, nullptr, 10);    // not AVERAGE-BANDWIDTH
+        }
+    }
+}
+
+
+/**
+ * Make a URI of the playlist absolute
+ */
+void HlsStream::resolve(const char *uri, char *out)
+{
+    if (strncmp(uri, "http://", 7) == 0 || strncmp(uri, "https://", 8) == 0)
+    {
+        strlcpy(out, uri, HLS_URL_LEN);
+        return;
+    }
+    const char *host = strstr(_playlist, "//");
+    host = host ? host + 2 : _playlist;
+    const char *path = strchr(host, '/');
+    int base;
+    if (uri[0] == '/') base = path ? path - _playlist : strlen(_playlist);
+    else
+    {
+        const char *query = strchr(host, '?');
+        int end = query ? query - _playlist : strlen(_playlist);
+        base = end;
+        while (base > host - _playlist && _playlist[base - 1] != '/') base--;
+        if (_playlist[base - 1] != '/') base = end;     // no path, the host only
+    }
+    snprintf(out, HLS_URL_LEN, "%.*s%s%s", base, _playlist, uri[0] == '/' || _playlist[base - 1] == '/' ? "" : "/", uri);
+}
+
+
+/**
+ * Queue a segment that is newer than the ones queued before. The
+ * first load keeps the newest, later loads leave the rest for the
+ * next reload.
+ */
+void HlsStream::enqueue(const char *uri)
+{
+    uint32_t seq = _mediaSeq++;
+    uint32_t msDuration = _msExtinf;
+    bool disc = _disc;
+    _msExtinf = 0;
+    _disc = false;
+    if (_anyQueued && (int32_t)(seq - _lastSeq) <= 0) return;
+    if (_qCount == HLS_SEGMENTS)
+    {
+        if (_loaded)
+        {
+            _more = true;
+            return;
+        }
+        _qHead = (_qHead + 1) % HLS_SEGMENTS;
+        _qCount--;
+        _droppedFirst = true;
+    }
+    if (_anyQueued && seq != _lastSeq + 1)
+    {
+        _skipped += seq - _lastSeq - 1;
+        disc = true;
+    }
+    HlsSegment &s = _queue[(_qHead + _qCount) % HLS_SEGMENTS];
+    s.seq = seq;
+    s.msDuration = msDuration;
+    s.discontinuity = disc;
+    resolve(uri, s.url);
+    _qCount++;
+    _lastSeq = seq;
+    _anyQueued = true;
+}
+
+
+/**
+ * Download and demultiplex one segment into the ring. The time
+ * waiting for room in the ring is not network time.
+ */
+bool HlsStream::fetchSegment(HlsSegment &seg)
+{
+    if (seg.discontinuity) markDiscontinuity();
+    _pktLen = 0;
+    _pmtPid = -1;
+    _audioPid = -1;
+    _pesSkip = 0;
+    _id3Skip = 0;
+    _segmentStart = true;
+    _msBlocked = 0;
+
+    uint32_t t0 = millis();
+    char url[HLS_URL_LEN];
+    strlcpy(url, seg.url, sizeof(url));
+    int code = httpOpen(_http, _plain, _secure, url, sizeof(url));
+    bool ok = code == 200;
+    if (ok)
+    {
+        WiFiClient *stream = _http.getStreamPtr();
+        uint8_t buf[1024];
+        uint32_t msData = millis();
+        while (_active)
+        {
+            int n = stream->available();
+            if (n <= 0)
+            {
+                if (!stream->connected()) break;
+                if (millis() - msData > PODCAST_TIMEOUT)
+                {
+                    ok = false;
+                    break;
+                }
+                delay(1);
+                continue;
+            }
+            n = stream->read(buf, min(n, (int)sizeof(buf)));
+            if (n > 0) demux(buf, n);
+            msData = millis();
+        }
+    }
+    _http.end();
+    if (!_active) return false;
+    if (!ok)
+    {
+        log_e("Segment %u failed (HTTP %d)", seg.seq, code);
+        _failures++;
+        markDiscontinuity();        // the next segment does not continue this one
+        return false;
+    }
+
+    uint32_t ms = millis() - t0 - _msBlocked;
+    uint32_t health = seg.msDuration ? ms * 100 / seg.msDuration : 0;
+    _segments++;
+    _msFetchSum += ms;
+    _msDurationSum += seg.msDuration;
+    if (health > _healthMax) _healthMax = health;
+    if (ms > seg.msDuration) _late++;
+    log_d("Segment %u: %u ms for %u ms", seg.seq, ms, seg.msDuration);
+    return true;
+}
+
+
+/**
+ * MPEG-TS or packed audio, told by the first byte of the segment
+ */
+void HlsStream::demux(const uint8_t *data, int len)
+{
+    if (_segmentStart)
+    {
+        _segmentStart = false;
+        _ts = data[0] == 0x47;
+        if (!_ts && len >= 10 && memcmp(data, "ID3", 3) == 0)
+        {
+            _id3Skip = 10 + ((data[6] & 0x7F) << 21 | (data[7] & 0x7F) << 14 | (data[8] & 0x7F) << 7 | (data[9] & 0x7F));
+        }
+    }
+    if (!_ts)
+    {
+        raw(data, len);
+        return;
+    }
+    while (len > 0)
+    {
+        if (_pktLen == 0)
+        {
+            if (data[0] != 0x47)        // lost sync, search the next packet
+            {
+                data++;
+                len--;
+                continue;
+            }
+            if (len >= HLS_TS_PACKET)
+            {
+                packet(data);
+                data += HLS_TS_PACKET;
+                len -= HLS_TS_PACKET;
+                continue;
+            }
+        }
+        int n = min(len, HLS_TS_PACKET - _pktLen);
+        memcpy(_pkt + _pktLen, data, n);
+        _pktLen += n;
+        data += n;
+        len -= n;
+        if (_pktLen == HLS_TS_PACKET)
+        {
+            packet(_pkt);
+            _pktLen = 0;
+        }
+    }
+}
+
+
+/**
+ * One TS packet: PAT and PMT find the audio stream, its PES
+ * payload goes to the ring without the PES header
+ */
+void HlsStream::packet(const uint8_t *p)
+{
+    int pid = (p[1] & 0x1F) << 8 | p[2];
+    bool start = p[1] & 0x40;
+    int control = (p[3] >> 4) & 3;
+    int off = 4;
+    if (control & 2) off += 1 + p[4];           // adaptation field
+    if (!(control & 1) || off >= HLS_TS_PACKET) return;
+    const uint8_t *payload = p + off;
+    int len = HLS_TS_PACKET - off;
+
+    if (pid == 0 || pid == _pmtPid)
+    {
+        if (!start || 1 + payload[0] + 12 > len) return;
+        const uint8_t *s = payload + 1 + payload[0];
+        int end = min(3 + ((s[1] & 0x0F) << 8 | s[2]) - 4, len - 1 - payload[0]);     // without the CRC
+        if (pid == 0 && s[0] == 0x00)
+        {
+            for (int i = 8; i + 4 <= end; i += 4)
+            {
+                if ((s[i] << 8 | s[i + 1]) == 0) continue;      // network PID
+                _pmtPid = (s[i + 2] & 0x1F) << 8 | s[i + 3];
+                break;
+            }
+        }
+        else if (pid == _pmtPid && s[0] == 0x02)
+        {
+            for (int i = 12 + ((s[10] & 0x0F) << 8 | s[11]); i + 5 <= end; i += 5 + ((s[i + 3] & 0x0F) << 8 | s[i + 4]))
+            {
+                HlsCodec c = s[i] == 0x0F ? HlsCodec::Aac : s[i] == 0x03 || s[i] == 0x04 ? HlsCodec::Mp3 : HlsCodec::Unknown;
+                if (c == HlsCodec::Unknown || _audioPid >= 0) continue;
+                _audioPid = (s[i + 1] & 0x1F) << 8 | s[i + 2];
+                if (_codec == HlsCodec::Unknown) _codec = c;
+                else if (_codec != c) log_w("The codec of the stream has changed");
+            }
+        }
+        return;
+    }
+    if (pid != _audioPid) return;
+    if (start)
+    {
+        if (len < 9 || payload[0] != 0 || payload[1] != 0 || payload[2] != 1) return;
+        _pesSkip = 9 + payload[8];
+    }
+    int skip = min(_pesSkip, len);
+    _pesSkip -= skip;
+    if (len > skip) put(payload + skip, len - skip);
+}
+
+
+// A packed audio segment, after its ID3 tag
+void HlsStream::raw(const uint8_t *data, int len)
+{
+    uint32_t skip = min(_id3Skip, (uint32_t)len);
+    _id3Skip -= skip;
+    data += skip;
+    len -= skip;
+    if (len <= 0) return;
+    if (_codec == HlsCodec::Unknown)
+    {
+        Mp3Frame frame;
+        if (len >= 2 && data[0] == 0xFF && (data[1] & 0xF6) == 0xF0) _codec = HlsCodec::Aac;       // ADTS
+        else if (len >= 4 && parseMp3Header(data, frame)) _codec = HlsCodec::Mp3;
+    }
+    put(data, len);
+}
+
+
+/**
+ * Copy into the ring, waits for room while the session lasts
+ */
+bool HlsStream::put(const uint8_t *data, int len)
+{
+    while (len > 0 && _active)
+    {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        uint32_t room = HLS_RING_SIZE - (head - _tail.load(std::memory_order_acquire));
+        if (room == 0)
+        {
+            uint32_t t0 = millis();
+            vTaskDelay(pdMS_TO_TICKS(10));
+            _msBlocked += millis() - t0;
+            continue;
+        }
+        int n = min((uint32_t)len, room);
+        n = min(n, HLS_RING_SIZE - (int)(head % HLS_RING_SIZE));
+        memcpy(_ring + head % HLS_RING_SIZE, data, n);
+        _head.store(head + n, std::memory_order_release);
+        data += n;
+        len -= n;
+    }
+    return len == 0;
+}
+
+
+/**
+ * The bytes from here on do not continue the ones before. Waits
+ * while the reader has not reached the previous discontinuity.
+ */
+void HlsStream::markDiscontinuity()
+{
+    if (_head.load(std::memory_order_relaxed) == 0) return;
+    while (_discPending.load(std::memory_order_acquire) && _active)
+    {
+        uint32_t t0 = millis();
+        vTaskDelay(pdMS_TO_TICKS(10));
+        _msBlocked += millis() - t0;
+    }
+    _discAt.store(_head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    _discPending.store(true, std::memory_order_release);
+    _discontinuities++;
+}
+
+
+int HlsStream::available()
+{
+    if (_ring == nullptr || _discReached) return 0;
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    uint32_t n = _head.load(std::memory_order_acquire) - tail;
+    if (_discPending.load(std::memory_order_acquire)) n = min(n, _discAt.load(std::memory_order_relaxed) - tail);
+    return n;
+}
+
+
+/**
+ * Read from the ring, up to a discontinuity, which stops
+ * the reading until discontinuity() was called
+ */
+size_t HlsStream::readBytes(uint8_t *data, size_t len)
+{
+    if (_ring == nullptr || _discReached) return 0;
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    uint32_t n = _head.load(std::memory_order_acquire) - tail;
+    if (_discPending.load(std::memory_order_acquire))
+    {
+        uint32_t at = _discAt.load(std::memory_order_relaxed);
+        if (tail == at)
+        {
+            _discPending.store(false, std::memory_order_release);
+            _discReached = true;
+            return 0;
+        }
+        n = min(n, at - tail);
+    }
+    if (n == 0)
+    {
+        if (!_empty) _underruns++;
+        _empty = true;
+        return 0;
+    }
+    _empty = false;
+    n = min(n, (uint32_t)len);
+    n = min(n, HLS_RING_SIZE - tail % HLS_RING_SIZE);
+    memcpy(data, _ring + tail % HLS_RING_SIZE, n);
+    _tail.store(tail + n, std::memory_order_release);
+    return n;
+}
+
+
+HlsCodec HlsStream::codec()
+{
+    return _codec;
+}
+
+
+// true once when the reader has reached a discontinuity
+bool HlsStream::discontinuity()
+{
+    if (!_discReached) return false;
+    _discReached = false;
+    return true;
+}
+
+
+// Network time of the segments against their duration
+uint32_t HlsStream::healthPercent()
+{
+    return _msDurationSum ? (uint64_t)_msFetchSum * 100 / _msDurationSum : 0;
+}
+
+
+void HlsStream::printStats()
+{
+    if (_segments == 0 && _failures == 0) return;
+    log_i("HLS: %u segments, fetch %u %% of their duration (max %u %%), %u late, %u reloads (max %u ms), "
+          "%u skipped, %u discontinuities, %u failures, %u underruns",
+          _segments, healthPercent(), _healthMax, _late, _reloads, _msReloadMax,
+          _skipped, _discontinuities, _failures, _underruns);
+}
+
+
+void HlsStream::resetStats()
+{
+    _segments = 0;
+    _msFetchSum = 0;
+    _msDurationSum = 0;
+    _healthMax = 0;
+    _late = 0;
+    _reloads = 0;
+    _msReloadMax = 0;
+    _skipped = 0;
+    _discontinuities = 0;
+    _failures = 0;
+    _underruns = 0;
+}
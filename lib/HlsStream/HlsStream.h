@@ -0,0 +1,153 @@
+/**
+ * Header       HlsStream.h
+ *
+ * Purpose      Declaration of the class HlsStream, the source of the
+ *              copier for a station that streams with HLS (m3u8) instead
+ *              of ICY, as more and more broadcasters do.
+ *              - A task fetches the playlists and the segments, loop()
+ *                reads the audio from a RAM ring. The next segment is
+ *                downloaded while the decoder plays the one before, the
+ *                decoder sees one continuous stream without a gap at the
+ *                segment boundaries.
+ *              - The playlist is parsed line by line while it arrives, a
+ *                master playlist selects the variant with the highest
+ *                bandwidth up to HLS_MAX_BANDWIDTH. A live stream starts
+ *                HLS_LIVE_SEGMENTS segments before the end and the
+ *                playlist is reloaded about every target duration.
+ *              - Segments in MPEG-TS are demultiplexed, the PES payload
+ *                of the audio stream is the ADTS (AAC) or MP3 stream.
+ *                Packed audio segments (.aac, .mp3) are passed on after
+ *                their ID3 tag. codec() tells which decoder is needed.
+ *              - At an EXT-X-DISCONTINUITY, or when segments were missed,
+ *                the reader stops at the first byte of the new segment
+ *                and discontinuity() returns true once, to reset the
+ *                decoder.
+ *              Health: the network time of each segment, without the
+ *              time waiting for room in the ring, against its duration.
+ *              Above 100 % the stream cannot be kept up.
+ *
+ * Usage        HlsStream hls;
+ *              hls.startFetcher();
+ *              if (hls.begin(url)) dec.setDecoder(hls.codec() == HlsCodec::Aac ? &aac : &mp3);
+ *              copier.begin(timeshift, hls);
+ *              loop() { copier.copy(); if (hls.discontinuity()) { dec.end(); dec.begin(); } }
+ */
+#pragma once
+#include <Arduino.h>
+#include <AudioTools.h>
+#include <atomic>
+#include "Podcast.h"
+#include "Mp3Frame.h"
+
+const int HLS_RING_SIZE      = 32768;       // 2 s at 128 kbit/s, a power of two
+const int HLS_SEGMENTS       = 6;           // segments queued from the playlist
+const int HLS_LIVE_SEGMENTS  = 3;           // start of a live stream before the end
+const int HLS_URL_LEN        = PODCAST_URL_LEN;
+const int HLS_LINE_LEN       = PODCAST_URL_LEN + 64;
+const uint32_t HLS_MAX_BANDWIDTH = 192000;  // bit/s of the variant selected
+const int HLS_TS_PACKET      = 188;
+const int HLS_BEGIN_TIMEOUT  = 10000;       // ms until the codec is known
+
+enum class HlsCodec : uint8_t { Unknown, Aac, Mp3 };
+
+struct HlsSegment
+{
+    uint32_t seq;
+    uint32_t msDuration;
+    bool     discontinuity;
+    char     url[HLS_URL_LEN];
+};
+
+class HlsStream : public AudioStream
+{
+    public:
+        void startFetcher(UBaseType_t priority=2, BaseType_t core=0);
+        bool begin(const char *url);
+        void end() override;
+        size_t readBytes(uint8_t *data, size_t len) override;
+        int available() override;
+        HlsCodec codec();
+        bool discontinuity();
+
+        uint32_t healthPercent();
+        void printStats();
+        void resetStats();
+
+    private:
+        static void task(void *arg);
+        void run();
+        void session();
+        bool loadPlaylist();
+        void parseLine(char *line);
+        void resolve(const char *uri, char *out);
+        void enqueue(const char *uri);
+        bool fetchSegment(HlsSegment &seg);
+        void demux(const uint8_t *data, int len);
+        void packet(const uint8_t *p);
+        void raw(const uint8_t *data, int len);
+        bool put(const uint8_t *data, int len);
+        void markDiscontinuity();
+
+        TaskHandle_t _task = nullptr;
+        std::atomic<bool> _active{false};   // begin() until end()
+        std::atomic<bool> _busy{false};     // the task is in a session
+        std::atomic<HlsCodec> _codec{HlsCodec::Unknown};
+
+        // fetcher only
+        HTTPClient _http;
+        WiFiClient _plain;
+        WiFiClientSecure _secure;
+        char _playlist[HLS_URL_LEN];        // URL of the media playlist
+        char _line[HLS_LINE_LEN];
+        int  _lineLen = 0;
+        HlsSegment _queue[HLS_SEGMENTS];
+        int  _qHead = 0;                    // next segment to fetch
+        int  _qCount = 0;
+        bool _loaded = false;               // the first media playlist was read
+        bool _ended = false;                // EXT-X-ENDLIST, no live stream
+        uint32_t _msTarget = 6000;          // EXT-X-TARGETDURATION
+        uint32_t _mediaSeq = 0;             // sequence number of the next URI in the playlist
+        uint32_t _lastSeq = 0;              // newest segment queued
+        bool     _anyQueued = false;
+        bool     _more = false;             // the playlist had more segments than room in the queue
+        bool     _droppedFirst = false;     // the first load dropped the oldest
+        uint32_t _msExtinf = 0;
+        bool     _disc = false;             // for the next URI
+        bool     _master = false;
+        uint32_t _variantBandwidth = 0;
+        uint32_t _streamInfBandwidth = 0;   // of the next URI of a master playlist
+        char     _variant[HLS_URL_LEN];
+        uint32_t _msReload = 0;
+
+        // demultiplexer, fetcher only
+        uint8_t  _pkt[HLS_TS_PACKET];
+        int      _pktLen = 0;
+        int      _pmtPid = -1;
+        int      _audioPid = -1;
+        int      _pesSkip = 0;              // bytes of the PES header still to skip
+        bool     _ts = false;
+        uint32_t _id3Skip = 0;              // of a packed audio segment
+        bool     _segmentStart = true;
+        uint32_t _msBlocked = 0;
+
+        // ring, producer the task, consumer loop()
+        uint8_t *_ring = nullptr;
+        std::atomic<uint32_t> _head{0};
+        std::atomic<uint32_t> _tail{0};
+        std::atomic<uint32_t> _discAt{0};
+        std::atomic<bool> _discPending{false};
+        bool _discReached = false;          // loop() only
+        bool _empty = false;
+
+        uint32_t _segments = 0;
+        uint32_t _msFetchSum = 0;
+        uint32_t _msDurationSum = 0;
+        uint32_t _healthMax = 0;            // percent
+        uint32_t _late = 0;                 // segments that took longer than their duration
+        uint32_t _reloads = 0;
+        uint32_t _msReloadMax = 0;
+        uint32_t _skipped = 0;              // segments gone from the playlist before fetched
+        uint32_t _discontinuities = 0;
+        uint32_t _failures = 0;
+        uint32_t _underruns = 0;
+};
@@ -0,0 +1,463 @@
+/**
+ * Class        Implementation of the pixel kernels and the image encoders
+ *
+ * Purpose      RGB565 is expanded to 8 bits per channel by replicating
+ *              the high bits, so that white stays 0xFFFFFF.
+ *
+ * Remarks      The deflate stream of PngEncoder is a single block with
+ *              the fixed Huffman code. Only repeats of the previous byte
+ *              are matched, no window and no hash table are needed.
+ */
+#include "ImageCodec.h"
+
+
+// RGB565 to bytes R, G, B as 0x00BBGGRR
+static inline uint32_t toRgb(uint32_t c)
+{
+    uint32_t rb = (c & 0xF800) >> 8 | (c & 0x001F) << 19;
+    uint32_t g  = (c & 0x07E0) << 5;
+    return rb | (rb >> 5 & 0x00070007) | g | (g >> 6 & 0x00000300);
+}
+
+// RGB565 to bytes B, G, R as 0x00RRGGBB
+static inline uint32_t toBgr(uint32_t c)
+{
+    uint32_t rb = (c & 0xF800) << 8 | (c & 0x001F) << 3;
+    uint32_t g  = (c & 0x07E0) << 5;
+    return rb | (rb >> 5 & 0x00070007) | g | (g >> 6 & 0x00000300);
+}
+
+template <uint32_t (*expand)(uint32_t)>
+static void expand565(const uint16_t *src, uint8_t *dst, int n)
+{
+    const uint32_t *s = reinterpret_cast<const uint32_t *>(src);
+    uint32_t *d = reinterpret_cast<uint32_t *>(dst);
+    for (; n >= 4; n -= 4)
+    {
+        uint32_t p01 = *s++, p23 = *s++;
+        uint32_t v0 = expand(p01 & 0xFFFF), v1 = expand(p01 >> 16);
+        uint32_t v2 = expand(p23 & 0xFFFF), v3 = expand(p23 >> 16);
+        *d++ = v0 | v1 << 24;
+        *d++ = v1 >> 8 | v2 << 16;
+        *d++ = v2 >> 16 | v3 << 8;
+    }
+    const uint16_t *s16 = reinterpret_cast<const uint16_t *>(s);
+    uint8_t *d8 = reinterpret_cast<uint8_t *>(d);
+    for (; n > 0; n--)
+    {
+        uint32_t v = expand(*s16++);
+        *d8++ = v;
+        *d8++ = v >> 8;
+        *d8++ = v >> 16;
+    }
+}
+
+void rgb565ToRgb888(const uint16_t *src, uint8_t *dst, int n)
+{
+    expand565<toRgb>(src, dst, n);
+}
+
+void rgb565ToBgr888(const uint16_t *src, uint8_t *dst, int n)
+{
+    expand565<toBgr>(src, dst, n);
+}
+
+
+/**
+ * Swap the bytes of RGB565 pixels, e.g. from the display
+ * order to the little endian order of a 16 bit BMP
+ */
+void swap565(const uint16_t *src, uint16_t *dst, int n)
+{
+    const uint32_t *s = reinterpret_cast<const uint32_t *>(src);
+    uint32_t *d = reinterpret_cast<uint32_t *>(dst);
+    for (; n >= 2; n -= 2)
+    {
+        uint32_t p = *s++;
+        *d++ = (p & 0x00FF00FF) << 8 | (p >> 8 & 0x00FF00FF);
+    }
+    if (n)
+    {
+        uint16_t p = *reinterpret_cast<const uint16_t *>(s);
+        *reinterpret_cast<uint16_t *>(d) = p << 8 | p >> 8;
+    }
+}
+
+
+static void putLe(uint8_t *&p, uint32_t v, int n)
+{
+    for (int i = 0; i < n; i++) *p++ = v >> (8 * i);
+}
+
+static void putBe(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+
+int bmpRowSize(int w, int bits)
+{
+    return (w * bits / 8 + 3) & ~3;
+}
+
+/**
+ * BMP file and info header for bottom-up rows of 24 bit BGR or of
+ * 16 bit RGB565, which needs the BI_BITFIELDS color masks.
+ * Returns the size of the header.
+ */
+int bmpHeader(uint8_t *buf, int w, int h, int bits)
+{
+    int size = bits == 16 ? 66 : 54;
+    uint32_t image = bmpRowSize(w, bits) * h;
+    uint8_t *p = buf;
+    putLe(p, 0x4D42, 2);            // "BM"
+    putLe(p, size + image, 4);
+    putLe(p, 0, 4);
+    putLe(p, size, 4);              // offset of the pixels
+    putLe(p, 40, 4);                // BITMAPINFOHEADER
+    putLe(p, w, 4);
+    putLe(p, h, 4);
+    putLe(p, 1, 2);
+    putLe(p, bits, 2);
+    putLe(p, bits == 16 ? 3 : 0, 4);    // BI_BITFIELDS or BI_RGB
+    putLe(p, image, 4);
+    putLe(p, 2835, 4);              // 72 dpi
+    putLe(p, 2835, 4);
+    putLe(p, 0, 4);
+    putLe(p, 0, 4);
+    if (bits == 16)
+    {
+        putLe(p, 0xF800, 4);
+        putLe(p, 0x07E0, 4);
+        putLe(p, 0x001F, 4);
+    }
+    return size;
+}
+
+
+/**
+ * CRC-32 of PNG and zlib, 4 bits per step
+ */
+uint32_t crc32(uint32_t crc, const uint8_t *data, int len)
+{
+    static const uint32_t table[16] =
+    {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    crc = ~crc;
+    while (len--)
+    {
+        crc ^= *data++;
+        crc = crc >> 4 ^ table[crc & 15];
+        crc = crc >> 4 ^ table[crc & 15];
+    }
+    return ~crc;
+}
+
+
+// --- QoiEncoder ---
+
+bool QoiEncoder::begin(int w, int h)
+{
+    _w = w;
+    _rgb = static_cast<uint8_t *>(malloc((3 * w + 3) & ~3));
+    if (_rgb == nullptr) return false;
+    memset(_index, 0, sizeof(_index));
+    _prev = 0xFF000000;
+    _run = 0;
+    _fill = 0;
+    _ok = true;
+
+    uint8_t header[14] = { 'q', 'o', 'i', 'f' };
+    putBe(header + 4, w);
+    putBe(header + 8, h);
+    header[12] = 3;                 // RGB
+    header[13] = 0;                 // sRGB
+    for (uint8_t b : header) put(b);
+    return _ok;
+}
+
+bool QoiEncoder::addRow(const uint16_t *rgb565)
+{
+    rgb565ToRgb888(rgb565, _rgb, _w);
+    const uint8_t *p = _rgb;
+    for (int x = 0; x < _w; x++, p += 3)
+    {
+        uint32_t px = p[0] | p[1] << 8 | p[2] << 16 | 0xFF000000;
+        if (px == _prev)
+        {
+            if (++_run == 62) flushRun();
+            continue;
+        }
+        flushRun();
+
+        int h = (p[0] * 3 + p[1] * 5 + p[2] * 7 + 255 * 11) & 63;
+        if (_index[h] == px)
+        {
+            put(h);                                     // QOI_OP_INDEX
+        }
+        else
+        {
+            _index[h] = px;
+            int8_t vr = p[0] - (uint8_t)_prev;
+            int8_t vg = p[1] - (uint8_t)(_prev >> 8);
+            int8_t vb = p[2] - (uint8_t)(_prev >> 16);
+            int8_t vgr = vr - vg, vgb = vb - vg;
+            if (vr >= -2 && vr <= 1 && vg >= -2 && vg <= 1 && vb >= -2 && vb <= 1)
+            {
+                put(0x40 | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));   // QOI_OP_DIFF
+            }
+            else if (vg >= -32 && vg <= 31 && vgr >= -8 && vgr <= 7 && vgb >= -8 && vgb <= 7)
+            {
+                put(0x80 | (vg + 32));                   // QOI_OP_LUMA
+                put((vgr + 8) << 4 | (vgb + 8));
+            }
+            else
+            {
+                put(0xFE);                              // QOI_OP_RGB
+                put(p[0]);
+                put(p[1]);
+                put(p[2]);
+            }
+        }
+        _prev = px;
+    }
+    return _ok;
+}
+
+bool QoiEncoder::end()
+{
+    flushRun();
+    for (int i = 0; i < 7; i++) put(0);
+    put(1);
+    flush();
+    free(_rgb);
+    _rgb = nullptr;
+    return _ok;
+}
+
+bool QoiEncoder::flushRun()
+{
+    if (_run == 0) return _ok;
+    put(0xC0 | (_run - 1));                             // QOI_OP_RUN
+    _run = 0;
+    return _ok;
+}
+
+bool QoiEncoder::put(uint8_t b)
+{
+    _out[_fill++] = b;
+    if (_fill == sizeof(_out)) flush();
+    return _ok;
+}
+
+bool QoiEncoder::flush()
+{
+    if (_fill) _ok = _sink(_out, _fill, _arg) && _ok;
+    _fill = 0;
+    return _ok;
+}
+// --- QoiEncoder ---
+
+
+// --- PngEncoder ---
+
+// Fixed Huffman code of the literal/length alphabet, bit-reversed for the LSB first stream
+static uint16_t litCode[288];
+static uint8_t  litLen[288];
+
+static const uint16_t lengthBase[29] =
+{
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t lengthExtra[29] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+static void initFixedCode()
+{
+    if (litLen[0] != 0) return;
+    for (int sym = 0; sym < 288; sym++)
+    {
+        uint16_t code;
+        uint8_t  len;
+        if      (sym < 144) { code = 0x030 + sym;         len = 8; }
+        else if (sym < 256) { code = 0x190 + (sym - 144); len = 9; }
+        else if (sym < 280) { code = sym - 256;           len = 7; }
+        else                { code = 0x0C0 + (sym - 280); len = 8; }
+        uint16_t rev = 0;
+        for (int i = 0; i < len; i++) rev |= ((code >> i) & 1) << (len - 1 - i);
+        litCode[sym] = rev;
+        litLen[sym]  = len;
+    }
+}
+
+
+bool PngEncoder::begin(int w, int h)
+{
+    _w = w;
+    _stride = 3 * w;
+    int stride4 = (_stride + 3) & ~3;
+    _buf = static_cast<uint8_t *>(malloc(2 * stride4 + 2 * (_stride + 1)));
+    if (_buf == nullptr) return false;
+    _cur  = _buf;
+    _prev = _buf + stride4;
+    _sub  = _buf + 2 * stride4;
+    _up   = _sub + _stride + 1;
+    memset(_prev, 0, _stride);
+    initFixedCode();
+    _ok = true;
+    _bitBuf = 0;
+    _nBits = 0;
+    _last = -1;
+    _run = 0;
+    _adlerA = 1;
+    _adlerB = 0;
+    _fill = 0;
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    _ok = _sink(signature, sizeof(signature), _arg);
+    uint8_t ihdr[13];
+    putBe(ihdr, w);
+    putBe(ihdr + 4, h);
+    ihdr[8]  = 8;                   // bits per channel
+    ihdr[9]  = 2;                   // RGB
+    ihdr[10] = 0;                   // deflate
+    ihdr[11] = 0;                   // adaptive filtering
+    ihdr[12] = 0;                   // not interlaced
+    chunk("IHDR", ihdr, sizeof(ihdr));
+
+    bits(0x78, 8);                  // zlib header, 32K window, fastest
+    bits(0x01, 8);
+    bits(1, 1);                     // the last and only block
+    bits(1, 2);                     // fixed Huffman code
+    return _ok;
+}
+
+
+/**
+ * Filter a row with Sub or Up, whichever has the smaller
+ * sum of absolute differences, and compress it
+ */
+bool PngEncoder::addRow(const uint16_t *rgb565)
+{
+    rgb565ToRgb888(rgb565, _cur, _w);
+    uint32_t sumSub = 0, sumUp = 0;
+    _sub[0] = 1;
+    _up[0]  = 2;
+    for (int i = 0; i < _stride; i++)
+    {
+        int8_t s = _cur[i] - (i >= 3 ? _cur[i - 3] : 0);
+        int8_t u = _cur[i] - _prev[i];
+        _sub[i + 1] = s;
+        _up[i + 1]  = u;
+        sumSub += abs(s);
+        sumUp  += abs(u);
+    }
+    deflate(sumUp < sumSub ? _up : _sub, _stride + 1);
+    std::swap(_cur, _prev);
+    return _ok;
+}
+
+
+bool PngEncoder::end()
+{
+    flushRun();
+    symbol(256);                    // end of block
+    if (_nBits > 0) bits(0, 8 - _nBits);
+    uint32_t adler = _adlerB << 16 | _adlerA;
+    for (int i = 24; i >= 0; i -= 8) bits(adler >> i & 0xFF, 8);
+    if (_fill) chunk("IDAT", _out, _fill);
+    _fill = 0;
+    chunk("IEND", nullptr, 0);
+    free(_buf);
+    _buf = nullptr;
+    return _ok;
+}
+
+
+bool PngEncoder::chunk(const char *type, const uint8_t *data, int len)
+{
+    uint8_t head[8];
+    putBe(head, len);
+    memcpy(head + 4, type, 4);
+    uint32_t crc = crc32(0, head + 4, 4);
+    crc = crc32(crc, data, len);
+    uint8_t tail[4];
+    putBe(tail, crc);
+    _ok = _sink(head, 8, _arg) && _ok;
+    if (len) _ok = _sink(data, len, _arg) && _ok;
+    _ok = _sink(tail, 4, _arg) && _ok;
+    return _ok;
+}
+
+
+/**
+ * Bytes equal to the previous one are collected into a match at distance 1
+ */
+void PngEncoder::deflate(const uint8_t *data, int len)
+{
+    for (int i = 0; i < len; i++)
+    {
+        uint8_t c = data[i];
+        _adlerA += c;
+        _adlerB += _adlerA;
+        if (c == _last && _run < 258)
+        {
+            _run++;
+            continue;
+        }
+        flushRun();
+        literal(c);
+    }
+    _adlerA %= 65521;
+    _adlerB %= 65521;
+}
+
+void PngEncoder::literal(uint8_t b)
+{
+    symbol(b);
+    _last = b;
+}
+
+void PngEncoder::flushRun()
+{
+    if (_run >= 3)
+    {
+        int k = 28;
+        while (lengthBase[k] > _run) k--;
+        symbol(257 + k);
+        bits(_run - lengthBase[k], lengthExtra[k]);
+        bits(0, 5);                 // distance code 0 = distance 1
+    }
+    else
+    {
+        for (int i = 0; i < _run; i++) symbol(_last);
+    }
+    _run = 0;
+}
+
+void PngEncoder::symbol(int sym)
+{
+    bits(litCode[sym], litLen[sym]);
+}
+
+void PngEncoder::bits(uint32_t value, int n)
+{
+    _bitBuf |= value << _nBits;
+    _nBits += n;
+    while (_nBits >= 8)
+    {
+        _out[_fill++] = _bitBuf;
+        _bitBuf >>= 8;
+        _nBits -= 8;
+        if (_fill == PNG_CHUNK_SIZE)
+        {
+            chunk("IDAT", _out, _fill);
+            _fill = 0;
+        }
+    }
+}
+// --- PngEncoder ---
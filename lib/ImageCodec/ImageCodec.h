@@ -0,0 +1,109 @@
+/**
+ * Header       ImageCodec.h
+ *
+ * Purpose      Image file formats for screenshots, written row by row, so
+ *              that the memory needed does not depend on the image height.
+ *              - Pixel kernels from RGB565 to RGB888/BGR888 and a byte
+ *                swap of RGB565, two pixels per 32 bit load, four pixels
+ *                per three 32 bit stores.
+ *              - BMP headers for 24 bit and for 16 bit RGB565 with the
+ *                BI_BITFIELDS masks.
+ *              - QoiEncoder, the "Quite OK Image" format: runs, a cache
+ *                of 64 recent colors and small differences, a single pass
+ *                without tables.
+ *              - PngEncoder with the Sub or Up filter per row and deflate
+ *                restricted to runs (distance 1) with the fixed Huffman
+ *                code. Flat UI screens compress to a few percent.
+ *              The encoders pass their output to a sink function.
+ *
+ * Usage        bool sink(const uint8_t *data, int len, void *arg) { return file.write(data, len) == len; }
+ *              PngEncoder png(sink, nullptr);
+ *              png.begin(320, 240);
+ *              for (int y = 0; y < 240; y++) png.addRow(row565);
+ *              png.end();
+ *
+ * Remarks      The source and destination of the kernels must be 32 bit
+ *              aligned. The encoders allocate their row buffers in begin()
+ *              and free them in end().
+ */
+#pragma once
+#include <Arduino.h>
+
+// Receives the encoded data, returns false on a write error
+using ImageSink = bool(*)(const uint8_t *data, int len, void *arg);
+
+void rgb565ToRgb888(const uint16_t *src, uint8_t *dst, int n);
+void rgb565ToBgr888(const uint16_t *src, uint8_t *dst, int n);
+void swap565(const uint16_t *src, uint16_t *dst, int n);
+int  bmpHeader(uint8_t *buf, int w, int h, int bits);
+int  bmpRowSize(int w, int bits);
+uint32_t crc32(uint32_t crc, const uint8_t *data, int len);
+
+const int BMP_HEADER_MAX = 66;      // 54 bytes + 3 masks of 16 bit BMP
+
+
+class QoiEncoder
+{
+    public:
+        QoiEncoder(ImageSink sink, void *arg) : _sink(sink), _arg(arg)
+        {}
+
+        bool begin(int w, int h);
+        bool addRow(const uint16_t *rgb565);
+        bool end();
+
+    private:
+        bool put(uint8_t b);
+        bool flushRun();
+        bool flush();
+
+        ImageSink _sink;
+        void     *_arg;
+        int       _w = 0;
+        uint8_t  *_rgb = nullptr;       // one row of RGB888
+        uint32_t  _index[64];
+        uint32_t  _prev = 0;
+        int       _run = 0;
+        bool      _ok = true;
+        uint8_t   _out[256];
+        int       _fill = 0;
+};
+
+
+const int PNG_CHUNK_SIZE = 2048;    // bytes of deflate data per IDAT chunk
+
+class PngEncoder
+{
+    public:
+        PngEncoder(ImageSink sink, void *arg) : _sink(sink), _arg(arg)
+        {}
+
+        bool begin(int w, int h);
+        bool addRow(const uint16_t *rgb565);
+        bool end();
+
+    private:
+        bool chunk(const char *type, const uint8_t *data, int len);
+        void deflate(const uint8_t *data, int len);
+        void literal(uint8_t b);
+        void flushRun();
+        void bits(uint32_t value, int n);
+        void symbol(int sym);
+
+        ImageSink _sink;
+        void     *_arg;
+        int       _w = 0;
+        int       _stride = 0;          // bytes per row without the filter byte
+        uint8_t  *_buf = nullptr;       // current and previous row, 2 filtered rows
+        uint8_t  *_cur, *_prev, *_sub, *_up;
+        bool      _ok = true;
+
+        // deflate state
+        uint32_t  _bitBuf = 0;
+        int       _nBits = 0;
+        int       _last = -1;           // last byte emitted, -1 = none
+        int       _run = 0;             // pending repeats of _last
+        uint32_t  _adlerA = 1, _adlerB = 0;
+        uint8_t   _out[PNG_CHUNK_SIZE];
+        int       _fill = 0;
+};
@@ -0,0 +1,204 @@
+/**
+ * Class        Implementation of the class methods of JsonWriter
+ *
+ * Purpose      Small JSON answers of the web API, written in place.
+ *
+ * Remarks      The writer does not check the nesting, a missing
+ *              endObject() gives invalid JSON. The buffer always holds a
+ *              terminated string.
+ */
+#include "JsonWriter.h"
+#include <cmath>
+
+
+void JsonWriter::clear()
+{
+    _len = 0;
+    _depth = 0;
+    _hasItems = 0;
+    _overflow = _size <= 0;
+    if (!_overflow) _buf[0] = '\0';
+}
+
+
+JsonWriter &JsonWriter::beginObject(const char *key)
+{
+    open(key, '{');
+    return *this;
+}
+
+
+JsonWriter &JsonWriter::endObject()
+{
+    close('}');
+    return *this;
+}
+
+
+JsonWriter &JsonWriter::beginArray(const char *key)
+{
+    open(key, '[');
+    return *this;
+}
+
+
+JsonWriter &JsonWriter::endArray()
+{
+    close(']');
+    return *this;
+}
+
+
+// A key of nullptr adds an array element
+JsonWriter &JsonWriter::add(const char *key, int value)
+{
+    char num[12];
+    element(key);
+    snprintf(num, sizeof(num), "%d", value);
+    put(num);
+    return *this;
+}
+
+
+JsonWriter &JsonWriter::add(const char *key, uint32_t value)
+{
+    char num[12];
+    element(key);
+    snprintf(num, sizeof(num), "%u", (unsigned)value);
+    put(num);
+    return *this;
+}
+
+
+JsonWriter &JsonWriter::add(const char *key, float value, int decimals)
+{
+    char num[24];
+    element(key);
+    if (!std::isfinite(value)) put("null");
+    else
+    {
+        snprintf(num, sizeof(num), "%.*f", decimals, value);
+        put(num);
+    }
+    return *this;
+}
+
+
+JsonWriter &JsonWriter::add(const char *key, bool value)
+{
+    element(key);
+    put(value ? "true" : "false");
+    return *this;
+}
+
+
+JsonWriter &JsonWriter::add(const char *key, const char *latin1)
+{
+    element(key);
+    if (latin1) string(latin1);
+    else put("null");
+    return *this;
+}
+
+
+JsonWriter &JsonWriter::addUtf8(const char *key, const char *utf8)
+{
+    element(key);
+    if (utf8) string(utf8, true);
+    else put("null");
+    return *this;
+}
+
+
+bool JsonWriter::ok()
+{
+    return !_overflow;
+}
+
+
+int JsonWriter::length()
+{
+    return _len;
+}
+
+
+const char *JsonWriter::c_str()
+{
+    return _buf;
+}
+
+
+void JsonWriter::open(const char *key, char bracket)
+{
+    element(key);
+    put(bracket);
+    if (_depth < JSON_MAX_DEPTH - 1) _depth++;
+    _hasItems &= ~(1u << _depth);
+}
+
+
+void JsonWriter::close(char bracket)
+{
+    if (_depth > 0) _depth--;
+    put(bracket);
+}
+
+
+// Comma and key of the next element
+void JsonWriter::element(const char *key)
+{
+    if (_hasItems & (1u << _depth)) put(',');
+    _hasItems |= 1u << _depth;
+    if (key)
+    {
+        string(key);
+        put(':');
+    }
+}
+
+
+void JsonWriter::string(const char *text, bool utf8)
+{
+    static const char hex[] = "0123456789abcdef";
+    put('"');
+    for (const uint8_t *p = reinterpret_cast<const uint8_t *>(text); *p; p++)
+    {
+        uint8_t c = *p;
+        if (c == '"' || c == '\\')
+        {
+            put('\\');
+            put(c);
+        }
+        else if (c < 0x20)
+        {
+            put("\\u00");
+            put(hex[c >> 4]);
+            put(hex[c & 15]);
+        }
+        else if (c >= 0x80 && !utf8)
+        {
+            put(0xC0 | c >> 6);
+            put(0x80 | (c & 0x3F));
+        }
+        else put(c);
+    }
+    put('"');
+}
+
+
+void JsonWriter::put(char c)
+{
+    if (_len + 1 >= _size)
+    {
+        _overflow = true;
+        return;
+    }
+    _buf[_len++] = c;
+    _buf[_len] = '\0';
+}
+
+
+void JsonWriter::put(const char *s)
+{
+    while (*s) put(*s++);
+}
@@ -0,0 +1,58 @@
+/**
+ * Header       JsonWriter.h
+ *
+ * Purpose      Declaration of the class JsonWriter, which writes JSON into
+ *              a buffer supplied by the caller. No String, no heap.
+ *              Commas are inserted as needed, strings are escaped and
+ *              converted from Latin-1, the encoding of the UI texts, to
+ *              UTF-8, or copied as they are with addUtf8(), e.g. for
+ *              file names. When the buffer is too small, the output is cut
+ *              and ok() returns false.
+ *
+ * Usage        char buf[256];
+ *              JsonWriter json(buf, sizeof(buf));
+ *              json.beginObject().add("station", 5).add("name", "Jazz MMX").add("volume", 0.33f).endObject();
+ *              if (json.ok()) request->send(200, "application/json", json.c_str());
+ */
+#pragma once
+#include <Arduino.h>
+
+const int JSON_MAX_DEPTH = 8;
+
+class JsonWriter
+{
+    public:
+        JsonWriter(char *buf, int size) : _buf(buf), _size(size)
+        { clear(); }
+
+        void clear();
+        JsonWriter &beginObject(const char *key=nullptr);
+        JsonWriter &endObject();
+        JsonWriter &beginArray(const char *key=nullptr);
+        JsonWriter &endArray();
+        JsonWriter &add(const char *key, int value);
+        JsonWriter &add(const char *key, uint32_t value);
+        JsonWriter &add(const char *key, float value, int decimals=2);
+        JsonWriter &add(const char *key, bool value);
+        JsonWriter &add(const char *key, const char *latin1);
+        JsonWriter &addUtf8(const char *key, const char *utf8);
+
+        bool ok();
+        int  length();
+        const char *c_str();
+
+    private:
+        void open(const char *key, char bracket);
+        void close(char bracket);
+        void element(const char *key);
+        void string(const char *text, bool utf8=false);
+        void put(char c);
+        void put(const char *s);
+
+        char *_buf;
+        int   _size;
+        int   _len;
+        int   _depth;
+        uint32_t _hasItems;     // bit per depth, an element was written
+        bool  _overflow;
+};
@@ -0,0 +1,140 @@
+/**
+ * Class        Implementation of the MPEG audio frame functions
+ *
+ * Purpose      Frame length and duration from the header, as needed to
+ *              index a stream by time without decoding it.
+ *
+ * Remarks      Free format frames (bitrate index 0) are not supported,
+ *              no radio station sends them.
+ */
+#include "Mp3Frame.h"
+
+// kbit/s for the bitrate index 1..14: MPEG 1 layer I, II, III, MPEG 2 layer I, II and III
+static const uint16_t bitrates[5][14] =
+{
+    { 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448 },
+    { 32, 48, 56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320, 384 },
+    { 32, 40, 48,  56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320 },
+    { 32, 48, 56,  64,  80,  96, 112, 128, 144, 160, 176, 192, 224, 256 },
+    {  8, 16, 24,  32,  40,  48,  56,  64,  80,  96, 112, 128, 144, 160 },
+};
+static const uint16_t sampleRates[3] = { 44100, 48000, 32000 };
+
+
+/**
+ * Parse the 4 header bytes at h, returns false if they are no valid header
+ */
+bool parseMp3Header(const uint8_t *h, Mp3Frame &frame)
+{
+    if (h[0] != 0xFF || (h[1] & 0xE0) != 0xE0) return false;
+    int version = (h[1] >> 3) & 3;          // 0 = 2.5, 1 = reserved, 2 = 2, 3 = 1
+    int layer = 4 - ((h[1] >> 1) & 3);      // 4 = reserved
+    int bitrateIndex = h[2] >> 4;
+    int rateIndex = (h[2] >> 2) & 3;
+    if (version == 1 || layer == 4 || bitrateIndex == 0 || bitrateIndex == 15 || rateIndex == 3) return false;
+
+    bool mpeg1 = version == 3;
+    int padding = (h[2] >> 1) & 1;
+    frame.version = mpeg1 ? 10 : version == 2 ? 20 : 25;
+    frame.layer = layer;
+    frame.bitrate = bitrates[mpeg1 ? layer - 1 : (layer == 1 ? 3 : 4)][bitrateIndex - 1];
+    frame.sampleRate = sampleRates[rateIndex] >> (mpeg1 ? 0 : version == 2 ? 1 : 2);
+    frame.channels = (h[3] >> 6) == 3 ? 1 : 2;
+
+    uint32_t bps = frame.bitrate * 1000;
+    if (layer == 1)
+    {
+        frame.samples = 384;
+        frame.length = (12 * bps / frame.sampleRate + padding) * 4;
+    }
+    else
+    {
+        frame.samples = layer == 3 && !mpeg1 ? 576 : 1152;
+        frame.length = (frame.samples / 8) * bps / frame.sampleRate + padding;
+    }
+    if (layer == 3) frame.sideInfo = mpeg1 ? (frame.channels == 1 ? 17 : 32) : (frame.channels == 1 ? 9 : 17);
+    else frame.sideInfo = 0;
+    return frame.length > 4;
+}
+
+
+/**
+ * Follow the frames through the next len bytes of the stream,
+ * the headers may be split between two calls
+ */
+void Mp3Scanner::feed(const uint8_t *data, int len, Mp3FrameFn fn, void *arg)
+{
+    int i = 0;
+    while (i < len)
+    {
+        if (_skip > 0)
+        {
+            uint32_t k = min(_skip, (uint32_t)(len - i));
+            _skip -= k;
+            i += k;
+            continue;
+        }
+        if (_hdrLen == 0) _hdrPos = _pos + i;
+        _hdr[_hdrLen++] = data[i++];
+        if (_hdrLen < 4) continue;
+
+        Mp3Frame frame;
+        if (parseMp3Header(_hdr, frame))
+        {
+            _synced = true;
+            _frames++;
+            _skip = frame.length - 4;
+            _hdrLen = 0;
+            if (fn) fn(_hdrPos, frame, arg);
+            continue;
+        }
+        if (_synced)
+        {
+            _synced = false;
+            _resyncs++;
+        }
+        memmove(_hdr, _hdr + 1, 3);
+        _hdrLen = 3;
+        _hdrPos++;
+    }
+    _pos += len;
+}
+
+
+/**
+ * Start over at the stream offset pos
+ */
+void Mp3Scanner::reset(uint32_t pos)
+{
+    _pos = pos;
+    _skip = 0;
+    _hdrLen = 0;
+    _synced = false;
+}
+
+
+/**
+ * The stream has a gap, search the next header
+ */
+void Mp3Scanner::resync()
+{
+    _skip = 0;
+    _hdrLen = 0;
+    _synced = false;
+}
+
+
+uint32_t Mp3Scanner::position()
+{
+    return _pos;
+}
+
+uint32_t Mp3Scanner::frames()
+{
+    return _frames;
+}
+
+uint32_t Mp3Scanner::resyncs()
+{
+    return _resyncs;
+}
@@ -0,0 +1,53 @@
+/**
+ * Header       Mp3Frame.h
+ *
+ * Purpose      Declaration of the MPEG audio frame header parser and of
+ *              the class Mp3Scanner, which follows the frames of a stream
+ *              that arrives in pieces of any size. Only the 4 byte
+ *              headers are read, the frames are skipped by their length.
+ *              When a header is not where it should be, the scanner
+ *              searches the next one byte by byte and counts the resync.
+ *
+ * Usage        Mp3Scanner scanner;
+ *              scanner.feed(data, len, [](uint32_t pos, const Mp3Frame &f, void *arg) { ... }, this);
+ */
+#pragma once
+#include <Arduino.h>
+
+struct Mp3Frame
+{
+    uint16_t length;        // bytes including the header
+    uint16_t samples;       // per channel
+    uint32_t sampleRate;
+    uint16_t bitrate;       // kbit/s
+    uint8_t  channels;
+    uint8_t  version;       // 10 = MPEG 1, 20 = MPEG 2, 25 = MPEG 2.5
+    uint8_t  layer;
+    uint8_t  sideInfo;      // bytes of the side information after the header (layer III)
+};
+
+bool parseMp3Header(const uint8_t *h, Mp3Frame &frame);
+
+// Called for every frame with its offset in the stream
+using Mp3FrameFn = void(*)(uint32_t pos, const Mp3Frame &frame, void *arg);
+
+class Mp3Scanner
+{
+    public:
+        void feed(const uint8_t *data, int len, Mp3FrameFn fn, void *arg);
+        void reset(uint32_t pos=0);
+        void resync();
+        uint32_t position();
+        uint32_t frames();
+        uint32_t resyncs();
+
+    private:
+        uint32_t _pos = 0;          // offset of the next byte fed
+        uint32_t _skip = 0;         // rest of the current frame
+        uint8_t  _hdr[4];
+        int      _hdrLen = 0;
+        uint32_t _hdrPos = 0;
+        bool     _synced = false;
+        uint32_t _frames = 0;
+        uint32_t _resyncs = 0;
+};
@@ -0,0 +1,689 @@
+/**
+ * Class        Implementation of the class methods of PodcastFeed
+ *              and EpisodeStream
+ *
+ * Purpose      Everything runs in loop(), the HTTP requests block it for
+ *              the connect. Playback of an episode continues after a
+ *              connect from the bytes the decoder has buffered.
+ *
+ * Remarks      The redirects are followed here and not by the HTTPClient,
+ *              a podcast host often redirects from http to https or the
+ *              other way, which needs the other client. The final URL is
+ *              kept for the Range requests of the episode, a signed URL
+ *              of a CDN that has expired is requested again from the feed's
+ *              URL.
+ */
+#include "Podcast.h"
+
+static const char *collectedHeaders[] = { "Location", "Content-Range", "Accept-Ranges" };
+
+
+/**
+ * GET url from the byte from on, with the redirects followed. url is
+ * replaced by the final URL. Returns the HTTP status, < 0 on errors.
+ */
+int httpOpen(HTTPClient &http, WiFiClient &plain, WiFiClientSecure &secure, char *url, int size, uint32_t from)
+{
+    for (int i = 0; i <= PODCAST_REDIRECTS; i++)
+    {
+        http.end();
+        bool tls = strncmp(url, "https:", 6) == 0;
+        if (tls) secure.setInsecure();
+        if (!(tls ? http.begin(secure, url) : http.begin(plain, url))) return -1;
+        http.useHTTP10(true);
+        http.setFollowRedirects(HTTPC_DISABLE_FOLLOW_REDIRECTS);
+        http.setConnectTimeout(PODCAST_TIMEOUT);
+        http.setTimeout(PODCAST_TIMEOUT);
+        http.collectHeaders(collectedHeaders, 3);
+        if (from > 0)
+        {
+            char range[24];
+            snprintf(range, sizeof(range), "bytes=%u-", from);
+            http.addHeader("Range", range);
+        }
+        int code = http.GET();
+        if (code < 300 || code > 308 || code == 304) return code;
+
+        String location = http.header("Location");
+        if (location.length() == 0) return code;
+        if (location[0] == '/')         // same host
+        {
+            char *host = strstr(url, "//");
+            char *path = host ? strchr(host + 2, '/') : nullptr;
+            if (path) *path = '\0';
+            strlcat(url, location.c_str(), size);
+        }
+        else strlcpy(url, location.c_str(), size);
+        log_i("Redirected to %s", url);
+    }
+    return -1;
+}
+
+
+/**
+ * Copy UTF-8 text, a character cut at the end is removed
+ */
+static void copyUtf8(char *dst, const char *src, int size)
+{
+    int n = strlcpy(dst, src, size);
+    if (n < size) return;
+    n = size - 1;
+    if (((uint8_t)src[n] & 0xC0) != 0x80) return;
+    while (n > 0 && ((uint8_t)dst[n - 1] & 0xC0) == 0x80) n--;
+    if (n > 0) n--;                     // the lead byte
+    dst[n] = '\0';
+}
+
+
+// hh:mm:ss, mm:ss or seconds
+static uint32_t parseDuration(const char *text)
+{
+    uint32_t seconds = 0;
+    for (const char *p = text; *p; )
+    {
+        char *end;
+        seconds = seconds * 60 + strtoul(p, &end, 10);
+        if (*end != ':') break;
+        p = end + 1;
+    }
+    return seconds;
+}
+
+
+static uint32_t be32(const uint8_t *p)
+{
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static uint16_t be16(const uint8_t *p)
+{
+    return p[0] << 8 | p[1];
+}
+
+
+void PodcastFeed::begin(AsyncWebServer &server)
+{
+    server.on("/api/episodes", HTTP_GET, [this](AsyncWebServerRequest *r) { episodes(r); });
+    log_i("==> done");
+}
+
+
+/**
+ * Download and parse the feed, blocks loop() until the first
+ * PODCAST_EPISODES items are read
+ */
+bool PodcastFeed::load(const char *url)
+{
+    uint32_t t0 = millis();
+    _seq.fetch_add(1, std::memory_order_acq_rel);
+    _count = 0;
+    _title[0] = '\0';
+    _inItem = _inEnclosure = false;
+    strlcpy(_url, url, sizeof(_url));
+
+    int code = httpOpen(_http, _plain, _secure, _url, sizeof(_url), 0);
+    if (code == 200)
+    {
+        WiFiClient *stream = _http.getStreamPtr();
+        char buf[512];
+        uint32_t bytes = 0;
+        uint32_t msData = millis();
+        _xml.begin(onXml, this);
+        while (_count < PODCAST_EPISODES && millis() - msData < PODCAST_TIMEOUT)
+        {
+            int n = stream->available();
+            if (n <= 0)
+            {
+                if (!stream->connected()) break;
+                delay(1);
+                continue;
+            }
+            n = stream->read(reinterpret_cast<uint8_t *>(buf), min(n, (int)sizeof(buf)));
+            if (n <= 0) continue;
+            _xml.feed(buf, n);
+            bytes += n;
+            msData = millis();
+        }
+        _bytes += bytes;
+        _msLoadLast = millis() - t0;
+        log_i("Feed %s: %d episodes, %u bytes read in %u ms", _title, _count, bytes, _msLoadLast);
+    }
+    else log_e("HTTP %d for %s", code, url);
+    _http.end();
+    _loads++;
+    _seq.fetch_add(1, std::memory_order_release);
+    return _count > 0;
+}
+
+
+/**
+ * The channel title, and title, enclosure and duration of the
+ * items. Only enclosures the MP3 decoder can play are taken.
+ */
+void PodcastFeed::onXml(XmlEvent event, const char *name, const char *value, void *arg)
+{
+    PodcastFeed *f = static_cast<PodcastFeed *>(arg);
+    PodcastEpisode &item = f->_item;
+    switch (event)
+    {
+        case XmlEvent::Start:
+            f->_inEnclosure = f->_inItem && strcmp(name, "enclosure") == 0;
+            if (strcmp(name, "item") != 0) break;
+            memset(&item, 0, sizeof(item));
+            f->_inItem = true;
+            f->_mp3 = false;
+        break;
+
+        case XmlEvent::Attribute:
+            if (!f->_inEnclosure) break;
+            if (strcmp(name, "url") == 0) strlcpy(item.url, value, sizeof(item.url));
+            else if (strcmp(name, "length") == 0) item.bytes = strtoul(value, nullptr, 10);
+            else if (strcmp(name, "type") == 0) f->_mp3 = strstr(value, "mpeg") || strstr(value, "mp3");
+        break;
+
+        case XmlEvent::Text:
+            if (strcmp(name, "title") == 0)
+            {
+                if (f->_inItem) copyUtf8(item.title, value, sizeof(item.title));
+                else if (f->_title[0] == '\0') copyUtf8(f->_title, value, sizeof(f->_title));
+            }
+            else if (f->_inItem && strcmp(name, "itunes:duration") == 0) item.seconds = parseDuration(value);
+        break;
+
+        case XmlEvent::End:
+            f->_inEnclosure = false;
+            if (strcmp(name, "item") != 0) break;
+            f->_inItem = false;
+            if (item.url[0] && f->_mp3 && f->_count < PODCAST_EPISODES) f->_episodes[f->_count++] = item;
+        break;
+    }
+}
+
+
+int PodcastFeed::count()
+{
+    return _count;
+}
+
+const PodcastEpisode &PodcastFeed::episode(int index)
+{
+    return _episodes[index];
+}
+
+const char *PodcastFeed::title()
+{
+    return _title;
+}
+
+
+/**
+ * Runs on the async TCP task. The episodes are copied one by one,
+ * a list changed by load() in between is answered with 503.
+ */
+void PodcastFeed::episodes(AsyncWebServerRequest *request)
+{
+    uint32_t seq = _seq.load(std::memory_order_acquire);
+    _requests++;
+    if (seq & 1)
+    {
+        request->send(503, "application/json", "{\"error\":\"feed loading\"}");
+        return;
+    }
+    PodcastEpisode e;
+    char title[PODCAST_TITLE_LEN];
+    memcpy(title, _title, sizeof(title));
+    title[sizeof(title) - 1] = '\0';
+    _json.clear();
+    _json.beginObject().addUtf8("feed", title).beginArray("episodes");
+    for (int i = 0; i < _count; i++)
+    {
+        memcpy(&e, &_episodes[i], sizeof(e));
+        e.title[sizeof(e.title) - 1] = '\0';
+        _json.beginObject().add("id", i).addUtf8("title", e.title)
+             .add("seconds", e.seconds).add("bytes", e.bytes).endObject();
+    }
+    _json.endArray().endObject();
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (_seq.load(std::memory_order_relaxed) != seq) request->send(503, "application/json", "{\"error\":\"feed loading\"}");
+    else if (!_json.ok()) request->send(500, "application/json", "{\"error\":\"answer too long\"}");
+    else request->send(200, "application/json", _json.c_str());
+}
+
+
+void PodcastFeed::printStats()
+{
+    if (_loads == 0) return;
+    log_i("Podcast feed: %u loads, %u bytes, last %u ms, %d episodes, %u requests",
+          _loads, _bytes, _msLoadLast, _count, _requests);
+}
+
+
+void PodcastFeed::resetStats()
+{
+    _loads = 0;
+    _bytes = 0;
+    _requests = 0;
+}
+
+
+/**
+ * Connect, skip the ID3 tag and read the first frame ahead
+ */
+bool EpisodeStream::open(const char *url)
+{
+    close();
+    strlcpy(_url, url, sizeof(_url));
+    strlcpy(_location, url, sizeof(_location));
+    _pos = _total = _dataStart = 0;
+    _headLen = _headPos = 0;
+    _frames = 0;
+    _hasToc = false;
+    _indexed = 0;
+    _contiguous = true;
+    _usStream = 0;
+    _msSeek = 0;
+    _finished = false;
+
+    uint32_t t0 = millis();
+    if (!connect(0) || !probe())
+    {
+        log_e("Cannot play %s", url);
+        _http.end();
+        _connected = false;
+        return false;
+    }
+    _open = true;
+    log_i("Episode: %u bytes, %d s, %u kbit/s, %s, data at %u, opened in %u ms",
+          _total, duration(), _first.bitrate, _hasToc ? "TOC" : "no TOC", _dataStart, millis() - t0);
+    return true;
+}
+
+
+void EpisodeStream::close()
+{
+    if (_open) _http.end();
+    _open = false;
+    _connected = false;
+    _stream = nullptr;
+}
+
+
+/**
+ * GET from the byte from on. A server that ignores Range
+ * answers 200, then the bytes before are read and dropped.
+ */
+bool EpisodeStream::connect(uint32_t from)
+{
+    uint32_t t0 = millis();
+    _connected = false;
+    int code = httpOpen(_http, _plain, _secure, _location, sizeof(_location), from);
+    if (code != 200 && code != 206 && code != 416 && strcmp(_location, _url) != 0)
+    {
+        strlcpy(_location, _url, sizeof(_location));
+        code = httpOpen(_http, _plain, _secure, _location, sizeof(_location), from);
+    }
+    if (code == 416)                    // nothing after from
+    {
+        _finished = true;
+        return false;
+    }
+    if (code != 200 && code != 206)
+    {
+        log_e("HTTP %d for %s", code, _location);
+        _failures++;
+        return false;
+    }
+    _stream = _http.getStreamPtr();
+    _connected = true;
+    _msLastData = millis();
+    if (code == 206)
+    {
+        String range = _http.header("Content-Range");       // bytes a-b/total
+        const char *slash = strchr(range.c_str(), '/');
+        if (slash && slash[1] != '*') _total = strtoul(slash + 1, nullptr, 10);
+    }
+    else
+    {
+        if (_http.getSize() > 0) _total = _http.getSize();
+        if (from > 0)
+        {
+            log_w("No Range support, reading %u bytes", from);
+            if (!skip(from)) return false;
+        }
+    }
+    _msConnectLast = millis() - t0;
+    if (_msConnectLast > _msConnectMax) _msConnectMax = _msConnectLast;
+    return true;
+}
+
+
+/**
+ * Read exactly len bytes, waits up to PODCAST_TIMEOUT for each piece
+ */
+bool EpisodeStream::readFully(uint8_t *buf, int len)
+{
+    uint32_t msData = millis();
+    while (len > 0)
+    {
+        int n = _stream->available();
+        if (n > 0 && (n = _stream->read(buf, min(n, len))) > 0)
+        {
+            buf += n;
+            len -= n;
+            msData = millis();
+            continue;
+        }
+        if (!_stream->connected() || millis() - msData > PODCAST_TIMEOUT) return false;
+        delay(1);
+    }
+    return true;
+}
+
+
+bool EpisodeStream::skip(uint32_t bytes)
+{
+    uint8_t buf[256];
+    while (bytes > 0)
+    {
+        int n = min(bytes, (uint32_t)sizeof(buf));
+        if (!readFully(buf, n)) return false;
+        bytes -= n;
+    }
+    return true;
+}
+
+
+/**
+ * Find the first frame after the ID3 tag and read its Xing or
+ * VBRI header. The bytes read stay in _head for the decoder.
+ */
+bool EpisodeStream::probe()
+{
+    uint8_t id3[10];
+    if (!readFully(id3, sizeof(id3))) return false;
+    uint32_t start = 0;
+    if (memcmp(id3, "ID3", 3) == 0)
+    {
+        start = 10 + ((id3[6] & 0x7F) << 21 | (id3[7] & 0x7F) << 14 | (id3[8] & 0x7F) << 7 | (id3[9] & 0x7F));
+        if (id3[5] & 0x10) start += 10;     // footer
+        if (start > EPISODE_SKIP_MAX && _http.header("Accept-Ranges") == "bytes")
+        {
+            if (!connect(start)) return false;
+        }
+        else if (!skip(start - sizeof(id3))) return false;
+        _headLen = 0;
+    }
+    else
+    {
+        memcpy(_head, id3, sizeof(id3));
+        _headLen = sizeof(id3);
+    }
+
+    int want = EPISODE_HEAD_LEN;
+    if (_total) want = min((uint32_t)want, _total - start);
+    if (want > _headLen && !readFully(_head + _headLen, want - _headLen)) return false;
+    _headLen = want;
+    _headPos = 0;
+    _pos = start;
+    _scanner.reset(start);
+
+    int i = 0;
+    while (i + 4 <= _headLen && !parseMp3Header(_head + i, _first)) i++;
+    if (i + 4 > _headLen)
+    {
+        log_e("No MPEG audio frame");
+        return false;
+    }
+    _dataStart = start + i;
+    parseXing(_head + i, _headLen - i, _first);
+    if (_frames == 0) parseVbri(_head + i, _headLen - i);
+    return true;
+}
+
+
+/**
+ * Xing (VBR) or Info (CBR) header in the side information of
+ * the first frame: number of frames, bytes and the table of
+ * contents, 100 bytes of 1/256 of the file.
+ */
+void EpisodeStream::parseXing(const uint8_t *frame, int len, const Mp3Frame &f)
+{
+    int p = 4 + f.sideInfo;
+    if (p + 8 > len || (memcmp(frame + p, "Xing", 4) != 0 && memcmp(frame + p, "Info", 4) != 0)) return;
+    uint32_t flags = be32(frame + p + 4);
+    uint32_t bytes = _total ? _total - _dataStart : 0;
+    p += 8;
+    if ((flags & 1) && p + 4 <= len) { _frames = be32(frame + p); p += 4; }
+    if ((flags & 2) && p + 4 <= len) { bytes = be32(frame + p); p += 4; }
+    if ((flags & 4) && p + EPISODE_TOC_LEN <= len && bytes > 0)
+    {
+        for (int i = 0; i < EPISODE_TOC_LEN; i++) _toc[i] = (uint64_t)frame[p + i] * bytes / 256;
+        _hasToc = true;
+    }
+}
+
+
+/**
+ * VBRI header of the Fraunhofer encoder, 32 bytes after the frame
+ * header: a table of the bytes of every framesPerEntry frames,
+ * converted to the same 100 points as the Xing table
+ */
+void EpisodeStream::parseVbri(const uint8_t *frame, int len)
+{
+    const int p = 4 + 32;
+    if (p + 26 > len || memcmp(frame + p, "VBRI", 4) != 0) return;
+    _frames = be32(frame + p + 14);
+    int entries = be16(frame + p + 18);
+    uint32_t scale = be16(frame + p + 20);
+    int size = be16(frame + p + 22);
+    uint32_t framesPerEntry = be16(frame + p + 24);
+    const uint8_t *table = frame + p + 26;
+    if (entries == 0 || size < 1 || size > 4 || framesPerEntry == 0 || 26 + entries * size > len - p) return;
+
+    auto entry = [&](int k) { uint32_t v = 0; for (int b = 0; b < size; b++) v = v << 8 | table[k * size + b]; return v * scale; };
+    uint32_t offset = 0;
+    int k = 0;
+    for (int i = 0; i < EPISODE_TOC_LEN; i++)
+    {
+        uint32_t f = (uint64_t)i * _frames / EPISODE_TOC_LEN;
+        while (k < entries - 1 && (k + 1) * framesPerEntry <= f)
+        {
+            offset += entry(k);
+            k++;
+        }
+        _toc[i] = offset + (uint64_t)entry(k) * min(f - k * framesPerEntry, framesPerEntry) / framesPerEntry;
+    }
+    _hasToc = true;
+}
+
+
+/**
+ * Index the played frames, an entry every EPISODE_INDEX_STEP
+ * seconds as long as the played part has no gap
+ */
+void EpisodeStream::onFrame(uint32_t pos, const Mp3Frame &frame, void *arg)
+{
+    EpisodeStream *e = static_cast<EpisodeStream *>(arg);
+    if (e->_contiguous && e->_indexed < EPISODE_INDEX_LEN &&
+        e->_usStream >= (uint64_t)e->_indexed * EPISODE_INDEX_STEP * 1000000)
+    {
+        e->_index[e->_indexed++] = pos;
+    }
+    e->_usStream += (uint64_t)frame.samples * 1000000 / frame.sampleRate;
+}
+
+
+/**
+ * Check the connection, resume it if it was dropped or has stalled.
+ * Returns true if data can be read.
+ */
+bool EpisodeStream::poll()
+{
+    if (!_open || _finished) return false;
+    uint32_t ms = millis();
+    if (ms - _msLastCall > EPISODE_STALL_MS / 2) _msLastData = ms;     // paused, the server had no reason to send
+    _msLastCall = ms;
+    if (!_connected) return resume();
+    if (_stream->available() > 0) return true;
+    bool stalled = ms - _msLastData > EPISODE_STALL_MS;
+    if (_stream->connected() && !stalled) return false;
+    _connected = false;
+    if (_total && _pos >= _total)
+    {
+        _finished = true;
+        log_i("Episode finished");
+        return false;
+    }
+    if (stalled) _stalls++;
+    return resume();
+}
+
+
+/**
+ * Continue at the next byte for the decoder, at most once
+ * every EPISODE_RETRY_MS
+ */
+bool EpisodeStream::resume()
+{
+    uint32_t ms = millis();
+    if (ms - _msRetry < EPISODE_RETRY_MS) return false;
+    _msRetry = ms;
+    _resumes++;
+    log_w("Resume at %u of %u", _pos, _total);
+    return connect(_pos);
+}
+
+
+int EpisodeStream::available()
+{
+    if (_headPos < _headLen) return _headLen - _headPos;
+    return poll() ? _stream->available() : 0;
+}
+
+
+size_t EpisodeStream::readBytes(uint8_t *data, size_t len)
+{
+    int n = 0;
+    if (_headPos < _headLen)
+    {
+        n = min((int)len, _headLen - _headPos);
+        memcpy(data, _head + _headPos, n);
+        _headPos += n;
+    }
+    else if (poll())
+    {
+        n = _stream->read(data, min((int)len, _stream->available()));
+        if (n < 0) n = 0;
+    }
+    if (n == 0) return 0;
+
+    uint32_t ms = millis();
+    if (_msSeek)
+    {
+        _msSeekLast = ms - _msSeek;
+        if (_msSeekLast > _msSeekMax) _msSeekMax = _msSeekLast;
+        _msSeek = 0;
+    }
+    _msLastData = ms;
+    _pos += n;
+    _bytes += n;
+    _scanner.feed(data, n, onFrame, this);
+    return n;
+}
+
+
+/**
+ * Byte offset of a time: from the index of the played part, the
+ * table of contents or the bitrate of the first frame
+ */
+uint32_t EpisodeStream::offsetOf(int seconds)
+{
+    int entry = seconds / EPISODE_INDEX_STEP;
+    if (entry < _indexed) return _index[entry];
+    int d = duration();
+    if (_hasToc && d > 0)
+    {
+        float percent = min(seconds * 100.0f / d, 99.99f);
+        int i = percent;
+        uint32_t a = _toc[i];
+        uint32_t b = i + 1 < EPISODE_TOC_LEN ? _toc[i + 1] : (_total ? _total - _dataStart : a);
+        return _dataStart + a + (uint32_t)((b - a) * (percent - i));
+    }
+    return _dataStart + (uint32_t)seconds * _first.bitrate * 125;
+}
+
+
+/**
+ * Continue playing at a time with a Range request, the decoder
+ * finds the next frame. The latency is measured to the first byte.
+ */
+bool EpisodeStream::seek(int seconds)
+{
+    if (!_open) return false;
+    seconds = constrain(seconds, 0, max(duration() - 1, 0));
+    int entry = seconds / EPISODE_INDEX_STEP;
+    uint32_t offset = offsetOf(seconds);
+    _contiguous = entry < _indexed;
+    _usStream = (uint64_t)(_contiguous ? entry * EPISODE_INDEX_STEP : seconds) * 1000000;
+    _headLen = _headPos = 0;
+    _finished = false;
+    _msSeek = millis();
+    _seeks++;
+    _pos = offset;
+    _scanner.reset(offset);
+    if (connect(offset)) return true;
+    _msSeek = 0;
+    return false;
+}
+
+
+bool EpisodeStream::isOpen()
+{
+    return _open;
+}
+
+bool EpisodeStream::isFinished()
+{
+    return _finished;
+}
+
+int EpisodeStream::position()
+{
+    return _usStream / 1000000;
+}
+
+
+// From the number of frames if known, else from the size and the bitrate
+int EpisodeStream::duration()
+{
+    if (_frames > 0 && _first.sampleRate > 0) return (uint64_t)_frames * _first.samples / _first.sampleRate;
+    if (_total > _dataStart && _first.bitrate > 0) return (_total - _dataStart) / (_first.bitrate * 125);
+    return 0;
+}
+
+uint32_t EpisodeStream::msSeekLast()
+{
+    return _msSeekLast;
+}
+
+
+void EpisodeStream::printStats()
+{
+    if (!_open && _bytes == 0) return;
+    log_i("Episode: %d of %d s, %u bytes, connect last %u ms (max %u ms), %u seeks (last %u ms, max %u ms), "
+          "index %d s, %u resumes, %u stalls, %u failures",
+          position(), duration(), _bytes, _msConnectLast, _msConnectMax, _seeks, _msSeekLast, _msSeekMax,
+          _indexed * EPISODE_INDEX_STEP, _resumes, _stalls, _failures);
+}
+
+
+void EpisodeStream::resetStats()
+{
+    _bytes = 0;
+    _msConnectMax = 0;
+    _seeks = 0;
+    _msSeekMax = 0;
+    _resumes = 0;
+    _stalls = 0;
+    _failures = 0;
+}
@@ -0,0 +1,192 @@
+/**
+ * Header       Podcast.h
+ *
+ * Purpose      Declaration of the classes PodcastFeed and EpisodeStream,
+ *              on-demand MP3 episodes besides the live stations.
+ *              PodcastFeed
+ *              - Reads an RSS feed with the streaming XmlReader while it
+ *                downloads. Only the first PODCAST_EPISODES items with an
+ *                MP3 enclosure are kept, the newest, then the download is
+ *                closed, the rest of the feed is never read.
+ *              - GET /api/episodes lists them. The list is copied by the
+ *                handler and checked with a sequence number like the
+ *                status of the RestApi, load() runs in loop().
+ *              EpisodeStream
+ *              - The source of the copier for an episode. An ID3 tag at
+ *                the start is skipped with a Range request when it is
+ *                large, e.g. cover art.
+ *              - The first frame is read ahead for a Xing or VBRI header.
+ *                Their table of contents gives the byte offset of a time,
+ *                a seek is one Range request. Without one the bitrate of
+ *                the first frame is used.
+ *              - Every EPISODE_INDEX_STEP seconds played, the offset of
+ *                the frame is kept, a seek back into the played part is
+ *                exact also for VBR files without a table.
+ *              - A dropped or stalled connection is resumed with a Range
+ *                request at the next byte, also after a long pause.
+ *              Connect time, seek latency, resumes and stalls are logged.
+ *
+ * Usage        PodcastFeed feed;
+ *              EpisodeStream episode;
+ *              feed.begin(server);
+ *              feed.load("https://example.com/feed.xml");
+ *              episode.open(feed.episode(0).url);
+ *              copier.begin(timeshift, episode);
+ *              episode.seek(600);
+ *
+ * Remarks      The files are requested with HTTP/1.0, so the servers send
+ *              them without chunked encoding. Certificates are not
+ *              checked, like for the stations.
+ */
+#pragma once
+#include <Arduino.h>
+#include <AudioTools.h>
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+#include <ESPAsyncWebServer.h>
+#include <atomic>
+#include "XmlReader.h"
+#include "JsonWriter.h"
+#include "Mp3Frame.h"
+
+const int PODCAST_EPISODES    = 20;
+const int PODCAST_TITLE_LEN   = 96;         // UTF-8
+const int PODCAST_URL_LEN     = XML_TEXT_LEN;
+const int PODCAST_REDIRECTS   = 5;
+const int PODCAST_TIMEOUT     = 5000;       // ms for a connect or a read
+const int PODCAST_JSON_SIZE   = 4096;
+
+const int EPISODE_HEAD_LEN    = 512;        // bytes read ahead for the Xing or VBRI header
+const int EPISODE_SKIP_MAX    = 65536;      // an ID3 tag up to this size is read, a larger one skipped
+const int EPISODE_INDEX_LEN   = 2048;
+const int EPISODE_INDEX_STEP  = 5;          // seconds per entry, 2048 entries are 2.8 hours
+const int EPISODE_TOC_LEN     = 100;        // points of the table of contents, percent of the time
+const int EPISODE_STALL_MS    = 5000;       // no data for this time while playing is a stall
+const int EPISODE_RETRY_MS    = 1000;       // between two resume attempts
+
+// GET with the redirects followed, url is replaced by the final URL, also used by HlsStream
+int httpOpen(HTTPClient &http, WiFiClient &plain, WiFiClientSecure &secure, char *url, int size, uint32_t from=0);
+
+struct PodcastEpisode
+{
+    char     title[PODCAST_TITLE_LEN];
+    char     url[PODCAST_URL_LEN];
+    uint32_t bytes;                         // length of the enclosure, 0 = unknown
+    uint32_t seconds;                       // itunes:duration, 0 = unknown
+};
+
+
+class PodcastFeed
+{
+    public:
+        void begin(AsyncWebServer &server);
+        bool load(const char *url);
+        int  count();
+        const PodcastEpisode &episode(int index);
+        const char *title();
+
+        void printStats();
+        void resetStats();
+
+    private:
+        static void onXml(XmlEvent event, const char *name, const char *value, void *arg);
+        void episodes(AsyncWebServerRequest *request);
+
+        HTTPClient _http;
+        WiFiClient _plain;
+        WiFiClientSecure _secure;
+        XmlReader _xml;
+        char _url[PODCAST_URL_LEN];
+        char _title[PODCAST_TITLE_LEN];
+        PodcastEpisode _episodes[PODCAST_EPISODES];
+        int  _count = 0;
+
+        // the item being read
+        PodcastEpisode _item;
+        bool _inItem = false;
+        bool _inEnclosure = false;
+        bool _mp3 = false;
+
+        std::atomic<uint32_t> _seq{0};      // odd while load() writes the list
+        char _buf[PODCAST_JSON_SIZE];
+        JsonWriter _json{_buf, sizeof(_buf)};
+
+        uint32_t _loads = 0;
+        uint32_t _bytes = 0;
+        uint32_t _msLoadLast = 0;
+        uint32_t _requests = 0;
+};
+
+
+class EpisodeStream : public AudioStream
+{
+    public:
+        bool open(const char *url);
+        void close();
+        size_t readBytes(uint8_t *data, size_t len) override;
+        int available() override;
+        bool seek(int seconds);
+
+        bool isOpen();
+        bool isFinished();
+        int  position();
+        int  duration();
+        uint32_t msSeekLast();
+        void printStats();
+        void resetStats();
+
+    private:
+        bool connect(uint32_t from);
+        bool poll();
+        bool resume();
+        bool readFully(uint8_t *buf, int len);
+        bool skip(uint32_t bytes);
+        bool probe();
+        void parseXing(const uint8_t *frame, int len, const Mp3Frame &f);
+        void parseVbri(const uint8_t *frame, int len);
+        uint32_t offsetOf(int seconds);
+        static void onFrame(uint32_t pos, const Mp3Frame &frame, void *arg);
+
+        HTTPClient _http;
+        WiFiClient _plain;
+        WiFiClientSecure _secure;
+        WiFiClient *_stream = nullptr;
+        char _url[PODCAST_URL_LEN];         // of the feed
+        char _location[PODCAST_URL_LEN];    // after the redirects, used for the Range requests
+        bool _open = false;
+        bool _connected = false;
+        bool _finished = false;
+
+        uint32_t _pos = 0;                  // file offset of the next byte for the decoder
+        uint32_t _total = 0;                // file size, 0 = unknown
+        uint32_t _dataStart = 0;            // first frame, after the ID3 tag
+        uint8_t  _head[EPISODE_HEAD_LEN];   // read ahead, given to the decoder first
+        int      _headLen = 0;
+        int      _headPos = 0;
+
+        // time
+        Mp3Frame _first = {};
+        uint32_t _frames = 0;               // from the Xing or VBRI header, 0 = unknown
+        uint32_t _toc[EPISODE_TOC_LEN];     // byte offset after _dataStart at every percent
+        bool     _hasToc = false;
+        Mp3Scanner _scanner;
+        uint32_t _index[EPISODE_INDEX_LEN]; // file offset every EPISODE_INDEX_STEP seconds
+        int      _indexed = 0;
+        bool     _contiguous = true;        // played from the start or from an index entry
+        uint64_t _usStream = 0;             // time of the next frame
+
+        uint32_t _msLastData = 0;
+        uint32_t _msLastCall = 0;
+        uint32_t _msRetry = 0;
+        uint32_t _msSeek = 0;               // start of a seek, 0 = none
+
+        uint32_t _bytes = 0;
+        uint32_t _msConnectLast = 0;
+        uint32_t _msConnectMax = 0;
+        uint32_t _seeks = 0;
+        uint32_t _msSeekLast = 0;
+        uint32_t _msSeekMax = 0;
+        uint32_t _resumes = 0;
+        uint32_t _stalls = 0;
+        uint32_t _failures = 0;
+};
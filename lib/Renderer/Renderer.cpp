@@ -0,0 +1,318 @@
+/**
+ * Class        Implementation of the class methods of Renderer
+ * 
+ * Purpose      A single task owns the display. Commands from other tasks 
+ *              are queued without heap allocation and executed in batches 
+ *              once per frame tick. Frame hooks are called after the queued
+ *              commands of each frame and are used for animations.
+ * 
+ * Remarks      Commands submitted by the render task itself (e.g. from a 
+ *              called function or a frame hook) are executed immediately.
+ *              Producers never block: when the queue is full, the command
+ *              is dropped and counted.
+ */
+#include "Renderer.h"
+
+
+void Renderer::begin(UBaseType_t priority, BaseType_t core)
+{
+    _queue = xQueueCreateStatic(RENDER_QUEUE_LEN, sizeof(RenderCmd), _queueStorage, &_queueCtrl);
+    xTaskCreatePinnedToCore(task, "render", 6144, this, priority, &_task, core);
+    log_i("==> done");
+}
+
+
+void Renderer::task(void *arg)
+{
+    static_cast<Renderer *>(arg)->run();
+}
+
+
+/**
+ * Wait for the next frame tick, then execute the commands that are 
+ * pending at this moment and the frame hooks in one SPI transaction.
+ * Commands arriving during the frame are left for the next one.
+ */
+void Renderer::run()
+{
+    RenderCmd cmd;
+    TickType_t lastWake = xTaskGetTickCount();
+
+    for (;;)
+    {
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(_msFrame));
+
+        int depth = uxQueueMessagesWaiting(_queue);
+        if (depth > _highWater) _highWater = depth;
+        if (depth == 0 && _nHooks == 0) continue;
+
+        uint32_t t0 = micros();
+        _lcd.startWrite();
+        for (; depth > 0 && xQueueReceive(_queue, &cmd, 0) == pdTRUE; depth--) { execute(cmd); }
+        for (int i = 0; i < _nHooks; i++) { _hooks[i].fn(_lcd, 0, 0, _hooks[i].arg); }
+        _lcd.endWrite();
+
+        _usFrameLast = micros() - t0;
+        if (_usFrameLast > _usFrameMax) _usFrameMax = _usFrameLast;
+        _frames++;
+    }
+}
+
+
+void Renderer::execute(RenderCmd &cmd)
+{
+    switch (cmd.op)
+    {
+        case RenderOp::FillRect:
+            _lcd.fillRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.color);
+        break;
+
+        case RenderOp::DrawText:
+            if (cmd.font) _lcd.setFont(cmd.font);
+            _lcd.setTextDatum((textdatum_t)cmd.datum);
+            cmd.opaque ? _lcd.setTextColor(cmd.color, cmd.bgColor) : _lcd.setTextColor(cmd.color);
+            _lcd.drawString(cmd.text, cmd.x, cmd.y);
+        break;
+
+        case RenderOp::PushImage:
+            _lcd.pushImage(cmd.x, cmd.y, cmd.w, cmd.h, (const lgfx::swap565_t *)cmd.pixels);
+        break;
+
+        case RenderOp::Print:
+            if (cmd.font) _lcd.setFont(cmd.font);
+            _lcd.print(cmd.text);
+        break;
+
+        case RenderOp::Call:
+            cmd.fn(_lcd, cmd.x, cmd.y, cmd.arg);
+        break;
+
+        case RenderOp::CallText:
+            cmd.textFn(_lcd, cmd.x, cmd.y, cmd.text, cmd.arg);
+        break;
+    }
+    if (cmd.notify) xTaskNotifyGive(cmd.notify);
+}
+
+
+/**
+ * Queue a command. Before begin() and on the render 
+ * task itself the command is executed immediately.
+ */
+bool Renderer::submit(RenderCmd &cmd, TickType_t wait)
+{
+    if (_queue == nullptr || isRenderTask())
+    {
+        cmd.notify = nullptr;
+        execute(cmd);
+        return true;
+    }
+    if (xQueueSend(_queue, &cmd, wait) != pdTRUE)
+    {
+        _dropped++;
+        return false;
+    }
+    return true;
+}
+
+
+bool Renderer::fillRect(int x, int y, int w, int h, uint32_t color)
+{
+    RenderCmd cmd;
+    cmd.op = RenderOp::FillRect;
+    cmd.x = x;  cmd.y = y;  cmd.w = w;  cmd.h = h;
+    cmd.color = color;
+    cmd.notify = nullptr;
+    return submit(cmd);
+}
+
+
+bool Renderer::drawText(int x, int y, const char *text, uint32_t color, const GFXfont *font, textdatum_t datum)
+{
+    return drawText(x, y, text, color, color, font, datum);
+}
+
+
+/**
+ * Draw a text. If bgColor differs from color, the background 
+ * of the text is filled, otherwise the text is transparent. 
+ * Texts longer than RENDER_TEXT_LEN-1 are truncated.
+ */
+bool Renderer::drawText(int x, int y, const char *text, uint32_t color, uint32_t bgColor, const GFXfont *font, textdatum_t datum)
+{
+    RenderCmd cmd;
+    cmd.op = RenderOp::DrawText;
+    cmd.datum = (uint8_t)datum;
+    cmd.opaque = (bgColor != color);
+    cmd.x = x;  cmd.y = y;
+    cmd.color = color;
+    cmd.bgColor = bgColor;
+    cmd.font = font;
+    cmd.notify = nullptr;
+    strlcpy(cmd.text, text, sizeof(cmd.text));
+    return submit(cmd);
+}
+
+
+/**
+ * Push a block of swapped RGB565 pixels. The pixels are not
+ * copied and must remain valid until the frame is drawn.
+ */
+bool Renderer::pushImage(int x, int y, int w, int h, const uint16_t *pixels)
+{
+    RenderCmd cmd;
+    cmd.op = RenderOp::PushImage;
+    cmd.x = x;  cmd.y = y;  cmd.w = w;  cmd.h = h;
+    cmd.pixels = pixels;
+    cmd.notify = nullptr;
+    return submit(cmd);
+}
+
+
+/**
+ * Print formatted text at the cursor position 
+ * of the display with the current font
+ */
+bool Renderer::printf(const char *format, ...)
+{
+    RenderCmd cmd;
+    va_list args;
+    va_start(args, format);
+    vsnprintf(cmd.text, sizeof(cmd.text), format, args);
+    va_end(args);
+    cmd.op = RenderOp::Print;
+    cmd.font = nullptr;
+    cmd.notify = nullptr;
+    return submit(cmd);
+}
+
+
+/**
+ * Execute fn(lcd, x, y, arg) on the render task
+ */
+bool Renderer::call(RenderFn fn, int x, int y, void *arg)
+{
+    RenderCmd cmd;
+    cmd.op = RenderOp::Call;
+    cmd.x = x;  cmd.y = y;
+    cmd.fn = fn;
+    cmd.arg = arg;
+    cmd.notify = nullptr;
+    return submit(cmd);
+}
+
+
+/**
+ * Execute fn(lcd, x, y, arg) on the render task and wait until it 
+ * is done. Returns false if it did not complete within timeout.
+ */
+bool Renderer::callAndWait(RenderFn fn, int x, int y, void *arg, TickType_t timeout)
+{
+    RenderCmd cmd;
+    cmd.op = RenderOp::Call;
+    cmd.x = x;  cmd.y = y;
+    cmd.fn = fn;
+    cmd.arg = arg;
+    cmd.notify = xTaskGetCurrentTaskHandle();
+    if (!submit(cmd, timeout)) return false;
+    return (_queue == nullptr || isRenderTask()) ? true : ulTaskNotifyTake(pdTRUE, timeout) > 0;
+}
+
+
+/**
+ * Execute fn(lcd, x, y, text, arg) on the render task with 
+ * a copy of text, truncated to RENDER_TEXT_LEN-1 bytes
+ */
+bool Renderer::callText(RenderTextFn fn, int x, int y, const char *text, void *arg)
+{
+    RenderCmd cmd;
+    cmd.op = RenderOp::CallText;
+    cmd.x = x;  cmd.y = y;
+    cmd.textFn = fn;
+    cmd.arg = arg;
+    strlcpy(cmd.text, text, sizeof(cmd.text));
+    cmd.notify = nullptr;
+    return submit(cmd);
+}
+
+
+/**
+ * Register a function that is called on every frame tick
+ */
+bool Renderer::addFrameHook(RenderFn fn, void *arg)
+{
+    if (_nHooks == RENDER_MAX_HOOKS) return false;
+    _hooks[_nHooks].fn  = fn;
+    _hooks[_nHooks].arg = arg;
+    _nHooks++;
+    return true;
+}
+
+
+bool Renderer::isRenderTask()
+{
+    return xTaskGetCurrentTaskHandle() == _task;
+}
+
+
+void Renderer::setFrameInterval(uint32_t ms)
+{
+    _msFrame = ms;
+}
+
+
+uint32_t Renderer::frameInterval()
+{
+    return _msFrame;
+}
+
+
+int Renderer::queueDepth()
+{
+    return _queue ? uxQueueMessagesWaiting(_queue) : 0;
+}
+
+
+int Renderer::queueHighWater()
+{
+    return _highWater;
+}
+
+
+uint32_t Renderer::usFrameLast()
+{
+    return _usFrameLast;
+}
+
+
+uint32_t Renderer::usFrameMax()
+{
+    return _usFrameMax;
+}
+
+
+uint32_t Renderer::frames()
+{
+    return _frames;
+}
+
+
+uint32_t Renderer::dropped()
+{
+    return _dropped;
+}
+
+
+void Renderer::printStats()
+{
+    log_i("frames %lu, frame time %lu us (max %lu us), queue %d (max %d of %d), dropped %lu", 
+          _frames, _usFrameLast, _usFrameMax, queueDepth(), _highWater, RENDER_QUEUE_LEN, _dropped);
+}
+
+
+void Renderer::resetStats()
+{
+    _usFrameMax = 0;
+    _highWater = 0;
+    _dropped = 0;
+}
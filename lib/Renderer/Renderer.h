@@ -0,0 +1,105 @@
+/**
+ * Header       Renderer.h
+ * 
+ * Purpose      Declaration of the class Renderer, a FreeRTOS task that is 
+ *              the only owner of the LGFX device. Other tasks submit compact
+ *              draw commands (fill-rect, draw-text, push-image, print or a 
+ *              call of a function that draws) into a statically allocated 
+ *              queue. The task drains the queue once per frame tick inside
+ *              a single SPI transaction.
+ * 
+ * Usage        Renderer renderer(lcd);
+ *              renderer.begin();
+ *              renderer.fillRect(0, 65, 320, 50, TFT_SILVER);
+ *              renderer.drawText(5, 83, "Composer", TFT_MAROON, &Calibri12pt8b);
+ *              renderer.call([](LGFX &lcd, int x, int y, void *arg) { ... }, x, y);
+ */
+#pragma once
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include "lgfx_esp32-2432S028.h"
+
+const int RENDER_QUEUE_LEN = 24;  // max number of pending commands
+const int RENDER_TEXT_LEN  = 128; // max length of a text incl. '\0'
+const int RENDER_MAX_HOOKS = 6;   // max number of frame hooks
+
+// Function executed on the render task with exclusive access to the display
+using RenderFn = void(*)(LGFX &lcd, int x, int y, void *arg);
+// Same with a copy of a text, e.g. for text drawn with a font of its own
+using RenderTextFn = void(*)(LGFX &lcd, int x, int y, const char *text, void *arg);
+
+enum class RenderOp : uint8_t { FillRect, DrawText, PushImage, Print, Call, CallText };
+
+struct RenderCmd
+{
+    RenderOp op;
+    uint8_t  datum;        // textdatum_t of DrawText
+    bool     opaque;       // DrawText fills the text background with bgColor
+    int16_t  x, y, w, h;
+    uint32_t color;
+    uint32_t bgColor;
+    union
+    {
+        const GFXfont  *font;   // DrawText, Print (nullptr = keep current font)
+        const uint16_t *pixels; // PushImage, swapped RGB565, must stay valid until drawn
+        RenderFn        fn;     // Call
+        RenderTextFn    textFn; // CallText
+    };
+    void *arg;                  // Call, CallText
+    TaskHandle_t notify;        // task to notify when the command is done
+    char text[RENDER_TEXT_LEN]; // DrawText, Print, CallText
+};
+
+class Renderer
+{
+    public:
+        Renderer(LGFX &lcd, uint32_t msFrame=20) : _lcd(lcd), _msFrame(msFrame) 
+        {}
+
+        void begin(UBaseType_t priority=2, BaseType_t core=0);
+        bool fillRect(int x, int y, int w, int h, uint32_t color);
+        bool drawText(int x, int y, const char *text, uint32_t color, const GFXfont *font, 
+                      textdatum_t datum=textdatum_t::middle_left);
+        bool drawText(int x, int y, const char *text, uint32_t color, uint32_t bgColor, const GFXfont *font, 
+                      textdatum_t datum=textdatum_t::middle_left);
+        bool pushImage(int x, int y, int w, int h, const uint16_t *pixels);
+        bool printf(const char *format, ...);
+        bool call(RenderFn fn, int x=0, int y=0, void *arg=nullptr);
+        bool callAndWait(RenderFn fn, int x=0, int y=0, void *arg=nullptr, TickType_t timeout=portMAX_DELAY);
+        bool callText(RenderTextFn fn, int x, int y, const char *text, void *arg=nullptr);
+        bool addFrameHook(RenderFn fn, void *arg=nullptr);
+        bool isRenderTask();
+        void setFrameInterval(uint32_t ms);
+        uint32_t frameInterval();
+
+        int      queueDepth();
+        int      queueHighWater();
+        uint32_t usFrameLast();
+        uint32_t usFrameMax();
+        uint32_t frames();
+        uint32_t dropped();
+        void     printStats();
+        void     resetStats();
+
+    private:
+        static void task(void *arg);
+        void run();
+        bool submit(RenderCmd &cmd, TickType_t wait=0);
+        void execute(RenderCmd &cmd);
+
+        LGFX &_lcd;
+        volatile uint32_t _msFrame;
+        TaskHandle_t  _task = nullptr;
+        QueueHandle_t _queue = nullptr;
+        StaticQueue_t _queueCtrl;
+        uint8_t       _queueStorage[RENDER_QUEUE_LEN * sizeof(RenderCmd)];
+
+        struct { RenderFn fn; void *arg; } _hooks[RENDER_MAX_HOOKS];
+        int _nHooks = 0;
+
+        int      _highWater = 0;
+        uint32_t _usFrameLast = 0;
+        uint32_t _usFrameMax = 0;
+        uint32_t _frames = 0;
+        uint32_t _dropped = 0;
+};
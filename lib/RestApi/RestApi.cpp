@@ -0,0 +1,268 @@
+/**
+ * Class        Implementation of the class methods of RestApi
+ *
+ * Purpose      The network asks, loop() decides: a request only queues a
+ *              command, the player applies it between two audio copies.
+ *
+ * Remarks      The answer is copied by request->send(), so the one JSON
+ *              buffer serves all requests of the async TCP task.
+ *              Parameters are taken from the query or a form body.
+ */
+#include "RestApi.h"
+
+const int API_STATUS_RETRIES = 8;
+
+
+void RestApi::begin(AsyncWebServer &server)
+{
+    server.on("/api/status",        HTTP_GET,  [this](AsyncWebServerRequest *r) { status(r); });
+    server.on("/api/stations",      HTTP_GET,  [this](AsyncWebServerRequest *r) { stations(r); });
+    server.on("/api/station",       HTTP_POST, [this](AsyncWebServerRequest *r) { command(r, PlayerOp::Station, "id"); });
+    server.on("/api/volume",        HTTP_POST, [this](AsyncWebServerRequest *r) { command(r, PlayerOp::Volume, "value"); });
+    server.on("/api/next",          HTTP_POST, [this](AsyncWebServerRequest *r) { command(r, PlayerOp::Next, nullptr); });
+    server.on("/api/prev",          HTTP_POST, [this](AsyncWebServerRequest *r) { command(r, PlayerOp::Prev, nullptr); });
+    server.on("/api/preset/store",  HTTP_POST, [this](AsyncWebServerRequest *r) { command(r, PlayerOp::Store, nullptr); });
+    server.on("/api/preset/recall", HTTP_POST, [this](AsyncWebServerRequest *r) { command(r, PlayerOp::Recall, nullptr); });
+    server.on("/api/record",        HTTP_POST, [this](AsyncWebServerRequest *r) { command(r, PlayerOp::Record, "on"); });
+    server.on("/api/podcasts",      HTTP_GET,  [this](AsyncWebServerRequest *r) { list(r, _podcastName, _podcasts); });
+    server.on("/api/podcast",       HTTP_POST, [this](AsyncWebServerRequest *r) { command(r, PlayerOp::Podcast, "id"); });
+    server.on("/api/episode",       HTTP_POST, [this](AsyncWebServerRequest *r) { command(r, PlayerOp::Episode, "id"); });
+    server.on("/api/seek",          HTTP_POST, [this](AsyncWebServerRequest *r) { command(r, PlayerOp::Seek, "to"); });
+    log_i("==> done");
+}
+
+
+void RestApi::setPodcasts(StationNameFn podcastName, int podcasts)
+{
+    _podcastName = podcastName;
+    _podcasts = podcasts;
+}
+
+
+/**
+ * Called by loop(), returns false when no command is waiting
+ */
+bool RestApi::getCommand(PlayerCommand &cmd)
+{
+    return _queue.pop(cmd);
+}
+
+
+// Time from the request to the player
+void RestApi::commandDone(const PlayerCommand &cmd)
+{
+    _usQueueLast = micros() - cmd.usQueued;
+    if (_usQueueLast > _usQueueMax) _usQueueMax = _usQueueLast;
+    _applied++;
+}
+
+
+/**
+ * Called by loop() whenever the status changed
+ */
+void RestApi::publish(const PlayerStatus &status)
+{
+    _seq.fetch_add(1, std::memory_order_acq_rel);
+    std::atomic_thread_fence(std::memory_order_release);
+    _status = status;
+    std::atomic_thread_fence(std::memory_order_release);
+    _seq.fetch_add(1, std::memory_order_release);
+}
+
+
+/**
+ * Copy the status, retried while loop() is publishing
+ */
+bool RestApi::readStatus(PlayerStatus &status)
+{
+    for (int i = 0; i < API_STATUS_RETRIES; i++)
+    {
+        uint32_t seq = _seq.load(std::memory_order_acquire);
+        if (seq & 1) continue;
+        status = _status;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_seq.load(std::memory_order_relaxed) == seq) return true;
+    }
+    return false;
+}
+
+
+// Changes with every publish()
+uint32_t RestApi::version()
+{
+    return _seq.load(std::memory_order_acquire);
+}
+
+
+void RestApi::status(AsyncWebServerRequest *request)
+{
+    uint32_t t0 = micros();
+    PlayerStatus s;
+    if (!readStatus(s))
+    {
+        error(request, 503, "status busy", t0);
+        return;
+    }
+    _json.clear();
+    _json.beginObject()
+         .add("station", (int)s.station)
+         .add("name", s.name)
+         .add("stations", _stations)
+         .add("volume", s.volume / 1000.0f)
+         .add("title", s.title)
+         .add("recording", s.recording)
+         .add("podcast", s.podcast)
+         .add("episode", (int)s.episode)
+         .add("position", (int)s.position)
+         .add("duration", (int)s.duration)
+         .add("queued", _queue.size())
+         .endObject();
+    send(request, 200, t0);
+}
+
+
+void RestApi::stations(AsyncWebServerRequest *request)
+{
+    list(request, _stationName, _stations);
+}
+
+
+// The names of the stations or of the podcast feeds
+void RestApi::list(AsyncWebServerRequest *request, StationNameFn name, int count)
+{
+    uint32_t t0 = micros();
+    _json.clear();
+    _json.beginArray();
+    for (int i = 0; i < count; i++)
+    {
+        _json.beginObject().add("id", i).add("name", name(i)).endObject();
+    }
+    _json.endArray();
+    send(request, 200, t0);
+}
+
+
+/**
+ * Check the parameter and queue the command. The answer
+ * only confirms the queueing, the status shows the effect.
+ */
+void RestApi::command(AsyncWebServerRequest *request, PlayerOp op, const char *param)
+{
+    static const char *names[] = { "station", "volume", "next", "prev", "store", "recall", "record",
+                                   "podcast", "episode", "seek" };
+    uint32_t t0 = micros();
+    PlayerCommand cmd;
+    cmd.op = op;
+    cmd.value = 0;
+
+    if (param)
+    {
+        const AsyncWebParameter *p = request->hasParam(param, true) ? request->getParam(param, true)
+                                   : request->hasParam(param) ? request->getParam(param) : nullptr;
+        const char *text = p ? p->value().c_str() : "";
+        char *end;
+        if (op == PlayerOp::Station)
+        {
+            long id = strtol(text, &end, 10);
+            if (end == text || *end || id < 0 || id >= _stations)
+            {
+                error(request, 400, "id out of range", t0);
+                return;
+            }
+            cmd.value = id;
+        }
+        else if (op == PlayerOp::Podcast || op == PlayerOp::Episode || op == PlayerOp::Seek)
+        {
+            long limit = op == PlayerOp::Podcast ? _podcasts : INT16_MAX + 1L;     // the episodes are checked by loop()
+            long v = strtol(text, &end, 10);
+            if (end == text || *end || v < 0 || v >= limit)
+            {
+                error(request, 400, "value out of range", t0);
+                return;
+            }
+            cmd.value = v;
+        }
+        else if (op == PlayerOp::Record)
+        {
+            long on = strtol(text, &end, 10);
+            if (end == text || *end || (on != 0 && on != 1))
+            {
+                error(request, 400, "on must be 0 or 1", t0);
+                return;
+            }
+            cmd.value = on;
+        }
+        else
+        {
+            float volume = strtof(text, &end);
+            if (end == text || *end || !(volume >= 0.0f && volume <= 1.0f))
+            {
+                error(request, 400, "value must be 0..1", t0);
+                return;
+            }
+            cmd.value = lroundf(volume * 1000.0f);
+        }
+    }
+
+    cmd.usQueued = micros();
+    if (!_queue.push(cmd))
+    {
+        _rejected++;
+        error(request, 503, "queue full", t0);
+        return;
+    }
+    int depth = _queue.size();
+    if (depth > _queueHighWater) _queueHighWater = depth;
+
+    _json.clear();
+    _json.beginObject().add("queued", names[(int)op]);
+    if (param) _json.add("value", (int)cmd.value);
+    _json.add("depth", depth).endObject();
+    send(request, 202, t0);
+}
+
+
+void RestApi::send(AsyncWebServerRequest *request, int code, uint32_t usStart)
+{
+    if (!_json.ok())
+    {
+        log_e("Answer does not fit into %d bytes", API_JSON_SIZE);
+        request->send(500, "application/json", "{\"error\":\"answer too long\"}");
+    }
+    else request->send(code, "application/json", _json.c_str());
+
+    uint32_t us = micros() - usStart;
+    _usHandlerSum += us;
+    if (us > _usHandlerMax) _usHandlerMax = us;
+    _requests++;
+}
+
+
+void RestApi::error(AsyncWebServerRequest *request, int code, const char *text, uint32_t usStart)
+{
+    _json.clear();
+    _json.beginObject().add("error", text).endObject();
+    send(request, code, usStart);
+}
+
+
+void RestApi::printStats()
+{
+    if (_requests == 0) return;
+    log_i("API: %u requests, handler avg %u us, max %u us, %u commands applied, queue latency %u us (max %u us), "
+          "queue max %d of %d, rejected %u",
+          _requests, _usHandlerSum / _requests, _usHandlerMax, _applied, _usQueueLast, _usQueueMax,
+          _queueHighWater, API_QUEUE_LEN, _rejected);
+}
+
+
+void RestApi::resetStats()
+{
+    _requests = 0;
+    _usHandlerSum = 0;
+    _usHandlerMax = 0;
+    _usQueueMax = 0;
+    _applied = 0;
+    _queueHighWater = 0;
+    _rejected = 0;
+}
@@ -0,0 +1,158 @@
+/**
+ * Header       RestApi.h
+ *
+ * Purpose      Declaration of the class RestApi, JSON endpoints to control
+ *              the radio from the network.
+ *              GET  /api/status            station, volume, title
+ *              GET  /api/stations          list of the stations
+ *              POST /api/station?id=3      select a station
+ *              POST /api/volume?value=0.4  set the volume 0..1
+ *              POST /api/next, /api/prev   next or previous station
+ *              POST /api/preset/store      store station and volume
+ *              POST /api/preset/recall     recall them
+ *              POST /api/record?on=1       start or stop recording
+ *              GET  /api/podcasts          list of the podcast feeds
+ *              POST /api/podcast?id=0      load a feed, play the newest episode
+ *              POST /api/episode?id=2      play an episode of the feed
+ *              POST /api/seek?to=600       go to a second of the episode
+ *              - The handlers run on the async TCP task. They never touch
+ *                the player, commands are posted to a bounded lock-free
+ *                queue that loop() drains, like the requests of the UI.
+ *                A full queue is answered with 503.
+ *              - loop() publishes the status, the handlers copy it with
+ *                a sequence lock, neither side waits for the other.
+ *              - JSON is written into a preallocated buffer.
+ *              Handler time, queue latency and rejected commands are
+ *              logged, tools/apibench.py measures the request latency
+ *              with concurrent clients.
+ *
+ * Usage        RestApi api(stationName, nbrRadiostations);
+ *              api.begin(server);
+ *              loop() { PlayerCommand cmd;
+ *                       while (api.getCommand(cmd)) { apply(cmd); api.commandDone(cmd); }
+ *                       api.publish(status); }
+ */
+#pragma once
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <atomic>
+#include "JsonWriter.h"
+
+const int API_QUEUE_LEN = 8;        // power of two
+const int API_JSON_SIZE = 2048;     // largest answer, the list of stations
+const int API_NAME_LEN  = 32;
+const int API_TITLE_LEN = 128;
+
+enum class PlayerOp : uint8_t { Station, Volume, Next, Prev, Store, Recall, Record, Podcast, Episode, Seek };
+
+struct PlayerCommand
+{
+    PlayerOp op;
+    int16_t  value;                 // index, volume in per mille, on/off or seconds
+    uint32_t usQueued;
+};
+
+struct PlayerStatus
+{
+    int16_t  station;
+    uint16_t volume;                // per mille
+    char     name[API_NAME_LEN];    // Latin-1
+    char     title[API_TITLE_LEN];  // Latin-1
+    bool     recording;
+    bool     podcast;               // an episode plays instead of the station
+    int16_t  episode;
+    int32_t  position;              // seconds of the episode
+    int32_t  duration;
+};
+
+
+/**
+ * Ring buffer for one producer and one consumer without locks.
+ * All handlers of the web server run on the same task.
+ */
+template <typename T, int N>
+class SpscQueue
+{
+    static_assert((N & (N - 1)) == 0, "N must be a power of two");
+
+    public:
+        bool push(const T &item)
+        {
+            uint32_t head = _head.load(std::memory_order_relaxed);
+            if (head - _tail.load(std::memory_order_acquire) == N) return false;
+            _items[head & (N - 1)] = item;
+            _head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool pop(T &item)
+        {
+            uint32_t tail = _tail.load(std::memory_order_relaxed);
+            if (tail == _head.load(std::memory_order_acquire)) return false;
+            item = _items[tail & (N - 1)];
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        int size()
+        {
+            return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+        }
+
+    private:
+        T _items[N];
+        std::atomic<uint32_t> _head{0};
+        std::atomic<uint32_t> _tail{0};
+};
+
+
+// Returns the name of a station
+using StationNameFn = const char *(*)(int index);
+
+class RestApi
+{
+    public:
+        RestApi(StationNameFn stationName, int stations) : _stationName(stationName), _stations(stations)
+        {}
+
+        void begin(AsyncWebServer &server);
+        void setPodcasts(StationNameFn podcastName, int podcasts);
+        bool getCommand(PlayerCommand &cmd);
+        void commandDone(const PlayerCommand &cmd);
+        void publish(const PlayerStatus &status);
+        bool readStatus(PlayerStatus &status);
+        uint32_t version();
+
+        void printStats();
+        void resetStats();
+
+    private:
+        void status(AsyncWebServerRequest *request);
+        void stations(AsyncWebServerRequest *request);
+        void list(AsyncWebServerRequest *request, StationNameFn name, int count);
+        void command(AsyncWebServerRequest *request, PlayerOp op, const char *param);
+        void send(AsyncWebServerRequest *request, int code, uint32_t usStart);
+        void error(AsyncWebServerRequest *request, int code, const char *text, uint32_t usStart);
+
+        StationNameFn _stationName;
+        int _stations;
+        StationNameFn _podcastName = nullptr;
+        int _podcasts = 0;
+        SpscQueue<PlayerCommand, API_QUEUE_LEN> _queue;
+
+        // written by loop(), odd sequence = update in progress
+        std::atomic<uint32_t> _seq{0};
+        PlayerStatus _status = {};
+
+        char _buf[API_JSON_SIZE];
+        JsonWriter _json{_buf, sizeof(_buf)};
+
+        uint32_t _requests = 0;
+        uint32_t _usHandlerSum = 0;
+        uint32_t _usHandlerMax = 0;
+        uint32_t _rejected = 0;
+        int      _queueHighWater = 0;
+        uint32_t _applied = 0;
+        uint32_t _usQueueLast = 0;
+        uint32_t _usQueueMax = 0;
+};
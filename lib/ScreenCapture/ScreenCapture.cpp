@@ -0,0 +1,363 @@
+/**
+ * Class        Implementation of the class methods of ScreenCapture
+ *
+ * Purpose      Grab the screen quickly into a compressed buffer on the
+ *              render task, convert and write it in the background.
+ *
+ * Remarks      The capture buffer is allocated by grab() and freed when
+ *              the file is written, screenshots are rare. Only one
+ *              screenshot is in progress at a time.
+ */
+#include "ScreenCapture.h"
+
+
+/**
+ * Start the task that writes the screenshots
+ */
+void ScreenCapture::begin(UBaseType_t priority, BaseType_t core)
+{
+    xTaskCreatePinnedToCore(task, "capture", 4096, this, priority, &_task, core);
+    log_i("==> done");
+}
+
+void ScreenCapture::setBus(SpiArbiter &bus)
+{
+    _bus = &bus;
+}
+
+
+/**
+ * Read and compress the frame buffer. Must run on the render task.
+ * Fails if a screenshot is still being written or the screen
+ * does not compress into the buffer.
+ */
+bool ScreenCapture::grab(UiFrameBuffer &fb)
+{
+    if (_busy.exchange(true))
+    {
+        log_w("Screenshot still being written");
+        return false;
+    }
+    uint32_t t0 = micros();
+    _w = min(fb.width(), CAPTURE_MAX_WIDTH);
+    _h = min(fb.height(), CAPTURE_MAX_HEIGHT);
+    _runs = static_cast<uint8_t *>(malloc(_maxBytes));
+    if (_runs == nullptr)
+    {
+        log_e("No memory for %u bytes", _maxBytes);
+        _failures++;
+        _busy = false;
+        return false;
+    }
+
+    _used = 0;
+    _nColors = 0;
+    memset(_hash, 0xFF, sizeof(_hash));
+    bool ok = true;
+    for (int y = 0; y < _h && ok; y += CAPTURE_BAND_LINES)
+    {
+        int lines = min(CAPTURE_BAND_LINES, _h - y);
+        fb.readRect(0, y, _w, lines, _band);
+        for (int r = 0; r < lines && ok; r++)
+        {
+            _rowStart[y + r] = _used;
+            ok = encodeLine(_band + r * _w, _w);
+        }
+    }
+    _rowStart[_h] = _used;
+    _usGrabLast = micros() - t0;
+
+    if (!ok)
+    {
+        log_w("Screen does not compress into %u bytes", _maxBytes);
+        free(_runs);
+        _runs = nullptr;
+        _failures++;
+        _busy = false;
+        return false;
+    }
+    log_i("Screen grabbed in %u us, %u bytes, %d colors", _usGrabLast, _used, _nColors);
+    return true;
+}
+
+
+/**
+ * Runs of up to 256 equal pixels as (length-1, palette index).
+ * Colors that do not fit into the palette follow index 255.
+ */
+bool ScreenCapture::encodeLine(const uint16_t *line, int w)
+{
+    int i = 0;
+    while (i < w)
+    {
+        uint16_t c = line[i];
+        int n = 1;
+        while (i + n < w && n < 256 && line[i + n] == c) n++;
+        uint8_t idx = colorIndex(c);
+        if (_used + (idx == 255 ? 4 : 2) > _maxBytes) return false;
+        _runs[_used++] = n - 1;
+        _runs[_used++] = idx;
+        if (idx == 255)
+        {
+            _runs[_used++] = c & 0xFF;
+            _runs[_used++] = c >> 8;
+        }
+        i += n;
+    }
+    return true;
+}
+
+
+uint8_t ScreenCapture::colorIndex(uint16_t rgb565)
+{
+    uint8_t h = (rgb565 ^ rgb565 >> 8 ^ rgb565 >> 13) & 0xFF;
+    int i = _hash[h];
+    if (i < _nColors && _palette[i] == rgb565) return i;
+    for (i = 0; i < _nColors; i++)
+    {
+        if (_palette[i] == rgb565) { _hash[h] = i; return i; }
+    }
+    if (_nColors == 255) return 255;
+    _palette[_nColors] = rgb565;
+    _hash[h] = _nColors;
+    return _nColors++;
+}
+
+
+/**
+ * Write the grabbed screen to filename in the background
+ */
+bool ScreenCapture::save(const char *filename, CaptureFormat format)
+{
+    if (_task == nullptr || _runs == nullptr) return false;
+    strlcpy(_filename, filename, sizeof(_filename));
+    _format = format;
+    xTaskNotifyGive(_task);
+    return true;
+}
+
+bool ScreenCapture::isBusy()
+{
+    return _busy;
+}
+
+
+void ScreenCapture::task(void *arg)
+{
+    static_cast<ScreenCapture *>(arg)->run();
+}
+
+
+void ScreenCapture::run()
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint32_t t0 = millis();
+        _bytesWritten = 0;
+        bool ok;
+        {
+            File file;
+            {
+                SpiLease lease(_bus, SpiClient::Sd);
+                file = _fs.open(_filename, FILE_WRITE);
+            }
+            _file = &file;
+            ok = file && encode(_format);
+            _file = nullptr;
+            if (file)
+            {
+                SpiLease lease(_bus, SpiClient::Sd);
+                file.close();
+            }
+        }
+        _msWriteLast = millis() - t0;
+
+        if (ok)
+        {
+            _shots++;
+            log_i("Screenshot %s: %u bytes in %u ms (%u KB/s)", _filename, _bytesWritten, _msWriteLast,
+                  _msWriteLast ? _bytesWritten / _msWriteLast : 0);
+        }
+        else
+        {
+            _failures++;
+            log_e("Screenshot %s failed", _filename);
+        }
+        release();
+    }
+}
+
+
+void ScreenCapture::release()
+{
+    free(_runs);
+    _runs = nullptr;
+    _busy = false;
+}
+
+
+/**
+ * Encode the capture in the given format to the file
+ * or, without a file, just count the bytes
+ */
+bool ScreenCapture::encode(CaptureFormat format)
+{
+    bool ok = true;
+    _fill = 0;
+    switch (format)
+    {
+        case CaptureFormat::Bmp24:
+            ok = writeBmp(24);
+            break;
+        case CaptureFormat::Bmp16:
+            ok = writeBmp(16);
+            break;
+        case CaptureFormat::Qoi:
+            ok = _qoi.begin(_w, _h);
+            for (int y = 0; y < _h && ok; y++)
+            {
+                decodeRow(y, _row);
+                ok = _qoi.addRow(_row);
+            }
+            ok = _qoi.end() && ok;
+            break;
+        case CaptureFormat::Png:
+            ok = _png.begin(_w, _h);
+            for (int y = 0; y < _h && ok; y++)
+            {
+                decodeRow(y, _row);
+                ok = _png.addRow(_row);
+            }
+            ok = _png.end() && ok;
+            break;
+    }
+    return flush() && ok;
+}
+
+
+/**
+ * Expand the runs of row y to RGB565
+ */
+void ScreenCapture::decodeRow(int y, uint16_t *row)
+{
+    const uint8_t *p = _runs + _rowStart[y];
+    const uint8_t *end = _runs + _rowStart[y + 1];
+    while (p < end)
+    {
+        int n = *p++ + 1;
+        uint8_t idx = *p++;
+        uint16_t c;
+        if (idx == 255) { c = p[0] | p[1] << 8; p += 2; }    // not in the palette
+        else c = _palette[idx];
+        for (int k = 0; k < n; k++) *row++ = c;
+    }
+}
+
+
+/**
+ * 24 bit BGR or 16 bit RGB565 BMP, the rows bottom-up
+ */
+bool ScreenCapture::writeBmp(int bits)
+{
+    static_assert(sizeof(_band) >= 3 * CAPTURE_MAX_WIDTH + 3, "band too small for a BMP row");
+    uint8_t *row = reinterpret_cast<uint8_t *>(_band);   // not used by grab() while busy
+    int rowSize = bmpRowSize(_w, bits);
+    uint8_t header[BMP_HEADER_MAX];
+    if (!put(header, bmpHeader(header, _w, _h, bits))) return false;
+
+    for (int y = _h - 1; y >= 0; y--)
+    {
+        decodeRow(y, _row);
+        if (bits == 24) rgb565ToBgr888(_row, row, _w);
+        else memcpy(row, _row, 2 * _w);                  // little endian RGB565 as in the file
+        memset(row + _w * bits / 8, 0, rowSize - _w * bits / 8);
+        if (!put(row, rowSize)) return false;
+    }
+    return true;
+}
+
+
+bool ScreenCapture::sink(const uint8_t *data, int len, void *arg)
+{
+    return static_cast<ScreenCapture *>(arg)->put(data, len);
+}
+
+
+/**
+ * Collect data into blocks of CAPTURE_BLOCK_SIZE bytes, so that the
+ * SD card is written in whole sectors except for the last block
+ */
+bool ScreenCapture::put(const uint8_t *data, int len)
+{
+    while (len > 0)
+    {
+        int n = min(len, CAPTURE_BLOCK_SIZE - _fill);
+        memcpy(_block + _fill, data, n);
+        _fill += n;
+        data += n;
+        len -= n;
+        if (_fill == CAPTURE_BLOCK_SIZE && !flush()) return false;
+    }
+    return true;
+}
+
+bool ScreenCapture::flush()
+{
+    if (_fill == 0) return true;
+    bool ok = true;
+    if (_file)
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        ok = _file->write(_block, _fill) == (size_t)_fill;
+    }
+    _bytesWritten += _fill;
+    _fill = 0;
+    return ok;
+}
+
+
+/**
+ * Encode the grabbed screen in every format without writing
+ * and log time and size. Runs on the caller's task.
+ */
+void ScreenCapture::benchmark()
+{
+    static const char *names[] = { "BMP 24", "BMP 16", "QOI", "PNG" };
+    if (_runs == nullptr) return;
+    for (int f = 0; f < 4; f++)
+    {
+        _bytesWritten = 0;
+        uint32_t t0 = micros();
+        bool ok = encode((CaptureFormat)f);
+        uint32_t us = micros() - t0;
+        log_i("%-6s %6u bytes, encoded in %6u us%s", names[f], _bytesWritten, us, ok ? "" : " (failed)");
+    }
+
+    // the kernels alone, one row 100 times
+    uint32_t t0 = micros();
+    for (int i = 0; i < 100; i++) rgb565ToBgr888(_row, reinterpret_cast<uint8_t *>(_band), _w);
+    uint32_t t1 = micros();
+    for (int i = 0; i < 100; i++) swap565(_row, _band, _w);
+    uint32_t t2 = micros();
+    log_i("RGB565 to BGR888 %u ns/pixel, byte swap %u ns/pixel",
+          (t1 - t0) * 1000 / (100 * _w), (t2 - t1) * 1000 / (100 * _w));
+    release();
+}
+
+
+uint32_t ScreenCapture::usGrabLast()
+{
+    return _usGrabLast;
+}
+
+uint32_t ScreenCapture::msWriteLast()
+{
+    return _msWriteLast;
+}
+
+void ScreenCapture::printStats()
+{
+    log_i("Capture: %u screenshots, %u failures, grab %u us, write %u ms",
+          _shots, _failures, _usGrabLast, _msWriteLast);
+}
@@ -0,0 +1,106 @@
+/**
+ * Header       ScreenCapture.h
+ *
+ * Purpose      Declaration of the class ScreenCapture, screenshots that do
+ *              not interrupt the radio.
+ *              - grab() runs on the render task. It reads the frame buffer
+ *                in bands of CAPTURE_BAND_LINES lines, nothing is read
+ *                back from the display, and compresses every line into
+ *                runs of palette colors, 2 bytes per run. The
+ *                flat panels of the UI need some 20 KB instead of 150 KB.
+ *              - save() hands the capture to a low priority task, which
+ *                encodes it as PNG, QOI, 24 or 16 bit BMP and writes it to
+ *                the SD card in blocks of CAPTURE_BLOCK_SIZE bytes.
+ *                Playback goes on.
+ *              The SD card shares the bus with the touch controller. With
+ *              setBus() every block is written while holding the bus, the
+ *              touch is sampled in between.
+ *              Capture time, compressed size and write throughput are
+ *              logged for each screenshot.
+ *
+ * Usage        ScreenCapture capture(SD);
+ *              capture.setBus(vspi);
+ *              capture.begin();
+ *              ...
+ *              renderer.call([](LGFX &lcd, int x, int y, void *arg)
+ *                  { if (capture.grab(frameBuffer)) capture.save("/Screenshots/Scr.png", CaptureFormat::Png); });
+ */
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+#include <LovyanGFX.hpp>
+#include "lgfx_esp32-2432S028.h"
+#include "UiFrameBuffer.h"
+#include "ImageCodec.h"
+#include "SpiArbiter.h"
+#include <atomic>
+
+const int CAPTURE_MAX_WIDTH   = 320;
+const int CAPTURE_MAX_HEIGHT  = 320;
+const int CAPTURE_BAND_LINES  = 4;       // lines read from the frame buffer at once
+const int CAPTURE_BLOCK_SIZE  = 4096;    // bytes per write to the SD card
+const int CAPTURE_NAME_LEN    = 48;
+
+enum class CaptureFormat : uint8_t { Bmp24, Bmp16, Qoi, Png };
+
+class ScreenCapture
+{
+    public:
+        ScreenCapture(fs::FS &fs, uint32_t maxBytes=32768) : _fs(fs), _maxBytes(maxBytes)
+        {}
+
+        void begin(UBaseType_t priority=1, BaseType_t core=0);
+        void setBus(SpiArbiter &bus);
+        bool grab(UiFrameBuffer &fb);
+        bool save(const char *filename, CaptureFormat format=CaptureFormat::Png);
+        bool isBusy();
+        void benchmark();
+
+        uint32_t usGrabLast();
+        uint32_t msWriteLast();
+        void     printStats();
+
+    private:
+        static void task(void *arg);
+        void run();
+        bool encodeLine(const uint16_t *line, int w);
+        uint8_t colorIndex(uint16_t rgb565);
+        void decodeRow(int y, uint16_t *row);
+        bool encode(CaptureFormat format);
+        bool writeBmp(int bits);
+        static bool sink(const uint8_t *data, int len, void *arg);
+        bool put(const uint8_t *data, int len);
+        bool flush();
+        void release();
+
+        fs::FS   &_fs;
+        uint32_t _maxBytes;
+        SpiArbiter *_bus = nullptr;
+        TaskHandle_t _task = nullptr;
+        std::atomic<bool> _busy{false};
+        char _filename[CAPTURE_NAME_LEN];
+        CaptureFormat _format = CaptureFormat::Png;
+        File *_file = nullptr;          // nullptr = count the bytes only
+
+        // the capture: runs of (length-1, palette index), index 255 is followed by the color
+        uint8_t  *_runs = nullptr;
+        uint32_t _used = 0;
+        uint32_t _rowStart[CAPTURE_MAX_HEIGHT + 1];
+        int      _w = 0, _h = 0;
+        uint16_t _palette[255];
+        int      _nColors = 0;
+        uint8_t  _hash[256];            // last index seen for a hash of the color
+
+        alignas(4) uint16_t _band[CAPTURE_BAND_LINES * CAPTURE_MAX_WIDTH];
+        alignas(4) uint16_t _row[CAPTURE_MAX_WIDTH];
+        uint8_t  _block[CAPTURE_BLOCK_SIZE];
+        int      _fill = 0;
+        QoiEncoder _qoi{sink, this};
+        PngEncoder _png{sink, this};
+
+        uint32_t _usGrabLast = 0;
+        uint32_t _msWriteLast = 0;
+        uint32_t _bytesWritten = 0;
+        uint32_t _shots = 0;
+        uint32_t _failures = 0;
+};
@@ -0,0 +1,121 @@
+/**
+ * Class        Implementation of the class methods of SpiArbiter
+ *
+ * Purpose      A mutex with priority inheritance decides who uses the
+ *              bus, the GPIO matrix connects the signals of the SPI
+ *              peripheral to the pins of the owner.
+ *
+ * Remarks      The chip selects are driven as GPIOs by both drivers and
+ *              stay high while a device is idle, so the pins of the
+ *              device that does not own the bus may simply be left
+ *              alone. Only the outputs of the previous owner are
+ *              detached, the MISO input follows the last attach.
+ */
+#include "SpiArbiter.h"
+#include "soc/spi_periph.h"
+
+
+void SpiArbiter::addClient(SpiClient client, const SpiPins &pins)
+{
+    int i = static_cast<int>(client);
+    _pins[i] = pins;
+    _hasPins[i] = true;
+}
+
+
+/**
+ * Start arbitrating. owner is the client the pins are routed
+ * to by the driver that was initialized last.
+ */
+void SpiArbiter::begin(SpiClient owner)
+{
+    _mutex = xSemaphoreCreateMutexStatic(&_mutexCtrl);
+    _owner = static_cast<int>(owner);
+    log_i("==> done");
+}
+
+
+/**
+ * Wait for the bus and route it to the pins of client
+ */
+void SpiArbiter::acquire(SpiClient client)
+{
+    int i = static_cast<int>(client);
+    if (_mutex == nullptr) return;
+    if (xSemaphoreTake(_mutex, 0) != pdTRUE)
+    {
+        uint32_t t0 = micros();
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        uint32_t us = micros() - t0;
+        _waited[i]++;
+        _usWait[i] += us;
+        if (us > _usWaitMax[i]) _usWaitMax[i] = us;
+    }
+    _acquired[i]++;
+    if (i != _owner && _hasPins[i]) route(client);
+}
+
+
+void SpiArbiter::release()
+{
+    if (_mutex) xSemaphoreGive(_mutex);
+}
+
+
+void SpiArbiter::route(SpiClient client)
+{
+    const spi_signal_conn_t &signals = spi_periph_signal[_host];
+    const SpiPins &to = _pins[static_cast<int>(client)];
+    uint32_t t0 = micros();
+
+    if (_owner >= 0 && _hasPins[_owner])
+    {
+        const SpiPins &from = _pins[_owner];
+        pinMatrixOutDetach(from.sclk, false, false);
+        pinMatrixOutDetach(from.mosi, false, false);
+    }
+    pinMatrixOutAttach(to.sclk, signals.spiclk_out, false, false);
+    pinMatrixOutAttach(to.mosi, signals.spid_out, false, false);
+    pinMatrixInAttach(to.miso, signals.spiq_in, false);
+    _owner = static_cast<int>(client);
+
+    uint32_t us = micros() - t0;
+    _switches++;
+    _usSwitch += us;
+    if (us > _usSwitchMax) _usSwitchMax = us;
+}
+
+
+uint32_t SpiArbiter::usWaitMax(SpiClient client)
+{
+    return _usWaitMax[static_cast<int>(client)];
+}
+
+
+void SpiArbiter::printStats()
+{
+    static const char *names[SPI_MAX_CLIENTS] = { "touch", "SD", "other" };
+    log_i("SPI bus: %u switches, %u us avg, %u us max",
+          _switches, _switches ? _usSwitch / _switches : 0, _usSwitchMax);
+    for (int i = 0; i < SPI_MAX_CLIENTS; i++)
+    {
+        if (_acquired[i] == 0) continue;
+        log_i("  %-5s %u accesses, %u waited, wait %u us avg, %u us max", names[i],
+              _acquired[i], _waited[i], _waited[i] ? _usWait[i] / _waited[i] : 0, _usWaitMax[i]);
+    }
+}
+
+
+void SpiArbiter::resetStats()
+{
+    for (int i = 0; i < SPI_MAX_CLIENTS; i++)
+    {
+        _acquired[i] = 0;
+        _waited[i] = 0;
+        _usWait[i] = 0;
+        _usWaitMax[i] = 0;
+    }
+    _switches = 0;
+    _usSwitch = 0;
+    _usSwitchMax = 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * Header       SpiArbiter.h
+ *
+ * Purpose      Declaration of the class SpiArbiter, which time-slices one
+ *              SPI peripheral between devices wired to different pins,
+ *              on the CYD the XPT2046 touch controller and the SD card,
+ *              both on VSPI.
+ *              - Both drivers are initialized once and stay initialized.
+ *                They set clock and mode at the start of every
+ *                transaction, only the pins differ.
+ *              - A client holds the bus for one short access, a touch
+ *                sample or a block of the SD card. When the owner
+ *                changes, SCLK, MOSI and MISO are switched in the GPIO
+ *                matrix, which takes microseconds instead of the
+ *                milliseconds of SD.begin() or a touch init.
+ *              Wait times per client and the number and duration of the
+ *              switches are logged.
+ *
+ * Usage        SpiArbiter vspi(VSPI_HOST);
+ *              vspi.addClient(SpiClient::Touch, { TP_SCLK, TP_MISO, TP_MOSI });
+ *              vspi.addClient(SpiClient::Sd,    { TF_SCLK, TF_MISO, TF_MOSI });
+ *              initSDCard(sdcardSPI);
+ *              vspi.begin(SpiClient::Sd);      // the pins are routed to the SD card
+ *              ...
+ *              { SpiLease lease(&vspi, SpiClient::Sd); file.write(block, n); }
+ */
+#pragma once
+#include <Arduino.h>
+#include "hal/spi_types.h"
+
+const int SPI_MAX_CLIENTS = 3;
+
+enum class SpiClient : uint8_t { Touch, Sd, Other };
+
+struct SpiPins
+{
+    int8_t sclk, miso, mosi;
+};
+
+class SpiArbiter
+{
+    public:
+        SpiArbiter(spi_host_device_t host) : _host(host)
+        {}
+
+        void addClient(SpiClient client, const SpiPins &pins);
+        void begin(SpiClient owner);
+        void acquire(SpiClient client);
+        void release();
+
+        uint32_t usWaitMax(SpiClient client);
+        void printStats();
+        void resetStats();
+
+    private:
+        void route(SpiClient client);
+
+        spi_host_device_t _host;
+        SpiPins _pins[SPI_MAX_CLIENTS];
+        bool    _hasPins[SPI_MAX_CLIENTS] = {};
+        SemaphoreHandle_t _mutex = nullptr;
+        StaticSemaphore_t _mutexCtrl;
+        int     _owner = -1;            // client whose pins are routed
+
+        uint32_t _acquired[SPI_MAX_CLIENTS] = {};
+        uint32_t _waited[SPI_MAX_CLIENTS] = {};     // acquisitions that had to wait
+        uint32_t _usWait[SPI_MAX_CLIENTS] = {};
+        uint32_t _usWaitMax[SPI_MAX_CLIENTS] = {};
+        uint32_t _switches = 0;
+        uint32_t _usSwitch = 0;
+        uint32_t _usSwitchMax = 0;
+};
+
+
+/**
+ * Holds the bus for the lifetime of the object,
+ * does nothing without an arbiter
+ */
+class SpiLease
+{
+    public:
+        SpiLease(SpiArbiter *bus, SpiClient client) : _bus(bus)
+        { if (_bus) _bus->acquire(client); }
+        ~SpiLease()
+        { if (_bus) _bus->release(); }
+
+        SpiLease(const SpiLease &) = delete;
+        SpiLease &operator=(const SpiLease &) = delete;
+
+    private:
+        SpiArbiter *_bus;
+};
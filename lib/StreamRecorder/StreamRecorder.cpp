@@ -0,0 +1,341 @@
+/**
+ * Class        Implementation of the class methods of StreamRecorder
+ *
+ * Purpose      The audio path only copies into the ring. Everything that
+ *              touches the card, opening, extending, writing and closing
+ *              the file, runs on the writer task.
+ *
+ * Remarks      The ring holds RECORDER_BLOCKS blocks and the writer takes
+ *              whole blocks only, so a block never wraps around the end
+ *              of the ring and every write starts at a multiple of the
+ *              block size in the file. Only the rest at stop() is
+ *              shorter. The file is extended by writing its new last
+ *              byte, FatFs allocates the clusters in between without
+ *              writing them.
+ */
+#include "StreamRecorder.h"
+#include <unistd.h>
+
+const uint32_t RECORDER_RING_SIZE = RECORDER_BLOCKS * RECORDER_BLOCK_SIZE;
+
+
+/**
+ * Forward the data to the decoder first, then copy it into the ring.
+ * Never waits: data that does not fit is dropped.
+ */
+size_t StreamRecorder::write(const uint8_t *data, size_t len)
+{
+    size_t written = _out.write(data, len);
+    if (!_recording.load(std::memory_order_acquire)) return written;
+
+    const uint8_t *p = data;
+    int n = written;
+    if (!_synced)
+    {
+        int k = frameStart(p, n);
+        if (k < 0) return written;
+        p += k;
+        n -= k;
+        _synced = true;
+    }
+
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t tail = _tail.load(std::memory_order_acquire);
+    if (head - tail + n > RECORDER_RING_SIZE)
+    {
+        _dropped += n;
+        _synced = false;                // the file goes on with a whole frame
+        return written;
+    }
+    uint32_t pos = head % RECORDER_RING_SIZE;
+    int first = min((uint32_t)n, RECORDER_RING_SIZE - pos);
+    memcpy(_ring + pos, p, first);
+    memcpy(_ring, p + first, n - first);
+    _head.store(head + n, std::memory_order_release);
+    if ((head + n) / RECORDER_BLOCK_SIZE != head / RECORDER_BLOCK_SIZE) xTaskNotifyGive(_task);
+    return written;
+}
+
+int StreamRecorder::availableForWrite()
+{
+    return _out.availableForWrite();
+}
+
+void StreamRecorder::setAudioInfo(AudioInfo info)
+{
+    AudioStream::setAudioInfo(info);
+    _out.setAudioInfo(info);
+}
+
+
+/**
+ * Offset of the first MP3 or ADTS frame header: 11 or 12 sync bits
+ * and a bitrate or sampling rate index that is not 15
+ */
+int StreamRecorder::frameStart(const uint8_t *data, int len)
+{
+    for (int i = 0; i + 2 < len; i++)
+    {
+        if (data[i] == 0xFF && (data[i + 1] & 0xE0) == 0xE0 && (data[i + 2] & 0xF0) != 0xF0) return i;
+    }
+    return -1;
+}
+
+
+void StreamRecorder::startWriter(UBaseType_t priority, BaseType_t core)
+{
+    xTaskCreatePinnedToCore(task, "recorder", 4096, this, priority, &_task, core);
+    log_i("==> done");
+}
+
+void StreamRecorder::setBus(SpiArbiter &bus)
+{
+    _bus = &bus;
+}
+
+
+/**
+ * Start recording into RECORDER_DIR/<date>_<time>_<title>.<ext>.
+ * Must be called on the task that writes the stream.
+ */
+bool StreamRecorder::start(const char *title, const char *ext)
+{
+    if (_task == nullptr || _recording || _stopping) return false;
+    if (_ring == nullptr) _ring = static_cast<uint8_t *>(malloc(RECORDER_RING_SIZE));
+    if (_ring == nullptr)
+    {
+        log_e("No memory for %u bytes", RECORDER_RING_SIZE);
+        return false;
+    }
+
+    tm rtcTime = {};
+    getLocalTime(&rtcTime, 0);
+    int n = snprintf(_filename, sizeof(_filename), "%s/", RECORDER_DIR);
+    n += strftime(_filename + n, sizeof(_filename) - n, "%Y%m%d_%H%M%S_", &rtcTime);
+    int end = sizeof(_filename) - strlen(ext) - 2;
+    for (const char *s = title; *s && n < end; s++)
+    {
+        // Latin-1 title, only letters and digits go into the name
+        char c = isalnum((uint8_t)*s) && (uint8_t)*s < 0x80 ? *s : '_';
+        if (c == '_' && _filename[n - 1] == '_') continue;
+        _filename[n++] = c;
+    }
+    if (_filename[n - 1] == '_') n--;
+    snprintf(_filename + n, sizeof(_filename) - n, ".%s", ext);
+
+    _head = 0;
+    _tail = 0;
+    _synced = false;
+    _written = 0;
+    _allocated = 0;
+    _msStart = millis();
+    _failed = false;
+    _recording.store(true, std::memory_order_release);
+    log_i("Recording %s", _filename);
+    return true;
+}
+
+
+/**
+ * Stop recording, the writer flushes the rest and closes the file.
+ * Must be called on the task that writes the stream, the writer
+ * frees the ring afterwards.
+ */
+void StreamRecorder::stop()
+{
+    if (!_recording.exchange(false)) return;
+    _stopping = true;
+    xTaskNotifyGive(_task);
+}
+
+bool StreamRecorder::isRecording()
+{
+    return _recording;
+}
+
+// The writer could not write a block, e.g. the card is full. The data 
+// is discarded until the recording is stopped.
+bool StreamRecorder::failed()
+{
+    return _failed;
+}
+
+// True while the file is open, also while the writer closes it
+bool StreamRecorder::isWriting(const char *path)
+{
+    return (_recording || _stopping) && strcasecmp(path, _filename) == 0;
+}
+
+
+void StreamRecorder::task(void *arg)
+{
+    static_cast<StreamRecorder *>(arg)->run();
+}
+
+
+void StreamRecorder::run()
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        for (;;)
+        {
+            bool stopping = _stopping;  // before the head, the last bytes must be seen
+            uint32_t head = _head.load(std::memory_order_acquire);
+            uint32_t tail = _tail.load(std::memory_order_relaxed);
+            uint32_t n = head - tail;
+            if (n > RECORDER_BLOCK_SIZE) n = RECORDER_BLOCK_SIZE;
+            else if (n < RECORDER_BLOCK_SIZE && !(stopping && n > 0)) break;
+
+            bool ok = !_failed && (_file || openFile()) && writeBlock(_ring + tail % RECORDER_RING_SIZE, n);
+            if (!ok)
+            {
+                // the audio path may be copying into the ring, only stop() ends the recording
+                if (!_failed) log_e("Recording %s failed", _filename);
+                _failed = true;
+                _tail.store(head, std::memory_order_release);
+                continue;
+            }
+            _tail.store(tail + n, std::memory_order_release);
+        }
+        if (_stopping)
+        {
+            closeFile();
+            free(_ring);
+            _ring = nullptr;
+            _stopping = false;
+        }
+    }
+}
+
+
+bool StreamRecorder::openFile()
+{
+    SpiLease lease(_bus, SpiClient::Sd);
+    if (!_fs.exists(RECORDER_DIR)) _fs.mkdir(RECORDER_DIR);
+    _file = _fs.open(_filename, FILE_WRITE);
+    if (!_file) log_e("Cannot create %s", _filename);
+    return _file;
+}
+
+
+/**
+ * Extend the file if the block does not fit, then write the
+ * block in slices, releasing the bus in between
+ */
+bool StreamRecorder::writeBlock(const uint8_t *data, int len)
+{
+    uint32_t t0 = millis();
+    if (_written + len > _allocated)
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        _allocated += RECORDER_PREALLOC;
+        bool ok = _file.seek(_allocated - 1) && _file.write((uint8_t)0) == 1 && _file.seek(_written);
+        uint32_t ms = millis() - t0;
+        if (ms > _msAllocMax) _msAllocMax = ms;
+        if (!ok) return false;
+    }
+    for (int off = 0; off < len; off += RECORDER_SLICE)
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        int k = min(RECORDER_SLICE, len - off);
+        if (_file.write(data + off, k) != (size_t)k) return false;
+    }
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        _file.flush();
+    }
+    uint32_t ms = millis() - t0;
+    _msWriting += ms;
+    if (ms > _msWriteMax) _msWriteMax = ms;
+    _written += len;
+    _bytes += len;
+    _blocks++;
+    return true;
+}
+
+
+/**
+ * Close the file and cut the preallocated space
+ */
+void StreamRecorder::closeFile()
+{
+    if (!_file) return;
+    char path[sizeof(RECORDER_MOUNT) + RECORDER_NAME_LEN];
+    snprintf(path, sizeof(path), "%s%s", RECORDER_MOUNT, _filename);
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        _file.close();
+        if (truncate(path, _written) != 0) log_w("Cannot truncate %s", path);
+    }
+    _recordings++;
+    uint32_t s = (millis() - _msStart) / 1000;
+    log_i("Recorded %s: %u bytes in %u s", _filename, _written, s);
+}
+
+
+/**
+ * Write bytes of test data through the same path as a recording
+ * and log the throughput. Runs on the caller's task.
+ */
+void StreamRecorder::benchmark(uint32_t bytes)
+{
+    if (_recording || _stopping) return;
+    uint8_t *block = static_cast<uint8_t *>(malloc(RECORDER_BLOCK_SIZE));
+    if (block == nullptr) return;
+    for (int i = 0; i < RECORDER_BLOCK_SIZE; i++) block[i] = i * 7;
+    snprintf(_filename, sizeof(_filename), "%s/bench.bin", RECORDER_DIR);
+    resetStats();
+    _written = 0;
+    _allocated = 0;
+    _msStart = millis();
+
+    bool ok = openFile();
+    while (ok && _written < bytes) ok = writeBlock(block, RECORDER_BLOCK_SIZE);
+    closeFile();
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        _fs.remove(_filename);
+    }
+    free(block);
+    log_i("Recorder benchmark%s: %u blocks of %u bytes, %u KB/s, block max %u ms, extend max %u ms",
+          ok ? "" : " (failed)", _blocks, RECORDER_BLOCK_SIZE, _msWriting ? _bytes / _msWriting : 0,
+          _msWriteMax, _msAllocMax);
+    resetStats();
+}
+
+
+uint32_t StreamRecorder::bytesRecorded()
+{
+    return _written;
+}
+
+uint32_t StreamRecorder::msWriteMax()
+{
+    return _msWriteMax;
+}
+
+uint32_t StreamRecorder::dropped()
+{
+    return _dropped;
+}
+
+
+void StreamRecorder::printStats()
+{
+    if (!_recording && _blocks == 0 && _dropped == 0) return;
+    log_i("Recorder: %s, %u blocks, %u bytes, write %u KB/s, block max %u ms, extend max %u ms, dropped %u bytes",
+          _recording ? "recording" : "idle", _blocks, _bytes,
+          _msWriting ? _bytes / _msWriting : 0, _msWriteMax, _msAllocMax, _dropped);
+}
+
+
+void StreamRecorder::resetStats()
+{
+    _blocks = 0;
+    _bytes = 0;
+    _msWriting = 0;
+    _msWriteMax = 0;
+    _msAllocMax = 0;
+    _dropped = 0;
+}
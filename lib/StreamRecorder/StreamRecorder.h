@@ -0,0 +1,112 @@
+/**
+ * Header       StreamRecorder.h
+ *
+ * Purpose      Declaration of the class StreamRecorder, a pass-through
+ *              stream between the network and the decoder, which records
+ *              the compressed stream of the playing station to the SD
+ *              card.
+ *              - The audio path forwards the data to the decoder first,
+ *                then copies it into a ring of RECORDER_BLOCKS blocks of
+ *                RECORDER_BLOCK_SIZE bytes. It never waits: when the ring
+ *                is full, the data is dropped and counted, and recording
+ *                resumes at the next frame header.
+ *              - A low priority task writes every full block at an offset
+ *                that is a multiple of the block size, aligned with the
+ *                clusters of the card. The file is extended by
+ *                RECORDER_PREALLOC bytes ahead of the data, so a block
+ *                write rarely has to allocate clusters, and is cut to
+ *                its real length at the end.
+ *              - A block is written in slices of RECORDER_SLICE bytes,
+ *                each holding the SPI bus, the touch stays live.
+ *              The file is named after the time and the ICY title.
+ *              Throughput, longest block write and dropped bytes are
+ *              logged, benchmark() measures the card without a stream.
+ *
+ * Usage        StreamRecorder recorder(dec, SD);
+ *              StreamCopy copier(recorder, url);
+ *              recorder.setBus(vspi);
+ *              recorder.startWriter();
+ *              ...
+ *              recorder.start(currentTitle);
+ *              if (recorder.isRecording() && recorder.failed()) recorder.stop();  // in loop()
+ *              recorder.stop();
+ */
+#pragma once
+#include <Arduino.h>
+#include <AudioTools.h>
+#include <FS.h>
+#include <atomic>
+#include "SpiArbiter.h"
+
+#ifndef RECORDER_MOUNT_POINT
+#define RECORDER_MOUNT_POINT "/sd"          // the native tests mount a directory of the host
+#endif
+
+const int RECORDER_BLOCK_SIZE = 32768;      // bytes per write, the cluster size of most cards
+const int RECORDER_BLOCKS     = 2;          // one is written while the other fills
+const int RECORDER_SLICE      = 4096;       // bytes per hold of the SPI bus
+const uint32_t RECORDER_PREALLOC = 1048576; // the file is extended in these steps
+const int RECORDER_NAME_LEN   = 64;
+const char RECORDER_DIR[]     = "/Recordings";
+const char RECORDER_MOUNT[]   = RECORDER_MOUNT_POINT;  // mount point of SD for the POSIX calls
+
+class StreamRecorder : public AudioStream
+{
+    public:
+        StreamRecorder(AudioStream &out, fs::FS &fs) : _out(out), _fs(fs)
+        {}
+
+        size_t write(const uint8_t *data, size_t len) override;
+        int availableForWrite() override;
+        void setAudioInfo(AudioInfo info) override;
+
+        void startWriter(UBaseType_t priority=1, BaseType_t core=0);
+        void setBus(SpiArbiter &bus);
+        bool start(const char *title, const char *ext="mp3");
+        void stop();
+        bool isRecording();
+        bool failed();
+        bool isWriting(const char *path);
+        void benchmark(uint32_t bytes=RECORDER_PREALLOC);
+
+        uint32_t bytesRecorded();
+        uint32_t msWriteMax();
+        uint32_t dropped();
+        void printStats();
+        void resetStats();
+
+    private:
+        static void task(void *arg);
+        void run();
+        bool openFile();
+        bool writeBlock(const uint8_t *data, int len);
+        void closeFile();
+        int  frameStart(const uint8_t *data, int len);
+
+        AudioStream &_out;
+        fs::FS &_fs;
+        SpiArbiter *_bus = nullptr;
+        TaskHandle_t _task = nullptr;
+        File _file;
+        char _filename[RECORDER_NAME_LEN];
+
+        // single producer (audio path), single consumer (writer task)
+        uint8_t *_ring = nullptr;
+        std::atomic<uint32_t> _head{0};
+        std::atomic<uint32_t> _tail{0};
+        std::atomic<bool> _recording{false};    // the audio path copies into the ring
+        std::atomic<bool> _stopping{false};     // the writer closes the file
+        std::atomic<bool> _failed{false};       // a write failed, the writer waits for stop()
+        bool     _synced = false;               // a frame header was found
+
+        uint32_t _written = 0;                  // bytes in the file
+        uint32_t _allocated = 0;                // length of the preallocated file
+        uint32_t _msStart = 0;
+        uint32_t _msWriting = 0;                // time spent in the block writes
+        uint32_t _msWriteMax = 0;
+        uint32_t _msAllocMax = 0;
+        uint32_t _dropped = 0;
+        uint32_t _blocks = 0;
+        uint32_t _bytes = 0;
+        uint32_t _recordings = 0;
+};
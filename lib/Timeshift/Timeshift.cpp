@@ -0,0 +1,422 @@
+/**
+ * Class        Implementation of the class methods of Timeshift
+ *
+ * Purpose      Three parties share the ring file: write() and pump() in
+ *              loop(), and the task that moves the data between the RAM
+ *              rings and the card. They exchange stream offsets through
+ *              the heads and tails of the rings, nobody waits for anybody.
+ *
+ * Remarks      A seek is requested by pump()'s side with a sequence
+ *              number. The task clears the read ring and continues at the
+ *              new offset, pump() does not touch the ring until the task
+ *              has acknowledged. The stream offsets are 32 bit, they wrap
+ *              after 4 GB, some days of radio. The differences are
+ *              therefore compared as signed numbers.
+ */
+#include "Timeshift.h"
+
+const uint32_t TIMESHIFT_INDEX_MASK = TIMESHIFT_SECONDS - 1;
+
+static_assert((TIMESHIFT_SECONDS & (TIMESHIFT_SECONDS - 1)) == 0, "TIMESHIFT_SECONDS must be a power of two");
+static_assert(TIMESHIFT_FILE_SIZE % TIMESHIFT_BLOCK == 0, "the file must hold whole blocks");
+
+
+/**
+ * Live, forward the data to the decoder first. Then append what
+ * the decoder took to the write ring and index its frames.
+ * Never waits: data that does not fit is dropped. Until the file
+ * is ready, or without a file, the data only passes through.
+ */
+size_t Timeshift::write(const uint8_t *data, size_t len)
+{
+    size_t written = _shifted ? len : _out.write(data, len);
+    if (!_ready.load(std::memory_order_acquire) || written == 0) return written;
+
+    uint32_t head = _whead.load(std::memory_order_relaxed);
+    uint32_t tail = _wtail.load(std::memory_order_acquire);
+    if (head - tail + written > TIMESHIFT_WRITE_RING)
+    {
+        _dropped += written;
+        _scanner.resync();
+        return written;
+    }
+    uint32_t pos = head % TIMESHIFT_WRITE_RING;
+    uint32_t first = min((uint32_t)written, TIMESHIFT_WRITE_RING - pos);
+    memcpy(_wring + pos, data, first);
+    memcpy(_wring, data + first, written - first);
+    _scanner.feed(data, written, onFrame, this);
+    _whead.store(head + written, std::memory_order_release);
+    if ((head + written) / TIMESHIFT_BLOCK != head / TIMESHIFT_BLOCK) xTaskNotifyGive(_task);
+    return written;
+}
+
+int Timeshift::availableForWrite()
+{
+    if (_shifted) return TIMESHIFT_WRITE_RING - (_whead - _wtail);
+    return _out.availableForWrite();
+}
+
+void Timeshift::setAudioInfo(AudioInfo info)
+{
+    AudioStream::setAudioInfo(info);
+    _out.setAudioInfo(info);
+}
+
+
+/**
+ * Remember the offset of the first frame of every second
+ */
+void Timeshift::onFrame(uint32_t pos, const Mp3Frame &frame, void *arg)
+{
+    Timeshift *t = static_cast<Timeshift *>(arg);
+    if (t->_usStream >= (uint64_t)t->_seconds * 1000000)
+    {
+        t->_index[t->_seconds & TIMESHIFT_INDEX_MASK] = pos;
+        t->_seconds++;
+    }
+    t->_usStream += (uint64_t)frame.samples * 1000000 / frame.sampleRate;
+}
+
+
+/**
+ * Allocate the rings and start the task, which creates the file
+ */
+bool Timeshift::enable(UBaseType_t priority, BaseType_t core)
+{
+    if (_task) return true;
+    _wring = static_cast<uint8_t *>(malloc(TIMESHIFT_WRITE_RING));
+    _rring = static_cast<uint8_t *>(malloc(TIMESHIFT_READ_RING));
+    if (_wring == nullptr || _rring == nullptr)
+    {
+        log_e("No memory for %d bytes", TIMESHIFT_WRITE_RING + TIMESHIFT_READ_RING);
+        free(_wring);
+        free(_rring);
+        _wring = _rring = nullptr;
+        return false;
+    }
+    _scanner.reset(_whead);
+    xTaskCreatePinnedToCore(task, "timeshift", 4096, this, priority, &_task, core);
+    log_i("==> done");
+    return true;
+}
+
+void Timeshift::setBus(SpiArbiter &bus)
+{
+    _bus = &bus;
+}
+
+
+void Timeshift::task(void *arg)
+{
+    static_cast<Timeshift *>(arg)->run();
+}
+
+
+/**
+ * Write every full block at once, read while there is nothing
+ * to write. Polls the rings every 20 ms besides the notifications.
+ * Without a file the task frees the rings and ends, write() never
+ * touched them and nobody notifies it.
+ */
+void Timeshift::run()
+{
+    if (!openFile())
+    {
+        free(_wring);
+        free(_rring);
+        _wring = _rring = nullptr;
+        _task = nullptr;
+        vTaskDelete(nullptr);
+        return;
+    }
+    _ready.store(true, std::memory_order_release);
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(20));
+        for (;;)
+        {
+            if (_whead.load(std::memory_order_acquire) - _wtail.load(std::memory_order_relaxed) >= (uint32_t)TIMESHIFT_BLOCK)
+            {
+                writeBlock();
+                continue;
+            }
+            if (_shifted && readSlice()) continue;
+            break;
+        }
+    }
+}
+
+
+/**
+ * Create the ring file at its full size, the clusters are allocated
+ * once and the blocks are written into them from then on
+ */
+bool Timeshift::openFile()
+{
+    uint32_t t0 = millis();
+    SpiLease lease(_bus, SpiClient::Sd);
+    _file = _fs.open(TIMESHIFT_FILE, "w+");
+    bool ok = _file && _file.seek(TIMESHIFT_FILE_SIZE - 1) && _file.write((uint8_t)0) == 1;
+    if (ok) _file.flush();
+    else log_e("Cannot create %s", TIMESHIFT_FILE);
+    log_i("%s: %u KB allocated in %u ms", TIMESHIFT_FILE, TIMESHIFT_FILE_SIZE / 1024, millis() - t0);
+    return ok;
+}
+
+
+/**
+ * Write the oldest block of the write ring over the oldest
+ * block of the file, in slices that release the bus in between
+ */
+bool Timeshift::writeBlock()
+{
+    uint32_t tail = _wtail.load(std::memory_order_relaxed);
+    const uint8_t *block = _wring + tail % TIMESHIFT_WRITE_RING;
+    uint32_t t0 = millis();
+    bool ok = true;
+    for (int off = 0; off < TIMESHIFT_BLOCK && ok; off += TIMESHIFT_SLICE)
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        if (off == 0) ok = _file.seek(tail % TIMESHIFT_FILE_SIZE);
+        ok = ok && _file.write(block + off, TIMESHIFT_SLICE) == (size_t)TIMESHIFT_SLICE;
+    }
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        _file.flush();
+    }
+    uint32_t ms = millis() - t0;
+    _msWriting += ms;
+    if (ms > _msWriteMax) _msWriteMax = ms;
+    _bytesWritten += TIMESHIFT_BLOCK;
+    if (!ok) log_e("Write to %s failed", TIMESHIFT_FILE);
+    _wtail.store(tail + TIMESHIFT_BLOCK, std::memory_order_release);   // lost if failed, playback skips it
+    return ok;
+}
+
+
+/**
+ * Read the next slice from the file into the read ring. Returns
+ * false if the ring is full or there is nothing to read.
+ */
+bool Timeshift::readSlice()
+{
+    uint32_t req = _seekReq.load(std::memory_order_acquire);
+    if (req != _seekAck.load(std::memory_order_relaxed))
+    {
+        _rhead.store(0, std::memory_order_relaxed);
+        _rtail.store(0, std::memory_order_relaxed);
+        _readPos = _seekPos.load(std::memory_order_relaxed);
+        _seekAck.store(req, std::memory_order_release);
+    }
+
+    uint32_t head = _rhead.load(std::memory_order_relaxed);
+    uint32_t space = TIMESHIFT_READ_RING - (head - _rtail.load(std::memory_order_acquire));
+    uint32_t wtail = _wtail.load(std::memory_order_acquire);
+    int32_t avail = wtail - _readPos;
+    if (space < (uint32_t)TIMESHIFT_SLICE || avail <= 0) return false;
+    if ((int32_t)(_readPos - (wtail + TIMESHIFT_BLOCK - TIMESHIFT_FILE_SIZE)) < 0) return false;   // overwritten, pump() moves on
+
+    uint32_t n = min(space, (uint32_t)TIMESHIFT_SLICE);
+    n = min(n, (uint32_t)avail);
+    n = min(n, TIMESHIFT_READ_RING - head % TIMESHIFT_READ_RING);
+    n = min(n, TIMESHIFT_FILE_SIZE - _readPos % TIMESHIFT_FILE_SIZE);
+    uint32_t t0 = millis();
+    bool ok;
+    {
+        SpiLease lease(_bus, SpiClient::Sd);
+        ok = _file.seek(_readPos % TIMESHIFT_FILE_SIZE) && _file.read(_rring + head % TIMESHIFT_READ_RING, n) == n;
+    }
+    _msReading += millis() - t0;
+    _bytesRead += n;
+    if (!ok)
+    {
+        log_e("Read from %s failed", TIMESHIFT_FILE);
+        return false;
+    }
+    if (_seekReq.load(std::memory_order_acquire) != req) return true;      // a seek came in, read again
+    _readPos += n;
+    _rhead.store(head + n, std::memory_order_release);
+    return true;
+}
+
+
+/**
+ * Oldest stream offset that stays in the file until it is played
+ */
+uint32_t Timeshift::safeStart()
+{
+    return _wtail.load(std::memory_order_acquire) + 2 * TIMESHIFT_BLOCK - TIMESHIFT_FILE_SIZE;
+}
+
+
+int Timeshift::availableSeconds()
+{
+    if (!_ready || _seconds == 0) return 0;
+    int s = max(_firstSecond, _seconds - TIMESHIFT_SECONDS + 1);
+    uint32_t safe = safeStart();
+    while (s < _seconds && (int32_t)(_index[s & TIMESHIFT_INDEX_MASK] - safe) < 0) s++;
+    return _seconds - s;
+}
+
+
+void Timeshift::seek(uint32_t pos, int second)
+{
+    _seekPos.store(pos, std::memory_order_relaxed);
+    _seekReq.fetch_add(1, std::memory_order_release);
+    _playPos = pos;
+    _playSecond = second;
+    _msSeek = millis();
+    _empty = false;
+    _seeks++;
+    xTaskNotifyGive(_task);
+}
+
+
+// Continue from the file where the decoder is now
+void Timeshift::shiftAtLive()
+{
+    _shifted = true;
+    seek(_whead.load(std::memory_order_relaxed), max(_seconds - 1, 0));
+}
+
+
+/**
+ * Feed the decoder from the read ring, called in loop() after
+ * the copier. Moves on if the play position is overwritten.
+ */
+void Timeshift::pump()
+{
+    if (!_shifted) return;
+    if ((int32_t)(_playPos - safeStart()) < 0)
+    {
+        _overruns++;
+        int available = availableSeconds();
+        if (available < 2) goLive();
+        else
+        {
+            int s = _seconds - available;
+            seek(_index[s & TIMESHIFT_INDEX_MASK], s);
+        }
+        return;
+    }
+    if (_paused || _seekAck.load(std::memory_order_acquire) != _seekReq.load(std::memory_order_relaxed)) return;
+
+    uint32_t tail = _rtail.load(std::memory_order_relaxed);
+    uint32_t n = _rhead.load(std::memory_order_acquire) - tail;
+    if (n == 0)
+    {
+        if (!_empty) _starved++;
+        _empty = true;
+        return;
+    }
+    _empty = false;
+    n = min(n, (uint32_t)TIMESHIFT_PUMP);
+    n = min(n, TIMESHIFT_READ_RING - tail % TIMESHIFT_READ_RING);
+    size_t written = _out.write(_rring + tail % TIMESHIFT_READ_RING, n);
+    if (_msSeek && written > 0)
+    {
+        _msSeekLast = millis() - _msSeek;
+        if (_msSeekLast > _msSeekMax) _msSeekMax = _msSeekLast;
+        _msSeek = 0;
+    }
+    _rtail.store(tail + written, std::memory_order_release);
+    _playPos += written;
+    while (_playSecond + 1 < _seconds && (int32_t)(_index[(_playSecond + 1) & TIMESHIFT_INDEX_MASK] - _playPos) <= 0) _playSecond++;
+}
+
+
+void Timeshift::pause()
+{
+    if (!_ready) return;
+    if (!_shifted) shiftAtLive();
+    _paused = true;
+}
+
+void Timeshift::resume()
+{
+    _paused = false;
+}
+
+
+/**
+ * Go back seconds from the play position, at most to the
+ * oldest second in the file
+ */
+void Timeshift::rewind(int seconds)
+{
+    if (!_ready || _seconds == 0) return;
+    if (!_shifted) shiftAtLive();
+    int s = max(_playSecond - seconds, _seconds - availableSeconds());
+    if (s >= _seconds) return;
+    seek(_index[s & TIMESHIFT_INDEX_MASK], s);
+}
+
+
+/**
+ * Back to the live stream, the decoder gets the next
+ * bytes from the network and resyncs
+ */
+void Timeshift::goLive()
+{
+    _shifted = false;
+    _paused = false;
+    _msSeek = 0;
+}
+
+
+/**
+ * A new station: live, and no rewind before this point
+ */
+void Timeshift::restart()
+{
+    goLive();
+    _firstSecond = _seconds;
+    _scanner.resync();
+}
+
+
+bool Timeshift::isPaused()
+{
+    return _paused;
+}
+
+bool Timeshift::isShifted()
+{
+    return _shifted;
+}
+
+int Timeshift::delaySeconds()
+{
+    return _shifted ? max(_seconds - 1 - _playSecond, 0) : 0;
+}
+
+uint32_t Timeshift::msSeekLast()
+{
+    return _msSeekLast;
+}
+
+
+void Timeshift::printStats()
+{
+    if (!_ready) return;
+    log_i("Timeshift: %s, delay %d s, %d s available, write %u KB/s (block max %u ms), read %u KB/s, "
+          "%u seeks (last %u ms, max %u ms), dropped %u bytes, starved %u, overruns %u",
+          _paused ? "paused" : _shifted ? "shifted" : "live", delaySeconds(), availableSeconds(),
+          _msWriting ? _bytesWritten / _msWriting : 0, _msWriteMax, _msReading ? _bytesRead / _msReading : 0,
+          _seeks, _msSeekLast, _msSeekMax, _dropped, _starved, _overruns);
+}
+
+
+void Timeshift::resetStats()
+{
+    _bytesWritten = 0;
+    _msWriting = 0;
+    _msWriteMax = 0;
+    _bytesRead = 0;
+    _msReading = 0;
+    _msSeekMax = 0;
+    _seeks = 0;
+    _dropped = 0;
+    _starved = 0;
+    _overruns = 0;
+}
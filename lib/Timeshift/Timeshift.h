@@ -0,0 +1,131 @@
+/**
+ * Header       Timeshift.h
+ *
+ * Purpose      Declaration of the class Timeshift, pause and rewind of the
+ *              live radio. A pass-through stream between the network and
+ *              the decoder, which keeps the last minutes of the compressed
+ *              stream in a ring file on the SD card.
+ *              - Every byte from the network is appended to a RAM ring
+ *                and written to the ring file in blocks of
+ *                TIMESHIFT_BLOCK bytes by a background task. Live, the
+ *                bytes are also passed on to the decoder at once.
+ *              - Paused or rewound, the decoder is fed by pump() in
+ *                loop() from a read ring, which the same task fills from
+ *                the file. Writing has priority over reading.
+ *              - The MPEG frame headers give the time. For every second
+ *                of the stream the offset of its first frame is kept,
+ *                4 bytes per second, a seek to a time is an array access.
+ *              - A pause longer than the file holds moves the play
+ *                position forward to the oldest second still in the file.
+ *              Seek latency, read and write throughput are logged.
+ *
+ * Usage        Timeshift timeshift(recorder, SD);
+ *              StreamCopy copier(timeshift, url);
+ *              timeshift.setBus(vspi);
+ *              if (SD.cardType() != CARD_NONE) timeshift.enable();
+ *              loop() { copier.copy(); timeshift.pump(); }
+ *              timeshift.pause(); timeshift.rewind(30); timeshift.goLive();
+ */
+#pragma once
+#include <Arduino.h>
+#include <AudioTools.h>
+#include <FS.h>
+#include <atomic>
+#include "SpiArbiter.h"
+#include "Mp3Frame.h"
+
+const int TIMESHIFT_BLOCK       = 16384;        // bytes per write to the file
+const int TIMESHIFT_WRITE_RING  = 2 * TIMESHIFT_BLOCK;
+const int TIMESHIFT_READ_RING   = 8192;
+const int TIMESHIFT_SLICE       = 4096;         // bytes per hold of the SPI bus
+const int TIMESHIFT_PUMP        = 1024;         // bytes per pump() to the decoder
+const int TIMESHIFT_SECONDS     = 1024;         // entries of the time index, power of two
+const uint32_t TIMESHIFT_FILE_SIZE = 8 * 1048576;  // multiple of TIMESHIFT_BLOCK, 8 minutes at 128 kbit/s
+const char TIMESHIFT_FILE[]     = "/timeshift.bin";
+
+class Timeshift : public AudioStream
+{
+    public:
+        Timeshift(AudioStream &out, fs::FS &fs) : _out(out), _fs(fs)
+        {}
+
+        size_t write(const uint8_t *data, size_t len) override;
+        int availableForWrite() override;
+        void setAudioInfo(AudioInfo info) override;
+
+        bool enable(UBaseType_t priority=1, BaseType_t core=0);
+        void setBus(SpiArbiter &bus);
+        void pump();
+        void pause();
+        void resume();
+        void rewind(int seconds);
+        void goLive();
+        void restart();
+        bool isPaused();
+        bool isShifted();
+        int  delaySeconds();
+        int  availableSeconds();
+
+        uint32_t msSeekLast();
+        void printStats();
+        void resetStats();
+
+    private:
+        static void task(void *arg);
+        void run();
+        bool openFile();
+        bool writeBlock();
+        bool readSlice();
+        void shiftAtLive();
+        void seek(uint32_t pos, int second);
+        uint32_t safeStart();
+        static void onFrame(uint32_t pos, const Mp3Frame &frame, void *arg);
+
+        AudioStream &_out;
+        fs::FS &_fs;
+        SpiArbiter *_bus = nullptr;
+        TaskHandle_t _task = nullptr;
+        File _file;
+        std::atomic<bool> _ready{false};        // the file is open and allocated
+
+        // write ring, producer write(), consumer the task; offsets in the stream
+        uint8_t *_wring = nullptr;
+        std::atomic<uint32_t> _whead{0};        // bytes appended
+        std::atomic<uint32_t> _wtail{0};        // bytes in the file
+
+        // read ring, producer the task, consumer pump()
+        uint8_t *_rring = nullptr;
+        std::atomic<uint32_t> _rhead{0};
+        std::atomic<uint32_t> _rtail{0};
+        uint32_t _readPos = 0;                  // stream offset of the byte at _rhead, task only
+        std::atomic<uint32_t> _seekReq{0};      // incremented by pump() for every seek
+        std::atomic<uint32_t> _seekAck{0};      // set by the task when the read ring is cleared
+        std::atomic<uint32_t> _seekPos{0};
+
+        // time index, written by write(), read by loop(), the same task
+        Mp3Scanner _scanner;
+        uint32_t _index[TIMESHIFT_SECONDS];     // stream offset of the first frame of a second
+        int      _seconds = 0;                  // seconds indexed
+        int      _firstSecond = 0;              // no rewind before, e.g. another station
+        uint64_t _usStream = 0;
+
+        // play state, loop() only
+        std::atomic<bool> _shifted{false};
+        bool     _paused = false;
+        uint32_t _playPos = 0;                  // stream offset of the next byte for the decoder
+        int      _playSecond = 0;
+        uint32_t _msSeek = 0;                   // start of a seek, 0 = none
+        bool     _empty = false;                // the read ring ran empty
+
+        uint32_t _bytesWritten = 0;
+        uint32_t _msWriting = 0;
+        uint32_t _msWriteMax = 0;
+        uint32_t _bytesRead = 0;
+        uint32_t _msReading = 0;
+        uint32_t _msSeekLast = 0;
+        uint32_t _msSeekMax = 0;
+        uint32_t _seeks = 0;
+        uint32_t _dropped = 0;
+        uint32_t _starved = 0;
+        uint32_t _overruns = 0;
+};
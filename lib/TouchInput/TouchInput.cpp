@@ -0,0 +1,174 @@
+/**
+ * Class        Implementation of the class methods of TouchInput
+ * 
+ * Purpose      Touch sampling driven by the pen interrupt of the XPT2046
+ *              and recognition of the gestures
+ *              - Tap        short touch without movement
+ *              - LongPress  touch without movement held for TOUCH_LONGPRESS_MS
+ *              - Drag       movement after the pen has left its start position
+ *              - SwipeLeft / SwipeRight  fast horizontal drag
+ *              Down, Drag and Up are posted as raw material for widgets.
+ * 
+ * Remarks      The PENIRQ line also toggles during conversions, therefore 
+ *              interrupts are ignored while a touch is tracked.
+ */
+#include "TouchInput.h"
+
+
+void TouchInput::begin(UBaseType_t priority, BaseType_t core)
+{
+    _queue = xQueueCreateStatic(TOUCH_QUEUE_LEN, sizeof(TouchEvent), _queueStorage, &_queueCtrl);
+    xTaskCreatePinnedToCore(task, "touch", 3072, this, priority, &_task, core);
+    pinMode(_pinIrq, INPUT);
+    attachInterruptArg(digitalPinToInterrupt(_pinIrq), isr, this, FALLING);
+    log_i("==> done");
+}
+
+
+void TouchInput::setBus(SpiArbiter &bus)
+{
+    _bus = &bus;
+}
+
+
+void IRAM_ATTR TouchInput::isr(void *arg)
+{
+    TouchInput *self = static_cast<TouchInput *>(arg);
+    BaseType_t woken = pdFALSE;
+    if (self->_tracking) return;
+    self->_usIrq = micros();
+    vTaskNotifyGiveFromISR(self->_task, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+
+void TouchInput::task(void *arg)
+{
+    static_cast<TouchInput *>(arg)->run();
+}
+
+
+void TouchInput::run()
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // wait for the pen interrupt
+        _tracking = true;
+        track();
+        ulTaskNotifyTake(pdTRUE, 0);              // discard interrupts of the conversions
+        _tracking = false;
+    }
+}
+
+
+/**
+ * Follow one touch from pen down to pen up and post its events
+ */
+void TouchInput::track()
+{
+    int x, y, x0, y0;
+    int misses = 0;
+    bool dragging = false;
+    bool longPressed = false;
+
+    if (! sample(x0, y0)) return;  // spurious interrupt
+    int fx = x0 << 4, fy = y0 << 4; // IIR state in 1/16 pixel
+    uint32_t msDown = millis();
+    post(TouchEventType::Down, x0, y0, 0, 0);
+
+    for (;;)
+    {
+        vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_MS));
+        if (! sample(x, y))
+        {
+            if (++misses < TOUCH_RELEASE_MISSES) continue;
+            break;
+        }
+        misses = 0;
+        int px = fx >> 4, py = fy >> 4;
+        fx += ((x << 4) - fx) >> 1;     // alpha = 1/2
+        fy += ((y << 4) - fy) >> 1;
+        int dx = (fx >> 4) - x0, dy = (fy >> 4) - y0;
+
+        if (! dragging && ! longPressed && (abs(dx) > TOUCH_DRAG_MIN_PX || abs(dy) > TOUCH_DRAG_MIN_PX)) dragging = true;
+        if (dragging && ((fx >> 4) != px || (fy >> 4) != py)) post(TouchEventType::Drag, fx >> 4, fy >> 4, dx, dy);
+        if (! dragging && ! longPressed && millis() - msDown >= TOUCH_LONGPRESS_MS)
+        {
+            post(TouchEventType::LongPress, fx >> 4, fy >> 4, dx, dy);
+            longPressed = true;
+        }
+    }
+
+    x = fx >> 4;  y = fy >> 4;
+    int dx = x - x0, dy = y - y0;
+    uint32_t ms = millis() - msDown;
+    post(TouchEventType::Up, x, y, dx, dy);
+    if (! dragging && ! longPressed && ms < TOUCH_TAP_MAX_MS) post(TouchEventType::Tap, x0, y0, 0, 0);
+    if (dragging && ms < TOUCH_SWIPE_MAX_MS && abs(dx) >= TOUCH_SWIPE_MIN_DX && abs(dx) > 2 * abs(dy))
+    {
+        post(dx < 0 ? TouchEventType::SwipeLeft : TouchEventType::SwipeRight, x, y, dx, dy);
+    }
+}
+
+
+/**
+ * Median of three readings, rejects single outliers of the XPT2046
+ */
+bool TouchInput::sample(int &x, int &y)
+{
+    int xs[3], ys[3];
+    auto median = [](int *v) { return std::max(std::min(v[0], v[1]), std::min(std::max(v[0], v[1]), v[2])); };
+
+    bool touched = true;
+    {
+        SpiLease lease(_bus, SpiClient::Touch);
+        for (int i = 0; i < 3 && touched; i++) touched = _read(_lcd, xs[i], ys[i]);
+    }
+    if (! touched) return false;
+    x = median(xs);
+    y = median(ys);
+    return true;
+}
+
+
+void TouchInput::post(TouchEventType type, int x, int y, int dx, int dy)
+{
+    TouchEvent e;
+    e.type = type;
+    e.x = x;  e.y = y;
+    e.dx = dx;  e.dy = dy;
+    e.usPenDown = _usIrq;
+    e.usLatency = micros() - _usIrq;
+    if (type == TouchEventType::Down)
+    {
+        _usLatencyLast = e.usLatency;
+        if (_usLatencyLast > _usLatencyMax) _usLatencyMax = _usLatencyLast;
+    }
+    _events++;
+    if (xQueueSend(_queue, &e, 0) != pdTRUE) _dropped++;
+}
+
+
+bool TouchInput::getEvent(TouchEvent &e, TickType_t wait)
+{
+    return _queue && xQueueReceive(_queue, &e, wait) == pdTRUE;
+}
+
+
+uint32_t TouchInput::usLatencyLast()
+{
+    return _usLatencyLast;
+}
+
+
+uint32_t TouchInput::usLatencyMax()
+{
+    return _usLatencyMax;
+}
+
+
+void TouchInput::printStats()
+{
+    log_i("touch events %lu, dropped %lu, pen-to-event latency %lu us (max %lu us)", 
+          _events, _dropped, _usLatencyLast, _usLatencyMax);
+}
@@ -0,0 +1,83 @@
+/**
+ * Header       TouchInput.h
+ * 
+ * Purpose      Declaration of the class TouchInput. The pen interrupt of the 
+ *              XPT2046 wakes a task that samples the touchpad while it is 
+ *              touched, filters the positions (median of 3, then IIR) and 
+ *              recognizes gestures. Events are posted to a queue that is read 
+ *              without blocking, e.g. in loop(). With setBus() every sample
+ *              holds the shared SPI bus, the SD card may be used in between.
+ * 
+ * Usage        TouchInput touch(lcd, getMappedTouch);
+ *              touch.setBus(vspi);
+ *              touch.begin();
+ *              TouchEvent e;
+ *              while (touch.getEvent(e)) { ... }
+ */
+#pragma once
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include "lgfx_esp32-2432S028.h"
+#include "SpiArbiter.h"
+
+const int TOUCH_QUEUE_LEN      = 16;
+const int TOUCH_SAMPLE_MS      = 10;   // sampling period while touched
+const int TOUCH_RELEASE_MISSES = 2;    // samples without touch until pen up
+const int TOUCH_TAP_MAX_MS     = 400;  // longer touches are no taps
+const int TOUCH_LONGPRESS_MS   = 800;
+const int TOUCH_DRAG_MIN_PX    = 8;    // movement that starts a drag
+const int TOUCH_SWIPE_MIN_DX   = 60;   // horizontal distance of a swipe
+const int TOUCH_SWIPE_MAX_MS   = 600;
+
+// Reads the mapped screen coordinates, returns false if not touched
+using TouchReader = bool(*)(LGFX &lcd, int &x, int &y);
+
+enum class TouchEventType : uint8_t { Down, Drag, Up, Tap, LongPress, SwipeLeft, SwipeRight };
+
+struct TouchEvent
+{
+    TouchEventType type;
+    int16_t  x, y;       // filtered position
+    int16_t  dx, dy;     // displacement since pen down
+    uint32_t usPenDown;  // time of the pen interrupt
+    uint32_t usLatency;  // from the pen interrupt until the event was posted
+};
+
+class TouchInput
+{
+    public:
+        TouchInput(LGFX &lcd, TouchReader read, int pinIrq=TP_IRQ) : 
+            _lcd(lcd), _read(read), _pinIrq(pinIrq)
+        {}
+
+        void begin(UBaseType_t priority=3, BaseType_t core=0);
+        void setBus(SpiArbiter &bus);
+        bool getEvent(TouchEvent &e, TickType_t wait=0);
+        uint32_t usLatencyLast();
+        uint32_t usLatencyMax();
+        void printStats();
+
+    private:
+        static void IRAM_ATTR isr(void *arg);
+        static void task(void *arg);
+        void run();
+        void track();
+        bool sample(int &x, int &y);
+        void post(TouchEventType type, int x, int y, int dx, int dy);
+
+        LGFX &_lcd;
+        TouchReader _read;
+        int _pinIrq;
+        SpiArbiter *_bus = nullptr;
+        TaskHandle_t  _task = nullptr;
+        QueueHandle_t _queue = nullptr;
+        StaticQueue_t _queueCtrl;
+        uint8_t       _queueStorage[TOUCH_QUEUE_LEN * sizeof(TouchEvent)];
+
+        volatile bool     _tracking = false;
+        volatile uint32_t _usIrq = 0;
+        uint32_t _usLatencyLast = 0;
+        uint32_t _usLatencyMax = 0;
+        uint32_t _events = 0;
+        uint32_t _dropped = 0;
+};
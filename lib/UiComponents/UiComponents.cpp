@@ -1,10 +1,61 @@
 #include "UiComponents.h"
 
 
-double fmap(double x, double in_min, double in_max, double out_min, double out_max)
-{
-  double v = (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
-  return fabs(v) < 1.0e-12 ? 0.0 : v;  // prevents exponential representation like -4.0957e-16
+/**
+ * Format a scaled integer with the given number of decimal places 
+ * without printf and floating point. Trailing zeros of the fraction 
+ * are removed. Returns the length of the text.
+ */
+int uiFormat(char *buf, int size, int32_t v, int decimals)
+{
+    char tmp[16];
+    int n = 0;
+    bool neg = v < 0;
+    uint32_t u = neg ? -(uint32_t)v : (uint32_t)v;
+
+    while (n < decimals && u % 10 == 0) { u /= 10; decimals--; }  // trailing zeros
+    do
+    {
+        tmp[n++] = '0' + u % 10;
+        u /= 10;
+        if (n == decimals) tmp[n++] = '.';
+    } while (u != 0 || n <= decimals);
+    if (tmp[n-1] == '.') tmp[n++] = '0';
+    if (neg) tmp[n++] = '-';
+
+    int len = 0;
+    while (n > 0 && len < size-1) buf[len++] = tmp[--n];
+    buf[len] = '\0';
+    return len;
+}
+
+/**
+ * Parse a decimal number like "-12.5" into a scaled integer.
+ * Surplus decimal places are truncated. Returns false for invalid text.
+ */
+bool uiParse(const char *str, int32_t &v, int decimals)
+{
+    int64_t acc = 0;
+    int frac = -1;  // number of fraction digits, -1 = no decimal point yet
+    bool neg = *str == '-';
+    bool digits = false;
+
+    if (neg) str++;
+    for (; *str; str++)
+    {
+        if (*str == '.' && frac < 0) { frac = 0; continue; }
+        if (*str < '0' || *str > '9') return false;
+        if (frac >= decimals) continue;
+        acc = acc * 10 + (*str - '0');
+        if (acc > INT32_MAX) return false;
+        if (frac >= 0) frac++;
+        digits = true;
+    }
+    if (frac < 0) frac = 0;
+    for (; frac < decimals; frac++) acc *= 10;
+    if (! digits || acc > INT32_MAX) return false;
+    v = neg ? -(int32_t)acc : (int32_t)acc;
+    return true;
 }
 
 //                Text       Background  Border  Shadow  Font
@@ -14,18 +65,38 @@ UiTheme defaultTheme;
 
 void UiButton::draw()
 {
-    _lcd.drawRoundRect(_x+2, _y+2, _w, _h, _r, _theme._shadowColor);
-    _lcd.drawRoundRect(_x+1, _y+1, _w, _h, _r, _theme._shadowColor);
-    _lcd.fillRoundRect(_x, _y, _w, _h, _r, _theme._borderColor);
-    _lcd.fillRoundRect(_x+2, _y+2, _w-4, _h-4, _r, _theme._bodyColor);
-    _lcd.setTextDatum(textdatum_t::middle_center);
-    _lcd.setTextColor(_theme._textColor, _theme._bodyColor);
-    _lcd.setFont(_theme._font);
-    _lcd.drawString(_value, _x+_w/2, _y+2+_h/2);
-    _lcd.setTextDatum(textdatum_t::middle_left);
-    _lcd.setTextColor(_theme._textColor, _parent->getPanelColor());
-    _lcd.drawString(_label, _x+_w+_d, _y+2+_h/2);
-    
+    drawFrame();
+    drawValueText();
+    drawLabel();
+}
+
+void UiButton::drawFrame()
+{
+    _fb.drawRoundRect(_x+2, _y+2, _w, _h, _r, _theme._shadowColor);
+    _fb.drawRoundRect(_x+1, _y+1, _w, _h, _r, _theme._shadowColor);
+    _fb.fillRoundRect(_x, _y, _w, _h, _r, _theme._borderColor);
+    _fb.fillRoundRect(_x+2, _y+2, _w-4, _h-4, _r, _theme._bodyColor);
+}
+
+void UiButton::drawValueText()
+{
+    _fb.setTextDatum(textdatum_t::middle_center);
+    _fb.setTextColor(_theme._textColor, _theme._bodyColor);
+    _fb.setFont(_theme._font);
+    _fb.drawString(_value, _x+_w/2, _y+2+_h/2);
+}
+
+void UiButton::drawLabel()
+{
+    _fb.setTextDatum(textdatum_t::middle_left);
+    _fb.setTextColor(_theme._textColor, _parent->getPanelColor());
+    _fb.drawString(_label, _x+_w+_d, _y+2+_h/2);
+}
+
+// Called when only the value has changed
+void UiButton::redrawValue()
+{
+    draw();
 }
 
 bool UiButton::touched(int x, int y)
@@ -33,35 +104,43 @@ bool UiButton::touched(int x, int y)
     return (x > _x && x < _x+_w && y > _y && y < _y+_h);
 }
 
-void UiButton::clearValue()
+void UiButton::getBounds(int &x, int &y, int &w, int &h)
 {
-    _value= "";
-    draw();
+    x = _x;  y = _y;  w = _w;  h = _h;
 }
 
-String UiButton::getValue() 
+UiPanel *UiButton::getPanel()
 {
-    return _value;
+    return _parent;
 }
 
-void UiButton::getValue(String &value) 
-{ 
-    value = _value; 
+void UiButton::clearValue()
+{
+    _value[0] = '\0';
+    redrawValue();
+}
+
+const char *UiButton::getValue() 
+{
+    return _value;
 }
 
 void UiButton::getValue(int &value) 
 { 
-    value = _value.toInt(); 
+    int32_t v = 0;
+    uiParse(_value, v, 0);
+    value = v; 
 }
 
-void UiButton::getValue(double &value) 
+void UiButton::getValue(UiFixed &value) 
 { 
-    value = _value.toDouble(); 
+    value.raw = 0;
+    uiParse(_value, value.raw, UiFixed::decimals); 
 }
 
-String UiButton::getLabel() 
+const char *UiButton::getLabel() 
 {
-    return(_label);
+    return _label;
 }
 
 bool UiButton::rangeIsInteger() 
@@ -79,68 +158,64 @@ UiButton *UiButton::getSlider()
     return _pSlider; 
 }
 
+void UiButton::setText(const char *value, const char *label)
+{
+    strlcpy(_value, value, sizeof(_value));
+    strlcpy(_label, label, sizeof(_label));
+}
 
-void UiButton::updateValue(String value)
+// Limit the value to the range, if a range is set
+int32_t UiButton::clamp(int32_t v)
 {
-    _value = value;
-    draw();
+    if (_min == 0 && _max == 0) return v;
+    return v < _min ? _min : v > _max ? _max : v;
+}
+
+void UiButton::updateValue(const char *value)
+{
+    strlcpy(_value, value, sizeof(_value));
+    redrawValue();
 }
 
 void UiButton::updateValue(int value)
 {
-    char buf[24];
-    if (_minInt!=0 || _maxInt!=0) // a range is set
-    {
-        if (value < _minInt) value = _minInt;  // limit the value to the range
-        if (value > _maxInt) value = _maxInt;
-    }
-    snprintf(buf, sizeof(buf), "%d", value);
-    _value = buf;
-    //log_i("Int value in %d, value out %s", value, _value);
-    draw();
+    uiFormat(_value, sizeof(_value), _rangeIsInteger ? clamp(value) : value, 0);
+    redrawValue();
 }
 
-void UiButton::updateValue(double value)
+void UiButton::updateValue(UiFixed value)
 {
-    char buf[24];
-    if (_minDouble!=0.0 || _maxDouble!=0.0) // a range is set
-    {
-        if (value < _minDouble) value = _minDouble; // limit the value to the range
-        if (value > _maxDouble) value = _maxDouble;
-    }
-    snprintf(buf, sizeof(buf), "%.10g", value);
-    _value = buf;
-    //log_i("Double value in %.4g, value out %s", value, _value);
-    draw();
+    uiFormat(_value, sizeof(_value), _rangeIsInteger ? value.raw : clamp(value.raw), UiFixed::decimals);
+    redrawValue();
 }
 
-void UiButton::setLabel(String label)
+void UiButton::setLabel(const char *label)
 {
-    _label = label;
-    draw(); //_lcd.drawString(_label, _x+_w+_d, _y+2+_h/2);
+    strlcpy(_label, label, sizeof(_label));
+    draw(); //_fb.drawString(_label, _x+_w+_d, _y+2+_h/2);
 }
 
 void UiButton::clearLabel()
 {
-    _lcd.setTextColor(_parent->getPanelColor());
-    _lcd.drawString(_label, _x+_w+_d, _y+2+_h/2);
+    _fb.setTextColor(_parent->getPanelColor());
+    _fb.drawString(_label, _x+_w+_d, _y+2+_h/2);
     log_i("_label=%s, color=%d", _label, _parent->getPanelColor());
-    _lcd.setTextColor(_theme._textColor); 
+    _fb.setTextColor(_theme._textColor); 
 }
 
 void UiButton:: setRange(int min, int max)
 {
     //log_i("Button setRange int %p", this);
-    _minInt = min;
-    _maxInt = max;
+    _min = min;
+    _max = max;
     _rangeIsInteger = true;
 }
 
-void UiButton:: setRange(double min, double max)
+void UiButton:: setRange(UiFixed min, UiFixed max)
 {
-    //log_i("Button setRange double %p", this);
-    _minDouble = min;
-    _maxDouble = max;
+    //log_i("Button setRange fixed %p", this);
+    _min = min.raw;
+    _max = max.raw;
     _rangeIsInteger = false;
 }
 
@@ -151,15 +226,178 @@ void UiButton::addSlider(UiButton *btn)
 // --- UiButton ---
 
 
+/**
+ * Render every character of the charset once into its own cell.
+ * Returns true when the atlas is ready (also on repeated calls).
+ */
+bool UiGlyphAtlas::begin()
+{
+    if (_ready) return true;
+
+    LGFX_Sprite cell;
+    char glyph[2] = { 0, 0 };
+    uint32_t nPixels = 0;
+
+    cell.setColorDepth(16);
+    cell.setFont(_theme._font);
+    _nGlyphs = std::min((int)strlen(_charset), _maxGlyphs);
+    _ch = cell.fontHeight();
+    for (int i = 0; i < _nGlyphs; i++)
+    {
+        glyph[0] = _charset[i];
+        _cw[i] = cell.textWidth(glyph);
+        _offset[i] = nPixels;
+        nPixels += _cw[i] * _ch;
+    }
+
+    if (nPixels > _maxPixels)
+    {
+        log_e("==> glyph cells need %lu pixels, only %lu available", nPixels, _maxPixels);
+        _nGlyphs = 0;  // covers() fails, values are drawn with the font
+        return false;
+    }
+    for (int i = 0; i < _nGlyphs; i++)
+    {
+        glyph[0] = _charset[i];
+        if (cell.createSprite(_cw[i], _ch) == nullptr) 
+        {
+            log_e("==> no memory for a glyph cell");
+            _nGlyphs = 0;
+            return false;
+        }
+        cell.fillScreen(_theme._bodyColor);
+        cell.setFont(_theme._font);
+        cell.setTextColor(_theme._textColor);
+        cell.setTextDatum(textdatum_t::middle_center);
+        cell.drawString(glyph, _cw[i]/2, _ch/2);
+        memcpy(&_cells[_offset[i]], cell.getBuffer(), _cw[i] * _ch * sizeof(uint16_t));
+        cell.deleteSprite();
+    }
+    log_i("%d glyphs, %lu of %lu bytes", _nGlyphs, nPixels * sizeof(uint16_t), _maxPixels * sizeof(uint16_t));
+    _ready = true;
+    return true;
+}
+
+bool UiGlyphAtlas::isReady()
+{
+    return _ready;
+}
+
+int UiGlyphAtlas::indexOf(char c)
+{
+    for (int i = 0; i < _nGlyphs; i++) { if (_charset[i] == c) return i; }
+    return -1;
+}
+
+bool UiGlyphAtlas::covers(const char *str)
+{
+    for (; *str; str++) { if (indexOf(*str) < 0) return false; }
+    return true;
+}
+
+int UiGlyphAtlas::glyphWidth(char c)
+{
+    int i = indexOf(c);
+    return i < 0 ? 0 : _cw[i];
+}
+
+int UiGlyphAtlas::textWidth(const char *str)
+{
+    int w = 0;
+    for (; *str; str++) w += glyphWidth(*str);
+    return w;
+}
+
+int UiGlyphAtlas::cellHeight()
+{
+    return _ch;
+}
+
+void UiGlyphAtlas::pushGlyph(UiFrameBuffer &fb, char c, int x, int y)
+{
+    int i = indexOf(c);
+    if (i < 0 || !_ready) return;
+    fb.pushImage(x, y, _cw[i], _ch, &_cells[_offset[i]]);
+}
+// --- UiGlyphAtlas ---
+
+
+void UiGlyphButton::draw()
+{
+    drawFrame();
+    _shownLen = -1; // the frame has erased all cells
+    redrawValue();
+    drawLabel();
+}
+
+/**
+ * Push only the cells of the value that differ from what is on screen.
+ * When the width of the value changes, the body is cleared and all
+ * cells are pushed, because the centered text has moved.
+ */
+void UiGlyphButton::redrawValue()
+{
+    uint32_t t0 = micros();
+    const char *v = _value;
+    int len = strlen(_value);
+
+    if (len > _maxCells || !_atlas.begin() || !_atlas.covers(v))
+    {
+        _shownLen = -2; // body holds text drawn with the font
+        UiButton::draw();
+        _cellsLastRedraw = len;
+        _usLastRedraw = micros() - t0;
+        return;
+    }
+
+    int x = _x + _w/2 - _atlas.textWidth(v)/2;
+    int y = _y + 2 + _h/2 - _atlas.cellHeight()/2;
+
+    _fb.setClipRect(_x+2, _y+2, _w-4, _h-4);
+    if (_shownLen == -2 || (_shownLen >= 0 && (len != _shownLen || (len > 0 && x != _shownX[0]))))
+    {
+        _fb.fillRoundRect(_x+2, _y+2, _w-4, _h-4, _r, _theme._bodyColor);
+        _shownLen = -1;
+    }
+
+    _cellsLastRedraw = 0;
+    for (int i = 0; i < len; i++)
+    {
+        if (i >= _shownLen || _shown[i] != v[i] || _shownX[i] != x)
+        {
+            _atlas.pushGlyph(_fb, v[i], x, y);
+            _shown[i]  = v[i];
+            _shownX[i] = x;
+            _cellsLastRedraw++;
+        }
+        x += _atlas.glyphWidth(v[i]);
+    }
+    _shownLen = len;
+    _fb.clearClipRect();
+    _usLastRedraw = micros() - t0;
+}
+
+uint32_t UiGlyphButton::usLastRedraw()
+{
+    return _usLastRedraw;
+}
+
+int UiGlyphButton::cellsLastRedraw()
+{
+    return _cellsLastRedraw;
+}
+// --- UiGlyphButton ---
+
+
 void UiLed::draw()
 {
-    _lcd.fillCircle(_x+2, _y+2, _radius, _theme._shadowColor);
-    _lcd.fillCircle(_x, _y, _radius, _theme._borderColor);
-    _isOn ? _lcd.fillCircle(_x, _y, _radius-2, _color) : _lcd.fillCircle(_x, _y, _radius-2, _theme._bodyColor);
-    _lcd.setTextDatum(textdatum_t::middle_left);
-    _lcd.setTextColor(_theme._textColor);
-    _lcd.setFont(_theme._font);
-    _lcd.drawString(_label, _x+_radius+2*_d, _y);
+    _fb.fillCircle(_x+2, _y+2, _radius, _theme._shadowColor);
+    _fb.fillCircle(_x, _y, _radius, _theme._borderColor);
+    _isOn ? _fb.fillCircle(_x, _y, _radius-2, _color) : _fb.fillCircle(_x, _y, _radius-2, _theme._bodyColor);
+    _fb.setTextDatum(textdatum_t::middle_left);
+    _fb.setTextColor(_theme._textColor);
+    _fb.setFont(_theme._font);
+    _fb.drawString(_label, _x+_radius+2*_d, _y);
 }
 
 bool UiLed::touched(int x, int y)
@@ -167,19 +405,24 @@ bool UiLed::touched(int x, int y)
     return (x > _x-_radius && x < _x+_radius && y > _y-_radius && y < _y+_radius);
 }
 
+void UiLed::getBounds(int &x, int &y, int &w, int &h)
+{
+    x = _x-_radius;  y = _y-_radius;  w = 2*_radius;  h = 2*_radius;
+}
+
 
 void UiLed::clearLabel()
 {
-    _lcd.setFont(_theme._font);
-    _lcd.setTextColor(_parent->getPanelColor());
-    _lcd.drawString(_label, _x+_radius+2*_d, _y);
-    _lcd.setTextColor(_theme._textColor);
+    _fb.setFont(_theme._font);
+    _fb.setTextColor(_parent->getPanelColor());
+    _fb.drawString(_label, _x+_radius+2*_d, _y);
+    _fb.setTextColor(_theme._textColor);
 }
 
 
-void UiLed::setLabel(String txt)
+void UiLed::setLabel(const char *txt)
 {
-    _label = txt;
+    strlcpy(_label, txt, sizeof(_label));
     draw();     
 }
 
@@ -192,7 +435,7 @@ void UiLed::on()
 {
     if (! _isOn)
     {
-        _lcd.fillCircle(_x, _y, _radius-2, _color);
+        _fb.fillCircle(_x, _y, _radius-2, _color);
         _isOn = true;
     }
 }  
@@ -201,7 +444,7 @@ void UiLed::off()
 {
     if (_isOn)
     {
-        _lcd.fillCircle(_x, _y, _radius-2, _theme._bodyColor);
+        _fb.fillCircle(_x, _y, _radius-2, _theme._bodyColor);
         _isOn = false;
     }
 } 
@@ -210,12 +453,12 @@ void UiLed::toggle()
 {
     if (_isOn)
     {
-        _lcd.fillCircle(_x, _y, _radius-2, _theme._bodyColor);
+        _fb.fillCircle(_x, _y, _radius-2, _theme._bodyColor);
         _isOn = false;
     }
     else
     {
-        _lcd.fillCircle(_x, _y, _radius-2, _color);
+        _fb.fillCircle(_x, _y, _radius-2, _color);
         _isOn = true;
     }
 }
@@ -224,57 +467,60 @@ void UiLed::toggle()
 
 void UiHslider::draw()
 {
-    _lcd.drawRoundRect(_x+2, _y+2, _w, _h, _r, _theme._shadowColor);
-    _lcd.drawRoundRect(_x+1, _y+1, _w, _h, _r, _theme._shadowColor);
-    _lcd.fillRoundRect(_x, _y, _w, _h, _r, _theme._borderColor);
-    _lcd.fillRoundRect(_x+2, _y+2, _w-4, _h-4, _r, _theme._bodyColor);
-    _lcd.fillCircle(_position, _y+_h/2, _rb, _color);
-    _lcd.drawCircle(_position, _y+_h/2, _rb, _theme._borderColor);
-    _lcd.setTextDatum(textdatum_t::middle_left);
-    _lcd.setTextColor(_theme._textColor, _parent->getPanelColor());
-    _lcd.setFont(_theme._font);
-    _lcd.drawString(_label, _x+_w+_d, _y+2+_h/2);    
-}
-
+    _fb.drawRoundRect(_x+2, _y+2, _w, _h, _r, _theme._shadowColor);
+    _fb.drawRoundRect(_x+1, _y+1, _w, _h, _r, _theme._shadowColor);
+    _fb.fillRoundRect(_x, _y, _w, _h, _r, _theme._borderColor);
+    _fb.fillRoundRect(_x+2, _y+2, _w-4, _h-4, _r, _theme._bodyColor);
+    _fb.fillCircle(_position, _y+_h/2, _rb, _color);
+    _fb.drawCircle(_position, _y+_h/2, _rb, _theme._borderColor);
+    _fb.setTextDatum(textdatum_t::middle_left);
+    _fb.setTextColor(_theme._textColor, _parent->getPanelColor());
+    _fb.setFont(_theme._font);
+    _fb.drawString(_label, _x+_w+_d, _y+2+_h/2);    
+}
+
+/**
+ * Position and value are mapped with integer arithmetic, the 
+ * 64 bit product keeps UiFixed ranges from overflowing.
+ */
 void UiHslider::slideToPosition(int x)
 {
-    _lcd.fillCircle(_position, _y+_h/2, _h, _parent->getPanelColor());
-    _position = x;
+    _fb.fillCircle(_position, _y+_h/2, _h, _parent->getPanelColor());
+    _position = constrain(x, _x, _x+_w-2*_r); // x may be outside when dragged
+    int32_t v = _min + (int64_t)(_position-_x) * (_max-_min) / (_w-2*_r);
     if (rangeIsInteger())
     {
-        int v = map(_position-_x, 0, _w-2*_r, _minInt, _maxInt);
-        if (_pValueField) getValueField()->updateValue(v);
-        //log_i("Int x=%d, _w=%d, v=%d, min=%d, max=%d", x, _w, v, _minInt, _maxInt);
-        _value = String(v);
+        if (_pValueField) getValueField()->updateValue((int)v);
+        uiFormat(_value, sizeof(_value), v, 0);
     }
     else
     {
-        double v = fmap(_position-_x, 0.0, _w-2*_r, _minDouble, _maxDouble);
-        if (_pValueField) getValueField()->updateValue(v);
-        //log_i("Double x=%d, w=%d, v=%.10g, min=%.10g, max=%.10g", x, _w, v, _minDouble, _maxDouble);
-        _value = String(v);
+        if (_pValueField) getValueField()->updateValue(UiFixed{v});
+        uiFormat(_value, sizeof(_value), v, UiFixed::decimals);
     }
-    
     draw(); 
 }
 
+void UiHslider::moveKnob(int32_t v)
+{
+    _fb.fillCircle(_position, _y+_h/2, _h, _parent->getPanelColor());
+    v = clamp(v);
+    _position = _max == _min ? _x : _x + (int64_t)(v-_min) * (_w-2*_r) / (_max-_min);
+}
+
 void UiHslider::slideToValue(int v)
 {
-    _lcd.fillCircle(_position, _y+_h/2, _h, _parent->getPanelColor());
-    _position = map(v, _minInt, _maxInt, 0, _w-2*_r) + _x;
+    moveKnob(v);
     if (_pValueField) _pValueField->updateValue(v);
-    _value = String(v);
+    uiFormat(_value, sizeof(_value), v, 0);
     draw(); 
 }
 
-void UiHslider::slideToValue(double v)
+void UiHslider::slideToValue(UiFixed v)
 {
-    _lcd.fillCircle(_position, _y+_h/2, _h, _parent->getPanelColor());
-    _position = fmap(v, _minDouble, _maxDouble, 0, _w) + _x;
-    char buf[24];
-    snprintf(buf,sizeof(buf), "%.4g", v);
-    if (_pValueField) _pValueField->updateValue(buf);
-    _value = buf;
+    moveKnob(v.raw);
+    if (_pValueField) _pValueField->updateValue(v);
+    uiFormat(_value, sizeof(_value), v.raw, UiFixed::decimals);
     draw(); 
 }
 
@@ -301,9 +547,9 @@ void UiHslider::setRange(int min, int max)
     if (_pValueField) _pValueField->setRange(min, max);
     UiButton::setRange(min, max);
 }
-void UiHslider::setRange(double min, double max)
+void UiHslider::setRange(UiFixed min, UiFixed max)
 {
-    //log_i("Slider setRange double vf %p", _pValueField);
+    //log_i("Slider setRange fixed vf %p", _pValueField);
     if (_pValueField) _pValueField->setRange(min, max);
     UiButton::setRange(min, max);
 }
@@ -312,14 +558,32 @@ void UiHslider::setRange(double min, double max)
 
 void UiPanel::show()
 {
-    _lcd.fillRect(_x,_y,_w,_h,_bgColor);
+    if (_store && _hidden) _store->save(_fb, _x, _y, _w, _h);
+    _fb.fillRect(_x,_y,_w,_h,_bgColor);
     _hidden = false;    
 }
 
 void UiPanel::hide(UiPanel *pCaller)
 {
     _hidden = true; 
-    pCaller == nullptr ? _lcd.fillRect(_x,_y,_w,_h,_lcd.getBaseColor()) : pCaller->show();
+    pCaller == nullptr ? _fb.fillRect(_x,_y,_w,_h,_fb.getBaseColor()) : pCaller->show();
+}
+
+/**
+ * Close a modal panel: restore the saved screen region or, 
+ * if there is none, redraw the panels below
+ */
+void UiPanel::close()
+{
+    _hidden = true;
+    if (_store && _store->restore(_fb)) return;
+    _fb.fillRect(_x,_y,_w,_h,_fb.getBaseColor());
+    redrawPanels();
+}
+
+void UiPanel::setBackingStore(UiBackingStore *store)
+{
+    _store = store;
 }
 
 bool UiPanel::isHidden()
@@ -337,114 +601,260 @@ int UiPanel::getPanelColor()
     return _bgColor; 
 }
 
-LGFX &UiPanel::getScreen() 
+UiFrameBuffer &UiPanel::getScreen() 
 { 
-    return _lcd; 
+    return _fb; 
 }
 
-void UiPanel::panelText(int x, int y, String text, int textColor, GFXfont font)
+void UiPanel::panelText(int x, int y, const char *text, int textColor, GFXfont font)
 {
-    //LGFX lcd = getScreen();
-    _lcd.setFont(&font);
-    _lcd.setTextColor(textColor);
-    _lcd.drawString(text, _x+x, _y+y);
+    _fb.setFont(&font);
+    _fb.setTextColor(textColor);
+    _fb.drawString(text, _x+x, _y+y);
 }
 // --- UiPanel ---
 
 
-void UiKeypad::show()
+/**
+ * Read the region from the frame buffer and store it, compressed 
+ * if requested. Returns false if it does not fit into the buffer.
+ * Lines are encoded as a sequence of
+ *   0x8000 | n, color   run of n equal pixels
+ *   n, n colors         n literal pixels
+ */
+bool UiBackingStore::save(UiFrameBuffer &fb, int x, int y, int w, int h)
 {
-    UiPanel::show();
-    _btnEntry->clearValue();
-    for (int i = 0; i < _btns.size(); i++) { _btns.at(i)->draw(); }
+    uint32_t t0 = micros();
+    _x = x; _y = y; _w = w; _h = h;
+    _used = 0;
+    _valid = w <= _maxWidth && (_compress || (uint32_t)w * h <= _words);
+    _saves++;
+
+    uint16_t *line = _compress ? _line : _buf;
+    for (int r = 0; r < h && _valid; r++)
+    {
+        fb.readRect(x, y + r, w, 1, line, true);
+        if (_compress) _valid = encodeLine(_line, w);
+        else line += w;
+    }
+    if (!_compress && _valid) _used = (uint32_t)w * h;
+    if (!_valid) 
+    {
+        _overflows++;
+        log_w("Region %dx%d does not fit into %u bytes", w, h, capacityBytes());
+    }
+    _usSave = micros() - t0;
+    return _valid;
 }
 
-void UiKeypad::handleKeys(int x, int y)
+
+bool UiBackingStore::encodeLine(const uint16_t *line, int w)
 {
-    int msKeyDelay = 300;
-    for (int i = 1; i < _btns.size(); i++)
+    int i = 0;
+    while (i < w)
     {
-        if (_btns.at(i)->touched(x, y))
+        int run = 1;
+        while (i + run < w && line[i + run] == line[i]) run++;
+        if (run >= 3)
         {
-            String keyValue = _btns.at(i)->getValue();
-            Serial.printf("Key pressed: %s\n", keyValue);
-            if (i > 0 && i < 12) // handle digits and decimal point
-            {
-                if (_btns.at(i)->getValue() == "." && _btnEntry->getValue().indexOf('.') > 0) return;
-                String newValue = _btnEntry->getValue() + _btns.at(i)->getValue();
-                _btnEntry->updateValue(newValue);
-                delay(msKeyDelay);
-                return;
-            }
+            if (_used + 2 > _words) return false;
+            _buf[_used++] = 0x8000 | run;
+            _buf[_used++] = line[i];
+            i += run;
+            continue;
+        }
+        // literal pixels up to the start of the next run of 3
+        int n = 0;
+        while (i + n < w && !(i + n + 2 < w && line[i+n] == line[i+n+1] && line[i+n] == line[i+n+2])) n++;
+        if (_used + 1 + n > _words) return false;
+        _buf[_used++] = n;
+        memcpy(&_buf[_used], &line[i], n * sizeof(uint16_t));
+        _used += n;
+        i += n;
+    }
+    return true;
+}
 
-            if (keyValue == "Clr") 
-                { 
-                    _btnEntry->updateValue(""); 
-                    return; 
-                }
-            if (keyValue == "C") 
-                { 
-                    _btnEntry->updateValue(_btnEntry->getValue().substring(0, _btnEntry->getValue().length()-1));
-                    delay(msKeyDelay); 
-                    return; 
-                }
-            if (keyValue =="+/-")
-                { 
-                    if (_btnEntry->getValue().length() > 0)
-                    {
-                        if (_btnEntry->getValue().indexOf('.') > 0) // it's a float
-                        {
-                            double v = _btnEntry->getValue().toDouble();
-                            if (v != 0) v = -v;
-                            _btnEntry->updateValue(v);
-                        }
-                        else
-                        {
-                            int v = _btnEntry->getValue().toInt(); // it's an integer
-                            v = -v;
-                            //log_i("int %d", v);
-                            _btnEntry->updateValue(v);
-                        }
-                        delay(msKeyDelay);
-                        return; 
-                    }  
-                }
-            if (keyValue == "X")
-            {
-                delay(msKeyDelay);
-                //log_e("==> done X");
-                hide();
-                UiPanel::redrawPanels(); // Called to restore underlying panels 
-                return;
-            }
-            if (keyValue == "OK")
+
+/**
+ * Write the saved region back into the frame buffer. 
+ * The store is consumed, a second restore() returns false.
+ */
+bool UiBackingStore::restore(UiFrameBuffer &fb)
+{
+    if (!_valid) return false;
+    uint32_t t0 = micros();
+    _valid = false;
+
+    if (!_compress)
+    {
+        fb.pushImage(_x, _y, _w, _h, _buf);
+    }
+    else
+    {
+        const uint16_t *p = _buf;
+        for (int r = 0; r < _h; r++)
+        {
+            for (int i = 0; i < _w; )
             {
-                delay(msKeyDelay);
-                String e = _btnEntry->getValue();
-                if (!_targetValueField->rangeIsInteger()) // The assigned value field contains floats
+                uint16_t n = *p++;
+                if (n & 0x8000)
                 {
-                    double v = e.toDouble();
-                    _targetValueField->updateValue(v);
-                    _targetValueField->getValue(v);
-                    //log_e("==> done OK: targetValueField=%p, slider=%p", _targetValueField, this);
-                    if (_targetValueField->hasSlider()) reinterpret_cast<UiHslider *>(_targetValueField->getSlider())->slideToValue(v);
+                    n &= 0x7FFF;
+                    for (int k = 0; k < n; k++) _line[i + k] = *p;
+                    p++;
                 }
                 else
                 {
-                    int v = e.toInt();                    // The assigned value field contains integers
-                    _targetValueField->updateValue(v);
-                    _targetValueField->getValue(v);
-                    //log_e("==> done OK: targetValueField=%p, slider=%p", _targetValueField, this);
-                    if (_targetValueField->hasSlider()) reinterpret_cast<UiHslider *>(_targetValueField->getSlider())->slideToValue(v);
-                } 
-                       
-                hide();
-                _okCallback(_targetValueField);
-                UiPanel::redrawPanels(); // Called to restore underlying panels
-                return;                
+                    memcpy(&_line[i], p, n * sizeof(uint16_t));
+                    p += n;
+                }
+                i += n;
             }
+            fb.pushImage(_x, _y + r, _w, 1, _line);
         }
-    }    
+    }
+    _usRestore = micros() - t0;
+    return true;
+}
+
+void UiBackingStore::invalidate()
+{
+    _valid = false;
+}
+
+bool UiBackingStore::isValid()
+{
+    return _valid;
+}
+
+uint32_t UiBackingStore::rawBytes()
+{
+    return (uint32_t)_w * _h * sizeof(uint16_t);
+}
+
+uint32_t UiBackingStore::usedBytes()
+{
+    return _used * sizeof(uint16_t);
+}
+
+uint32_t UiBackingStore::capacityBytes()
+{
+    return _words * sizeof(uint16_t);
+}
+
+void UiBackingStore::printStats(const char *name)
+{
+    log_i("%s: %dx%d saved in %u of %u bytes (raw %u), save %u us, restore %u us, %u saves, %u overflows",
+          name, _w, _h, usedBytes(), capacityBytes(), rawBytes(), _usSave, _usRestore, _saves, _overflows);
+}
+// --- UiBackingStore ---
+
+
+void UiKeypad::show()
+{
+    UiPanel::show();
+    _btnEntry.clearValue();
+    for (int i = 0; i < _btns.size(); i++) { _btns.at(i)->draw(); }
+}
+
+/**
+ * Register the keys with the dispatcher. The keypad must be 
+ * bound after the panels it covers, so that its keys win.
+ */
+void UiKeypad::bindKeys(UiDispatcher &d)
+{
+    UiButton *digits[] = { &_btn0, &_btn1, &_btn2, &_btn3, &_btn4, &_btn5, &_btn6, &_btn7, &_btn8, &_btn9, &_btnDot };
+    for (UiButton *b : digits) d.on(b, onDigit, this);
+    d.on(&_btnC,      onBackspace, this, UiFire::Repeat);
+    d.on(&_btnClr,    onClear,     this);
+    d.on(&_btnSign,   onSign,      this);
+    d.on(&_btnCancel, onCancel,    this);
+    d.on(&_btnOk,     onOk,        this);
+}
+
+// handle digits and decimal point
+void UiKeypad::onDigit(UiButton *btn, int x, int y, void *arg)
+{
+    UiKeypad *kp = static_cast<UiKeypad *>(arg);
+    const char *e = kp->_btnEntry.getValue();
+    const char *d = btn->getValue();
+    char buf[UiButton::maxValueLen+1];
+    int len = strlen(e);
+
+    if (*d == '.' && strchr(e, '.')) return;
+    if (len == UiButton::maxValueLen) return;
+    memcpy(buf, e, len);
+    buf[len] = *d;
+    buf[len+1] = '\0';
+    kp->_btnEntry.updateValue(buf);
+}
+
+void UiKeypad::onBackspace(UiButton *btn, int x, int y, void *arg)
+{
+    UiButton *entry = &static_cast<UiKeypad *>(arg)->_btnEntry;
+    char buf[UiButton::maxValueLen+1];
+    int len = strlen(entry->getValue());
+    if (len == 0) return;
+    memcpy(buf, entry->getValue(), len-1);
+    buf[len-1] = '\0';
+    entry->updateValue(buf);
+}
+
+void UiKeypad::onClear(UiButton *btn, int x, int y, void *arg)
+{
+    static_cast<UiKeypad *>(arg)->_btnEntry.updateValue("");
+}
+
+// Toggle the leading minus sign, the text is kept as typed
+void UiKeypad::onSign(UiButton *btn, int x, int y, void *arg)
+{
+    UiButton *entry = &static_cast<UiKeypad *>(arg)->_btnEntry;
+    const char *e = entry->getValue();
+    char buf[UiButton::maxValueLen+1];
+    if (*e == '\0') return;
+    if (*e == '-') 
+    {
+        entry->updateValue(e+1);
+        return;
+    }
+    int32_t v;
+    if (! uiParse(e, v, UiFixed::decimals) || v == 0) return;
+    buf[0] = '-';
+    strlcpy(buf+1, e, sizeof(buf)-1);
+    entry->updateValue(buf);
+}
+
+void UiKeypad::onCancel(UiButton *btn, int x, int y, void *arg)
+{
+    static_cast<UiKeypad *>(arg)->close();
+}
+
+void UiKeypad::onOk(UiButton *btn, int x, int y, void *arg)
+{
+    UiKeypad *kp = static_cast<UiKeypad *>(arg);
+    UiButton *target = kp->_targetValueField;
+    const char *e = kp->_btnEntry.getValue();
+    if (!target->rangeIsInteger()) // The assigned value field contains fixed-point numbers
+    {
+        UiFixed v = { 0 };
+        uiParse(e, v.raw, UiFixed::decimals);
+        target->updateValue(v);
+        target->getValue(v);
+        if (target->hasSlider()) reinterpret_cast<UiHslider *>(target->getSlider())->slideToValue(v);
+    }
+    else
+    {
+        int32_t raw = 0;
+        uiParse(e, raw, 0);                   // The assigned value field contains integers
+        int v = raw;
+        target->updateValue(v);
+        target->getValue(v);
+        if (target->hasSlider()) reinterpret_cast<UiHslider *>(target->getSlider())->slideToValue(v);
+    } 
+           
+    kp->close();
+    if (kp->_okCallback) kp->_okCallback(target);
 }
 
 void UiKeypad::addValueField(UiButton *btn) 
@@ -456,4 +866,136 @@ void UiKeypad::addOkCallback(Callback cb)
 {
     _okCallback = cb;
 }
-// --- UiKeypad ---
\ No newline at end of file
+// --- UiKeypad ---
+
+
+/**
+ * Register a handler for a widget and enter the widget 
+ * into all grid cells its bounds overlap.
+ */
+bool UiDispatcher::on(UiButton *btn, UiHandler handler, void *arg, UiFire fire)
+{
+    if (_nSlots == _maxSlots) return false;
+    int x, y, w, h;
+    int i = _nSlots++;
+    _slots[i] = { btn, handler, arg, fire, State::Idle, 0, 0 };
+
+    btn->getBounds(x, y, w, h);
+    int c0 = constrain(x / _cell, 0, _gridSize-1), c1 = constrain((x+w) / _cell, 0, _gridSize-1);
+    int r0 = constrain(y / _cell, 0, _gridSize-1), r1 = constrain((y+h) / _cell, 0, _gridSize-1);
+    for (int r = r0; r <= r1; r++)
+        for (int c = c0; c <= c1; c++) _grid[r*_gridSize + c] |= (1UL << i);
+    return true;
+}
+
+/**
+ * Returns the topmost visible widget at x, y or -1
+ */
+int UiDispatcher::hitTest(int x, int y)
+{
+    if (x < 0 || y < 0 || x >= _gridSize*_cell || y >= _gridSize*_cell) return -1;
+    uint32_t mask = _grid[(y / _cell)*_gridSize + x / _cell];
+    while (mask)
+    {
+        int i = 31 - __builtin_clz(mask);
+        mask &= ~(1UL << i);
+        Slot &s = _slots[i];
+        if (_modal && !_modal->isHidden() && s.btn->getPanel() != _modal) continue;
+        if (!s.btn->getPanel()->isHidden() && s.btn->touched(x, y)) return i;
+    }
+    return -1;
+}
+
+void UiDispatcher::fire(Slot &s, int x, int y)
+{
+    s.handler(s.btn, x, y, s.arg);
+}
+
+void UiDispatcher::penDown(int x, int y, uint32_t ms)
+{
+    _active = hitTest(x, y);
+    _lastDownHit = (_active >= 0);
+    if (_active < 0) return;
+
+    Slot &s = _slots[_active];
+    if (ms - s.msReleased < _msDebounce) // bouncing contact
+    {
+        _active = -1;
+        return;
+    }
+    s.state = State::Pressed;
+    s.msNext = ms + _msRepeatDelay;
+    if (s.fire != UiFire::OnRelease) fire(s, x, y);
+}
+
+void UiDispatcher::penMove(int x, int y, uint32_t ms)
+{
+    if (_active < 0) return;
+    Slot &s = _slots[_active];
+    if (s.fire == UiFire::Drag) 
+    {
+        fire(s, x, y);
+    }
+    else if (s.state != State::Cancelled && !s.btn->touched(x, y)) // pen slid off the widget
+    {
+        s.state = State::Cancelled;
+    }
+}
+
+void UiDispatcher::penUp(int x, int y, uint32_t ms)
+{
+    if (_active < 0) return;
+    Slot &s = _slots[_active];
+    if (s.fire == UiFire::OnRelease && s.state == State::Pressed && s.btn->touched(x, y)) fire(s, x, y);
+    s.state = State::Idle;
+    s.msReleased = ms;
+    _active = -1;
+}
+
+/**
+ * Call periodically to drive the auto-repeat
+ */
+void UiDispatcher::update(uint32_t ms)
+{
+    if (_active < 0) return;
+    Slot &s = _slots[_active];
+    if (s.fire != UiFire::Repeat || s.state == State::Cancelled || (int32_t)(ms - s.msNext) < 0) return;
+    s.state = State::Repeating;
+    s.msNext = ms + _msRepeatRate;
+    fire(s, -1, -1);
+}
+
+/**
+ * True if the last pen down hit a widget, e.g. to ignore 
+ * a swipe that started on a button or moved a slider
+ */
+bool UiDispatcher::lastDownHitWidget()
+{
+    return _lastDownHit;
+}
+
+// The widget held down or nullptr
+UiButton *UiDispatcher::pressed()
+{
+    return _active >= 0 ? _slots[_active].btn : nullptr;
+}
+
+// The pen up does not fire the widget held down, e.g. after a long press
+void UiDispatcher::cancel()
+{
+    if (_active >= 0) _slots[_active].state = State::Cancelled;
+}
+
+// While the panel is shown, touches elsewhere are ignored
+void UiDispatcher::setModal(UiPanel *modal)
+{
+    _modal = modal;
+}
+
+void UiDispatcher::setTiming(uint16_t msDebounce, uint16_t msRepeatDelay, uint16_t msRepeatRate)
+{
+    _msDebounce = msDebounce;
+    _msRepeatDelay = msRepeatDelay;
+    _msRepeatRate = msRepeatRate;
+}
+// --- UiDispatcher ---
@@ -2,7 +2,8 @@
 #include <Arduino.h>
 #include <LovyanGFX.hpp>
 #include "lgfx_esp32-2432S028.h"
-#include <vector>
+#include "UiFrameBuffer.h"
+#include <array>
 
 #define DARKERGREY 0x3166
 
@@ -10,8 +11,11 @@
 //Forward declaration
 class UiKeypad;
 class UiButton;
+class UiBackingStore;
+class UiDispatcher;
 
 using Callback = void(*)(UiButton *);
+using UiHandler = void(*)(UiButton *btn, int x, int y, void *arg);
 
 class UiTheme
 {
@@ -33,134 +37,293 @@ class UiTheme
 extern UiTheme defaultTheme;
 extern UiTheme blueTheme;
 
+// Fixed-point number with 4 decimal places. The ESP32 has no double
+// precision FPU, so values and ranges of the widgets are kept as scaled 
+// integers. from() is meant for constants and is evaluated by the compiler.
+struct UiFixed
+{
+    static constexpr int32_t scale = 10000;
+    static constexpr int decimals = 4;
+    int32_t raw;
+
+    static constexpr UiFixed from(double v) { return { int32_t(v * scale + (v < 0 ? -0.5 : 0.5)) }; }
+    static UiFixed fromFloat(float v) { return { (int32_t)lroundf(v * scale) }; }
+    float toFloat() const { return raw / (float)scale; }
+};
+
+int  uiFormat(char *buf, int size, int32_t v, int decimals);
+bool uiParse(const char *str, int32_t &v, int decimals);
+
+// Rectangle of a compile-time layout
+struct UiRect 
+{ 
+    int16_t x, y, w, h; 
+
+    constexpr UiRect offset(int dx, int dy) const { return { int16_t(x+dx), int16_t(y+dy), w, h }; }
+};
+
+// Saves the screen region under a modal panel (e.g. the keypad) before
+// it is shown and restores it when it is closed, so that the panels 
+// below need not be redrawn. The region is read from the frame buffer
+// line by line and optionally compressed into the caller's buffer as 
+// runs of equal pixels, which suits the flat panels.
+// If the region does not fit, restore() fails and the caller falls back 
+// to redrawing the panels. Panels covered by the modal must not draw
+// while it is shown, otherwise invalidate() the store.
+//   uint16_t keypadStore[8192];    // 16 KB instead of 53 KB for 180x149 raw
+//   UiBackingStore store(keypadStore, 8192);
+//   keypad.setBackingStore(&store);
+class UiBackingStore
+{
+    public:
+        UiBackingStore(uint16_t *buf, uint32_t words, bool compress=true) :
+            _buf(buf), _words(words), _compress(compress)
+        {}
+
+        bool save(UiFrameBuffer &fb, int x, int y, int w, int h);
+        bool restore(UiFrameBuffer &fb);
+        void invalidate();
+        bool isValid();
+
+        uint32_t rawBytes();        // size of the last saved region uncompressed
+        uint32_t usedBytes();       // bytes of the buffer holding it
+        uint32_t capacityBytes();
+        void printStats(const char *name);
+
+    private:
+        static const int _maxWidth = 320;    // longest line of the display
+        bool encodeLine(const uint16_t *line, int w);
+
+        uint16_t *_buf;
+        uint32_t _words;
+        bool     _compress;
+        bool     _valid = false;
+        int16_t  _x = 0, _y = 0, _w = 0, _h = 0;
+        uint32_t _used = 0;                  // words in _buf
+        uint16_t _line[_maxWidth];
+
+        uint32_t _saves = 0;
+        uint32_t _overflows = 0;
+        uint32_t _usSave = 0;
+        uint32_t _usRestore = 0;
+};
+
 // A panel is the rectangular container of other GUI components.
-// It can freely be placed on the lcd screen. The components are placed 
-// relative to the panels origin (left upper corner).
+// It can freely be placed on the screen. The components are placed 
+// relative to the panels origin (left upper corner). Panels and
+// components draw into the frame buffer, which is pushed to the display
+// at the end of each frame of the renderer.
 // An optional keypad for entering numbers can be associated with the panel.
 // The user has to derive his custom panels from this class. For each
 // custom panel he must implement a keyhandler function, that processes 
 // the inputs on the touch screen. 
+// A modal panel with a backing store saves the screen under it in show()
+// and close() restores it; without a store close() redraws all panels.
 class UiPanel
 {   
     public:
-        static std::vector<UiPanel *> panels; // Holds all panels defined in main
-        static void redrawPanels() // Redraw all panels. Called when Keypad is closed
+        static const int maxPanels = 8;
+        static UiPanel *panels[maxPanels]; // Holds all panels defined in main, unused entries are nullptr
+        static void redrawPanels() // Redraw all visible panels. Called when a modal without backing store is closed
         { 
-            for (int i = 0; i < panels.size(); i++) panels.at(i)->show(); 
+            for (int i = 0; i < maxPanels && panels[i]; i++) { if (! panels[i]->isHidden()) panels[i]->show(); }
         }
 
-        UiPanel(LGFX &lcd, bool hidden) : 
-            _lcd(lcd), _hidden(hidden)
+        UiPanel(UiFrameBuffer &fb, bool hidden) : 
+            _fb(fb), _hidden(hidden)
+        {}
+
+        UiPanel(UiFrameBuffer &fb, int bgColor, bool hidden) : 
+            _fb(fb), _bgColor(bgColor), _hidden(hidden)
         {}
 
-        UiPanel(LGFX &lcd, int bgColor, bool hidden) : 
-            _lcd(lcd), _bgColor(bgColor), _hidden(hidden)
+        UiPanel(UiFrameBuffer &fb, int x, int y, int w, int h, int bgColor, bool hidden) : 
+            _fb(fb), _x(x), _y(y), _w(w), _h(h), _bgColor(bgColor), _hidden(hidden)
         {}
 
-        UiPanel(LGFX &lcd, int x, int y, int w, int h, int bgColor, bool hidden) : 
-            _lcd(lcd), _x(x), _y(y), _w(w), _h(h), _bgColor(bgColor), _hidden(hidden)
+        UiPanel(UiFrameBuffer &fb, int x, int y, int w, int h,  bool hidden) : 
+            _fb(fb), _x(x), _y(y),  _w(w), _h(h), _hidden(hidden)
         {}
 
-        UiPanel(LGFX &lcd, int x, int y, int w, int h,  bool hidden) : 
-            _lcd(lcd), _x(x), _y(y),  _w(w), _h(h), _hidden(hidden)
+        UiPanel(UiFrameBuffer &fb, UiRect r, int bgColor, bool hidden) : 
+            _fb(fb), _x(r.x), _y(r.y), _w(r.w), _h(r.h), _bgColor(bgColor), _hidden(hidden)
         {}
 
         virtual void show(); 
         void hide(UiPanel *pCaller=nullptr);
         bool isHidden();
+        void close();
         void addKeypad(UiKeypad *pKeypad);
+        void setBackingStore(UiBackingStore *store);
         int getPanelColor();
-        void panelText(int x, int y, String text, int textColor=TFT_BLACK,  GFXfont=fonts::DejaVu18);
-        LGFX &getScreen();
+        void panelText(int x, int y, const char *text, int textColor=TFT_BLACK,  GFXfont=fonts::DejaVu18);
+        UiFrameBuffer &getScreen();
         
     protected:
-        LGFX &_lcd;
+        UiFrameBuffer &_fb;
         int _x = 0;
         int _y = 0;
-        int _w = _lcd.width(); 
-        int _h = _lcd.height();
+        int _w = _fb.width(); 
+        int _h = _fb.height();
         int _bgColor = TFT_BLACK;    
         bool _hidden = true;
         UiKeypad *_pKeypad = nullptr;
+        UiBackingStore *_store = nullptr;
 };
 
 
 // Button acts as pushbutton or input/output value field.
-// The components UiLed and UiSlider are derived classes from UiButton
+// The components UiLed and UiSlider are derived classes from UiButton.
+// Value and label are kept in fixed-size buffers, longer texts are 
+// truncated. Numeric values are integers or UiFixed numbers.
 class UiButton
 {
     public:
-        UiButton(UiPanel *parent, int x, int y, int w, int h, UiTheme &theme, String value="", String label="") : 
-            _parent(parent), _x(x), _y(y), _w(w), _h(h), _theme(theme), _value(value), _label(label)
-        {}    
+        static const int maxValueLen = 23;
+        static const int maxLabelLen = 31;
 
-        UiButton(UiPanel *parent, int x, int y, int w, int h, String value="", String label="") : 
-            _parent(parent), _x(x), _y(y), _w(w), _h(h), _value(value), _label(label)
-        {}
+        UiButton(UiPanel *parent, int x, int y, int w, int h, UiTheme &theme, const char *value="", const char *label="") : 
+            _parent(parent), _x(x), _y(y), _w(w), _h(h), _theme(theme)
+        { setText(value, label); }    
+
+        UiButton(UiPanel *parent, int x, int y, int w, int h, const char *value="", const char *label="") : 
+            _parent(parent), _x(x), _y(y), _w(w), _h(h)
+        { setText(value, label); }
 
         UiButton(UiPanel *parent, int x, int y, int w, int h) : 
             _parent(parent), _x(x), _y(y), _w(w), _h(h)
         {}
 
+        UiButton(UiPanel *parent, UiRect r, const char *value="", const char *label="") : 
+            _parent(parent), _x(r.x), _y(r.y), _w(r.w), _h(r.h)
+        { setText(value, label); }
+
         virtual void draw();
+        virtual void redrawValue();
         virtual void clearLabel();
         virtual bool touched(int x, int y);
+        virtual void getBounds(int &x, int &y, int &w, int &h);
+        UiPanel *getPanel();
         void clearValue();
-        String getValue();
-        void getValue(String &value);
+        const char *getValue();
         void getValue(int &value);
-        void getValue(double &value);
-        void updateValue(String value);
+        void getValue(UiFixed &value);
+        void updateValue(const char *value);
         void updateValue(int value);
-        void updateValue(double value);
-        void setLabel(String label);
-        String getLabel();
+        void updateValue(UiFixed value);
+        void setLabel(const char *label);
+        const char *getLabel();
         void setRange(int min, int max);
-        void setRange(double min, double max);
+        void setRange(UiFixed min, UiFixed max);
         bool rangeIsInteger();
         void addSlider(UiButton* pSlider);
         bool hasSlider();
         UiButton *getSlider();
 
     protected:  
+        void setText(const char *value, const char *label);
+        int32_t clamp(int32_t v);
+        void drawFrame();
+        void drawValueText();
+        void drawLabel();
+
         int _x = 0;
         int _y = 0;
         int _w; 
         int _h;
         int _d = 8;
         int _r = 4;
-        int    _minInt = 0;
-        int    _maxInt = 0;
-        int    _valInt = 0;
-        double _minDouble = 0.0;
-        double _maxDouble = 0.0;
-        double _valDouble = 0.0;
+        int32_t _min = 0;   // range, integer or UiFixed::raw
+        int32_t _max = 0;
         bool _rangeIsInteger = true; 
         UiPanel *_parent;
         UiButton *_pSlider = nullptr;
-        LGFX &_lcd = _parent->getScreen();
+        UiFrameBuffer &_fb = _parent->getScreen();
         UiTheme &_theme=defaultTheme;
-        String _value="";
-        String _label="";
+        char _value[maxValueLen+1] = "";
+        char _label[maxLabelLen+1] = "";
 };  //--- UiButton ---
 
 
+// Pre-rasterized glyphs of a small character set (digits and separators)
+// rendered once with the font and colors of a theme. Each glyph is stored 
+// as a contiguous RGB565 cell of its advance width and the font height,
+// so it can be copied into the frame buffer in one go. The cells are 
+// kept in a statically allocated array of maxPixels supplied by the user.
+class UiGlyphAtlas
+{
+    public:
+        UiGlyphAtlas(UiTheme &theme, const char *charset, uint16_t *cells, uint32_t maxPixels) : 
+            _theme(theme), _charset(charset), _cells(cells), _maxPixels(maxPixels)
+        {}
+
+        bool begin();
+        bool isReady();
+        bool covers(const char *str);
+        int  glyphWidth(char c);
+        int  textWidth(const char *str);
+        int  cellHeight();
+        void pushGlyph(UiFrameBuffer &fb, char c, int x, int y);
+
+    private:
+        static const int _maxGlyphs = 16;
+        int indexOf(char c);
+
+        UiTheme &_theme;
+        const char *_charset;
+        int _nGlyphs = 0;
+        int _ch = 0;                    // cell height = font height
+        int _cw[_maxGlyphs];            // cell width = advance of the glyph
+        uint32_t _offset[_maxGlyphs];   // start of the cell in _cells
+        uint16_t *_cells;               // swapped RGB565 pixels of all cells
+        uint32_t _maxPixels;            // capacity of _cells
+        bool _ready = false;
+};
+
+
+// Value field that draws its value from a glyph atlas. On an update
+// only the cells whose character or position has changed are pushed, 
+// values with characters missing in the atlas fall back to UiButton.
+class UiGlyphButton : public UiButton
+{
+    public:
+        UiGlyphButton(UiPanel *parent, int x, int y, int w, int h, UiTheme &theme, UiGlyphAtlas &atlas, const char *value="", const char *label="") : 
+            UiButton(parent, x, y, w, h, theme, value, label), _atlas(atlas)
+        {}
+
+        void draw();
+        void redrawValue();
+        uint32_t usLastRedraw();
+        int cellsLastRedraw();
+
+    private:
+        static const int _maxCells = 12;
+        char _shown[_maxCells];     // characters currently on screen
+        int  _shownX[_maxCells];    // their x positions
+        int  _shownLen = -1;        // -1: empty body, -2: body drawn by UiButton
+        uint32_t _usLastRedraw = 0; // duration of the last value redraw
+        int  _cellsLastRedraw = 0;  // number of cells pushed by it
+        UiGlyphAtlas &_atlas;
+};
+
+
 // LED button on/off
 class UiLed : public UiButton
 {
     public:
-        UiLed(UiPanel *parent, int x, int y, int radius, int color, UiTheme &theme, String label="", bool isOn=false) : 
+        UiLed(UiPanel *parent, int x, int y, int radius, int color, UiTheme &theme, const char *label="", bool isOn=false) : 
             UiButton(parent, x, y, 2*radius, 2*radius, theme, "", label), _radius(radius), _color(color), _isOn(isOn)
         {}
 
-        UiLed(UiPanel *parent, int x, int y, int radius, int color, String label="", bool isOn=false) : 
+        UiLed(UiPanel *parent, int x, int y, int radius, int color, const char *label="", bool isOn=false) : 
             UiButton(parent, x, y, 2*radius, 2*radius, "", label), _radius(radius), _color(color), _isOn(isOn)
         {}
 
         void draw();
         void clearLabel();
         bool touched(int x, int y);
-        void setLabel(String txt);
+        void getBounds(int &x, int &y, int &w, int &h);
+        void setLabel(const char *txt);
         bool isOn();
         void on();
         void off();
@@ -177,29 +340,31 @@ class UiLed : public UiButton
 class UiHslider : public UiButton
 {
     public:
-        UiHslider(UiPanel *parent, int x, int y, int w, int h, int color, UiTheme &theme, String label="") : 
+        UiHslider(UiPanel *parent, int x, int y, int w, int h, int color, UiTheme &theme, const char *label="") : 
             UiButton(parent, x, y, w, h, theme, "", label), _color(color)
-            {_value = (_position-_x) * 100 / _w; }
+            { uiFormat(_value, sizeof(_value), (_position-_x) * 100 / _w, 0); }
 
-        UiHslider(UiPanel *parent, int x, int y, int w, int h, int color, String label="") : 
+        UiHslider(UiPanel *parent, int x, int y, int w, int h, int color, const char *label="") : 
             UiButton(parent, x, y, w, h, "", label), _color(color)
-            {_value = (_position-_x) * 100 / _w; }
+            { uiFormat(_value, sizeof(_value), (_position-_x) * 100 / _w, 0); }
 
-        UiHslider(UiPanel *parent, int x, int y, int w, int h, String label="") : 
+        UiHslider(UiPanel *parent, int x, int y, int w, int h, const char *label="") : 
             UiButton(parent, x, y, w, h, "", label)
-            {_value = (_position-_x) * 100 / _w; }
+            { uiFormat(_value, sizeof(_value), (_position-_x) * 100 / _w, 0); }
 
         void draw();
         void slideToPosition(int x);
         void slideToValue(int v);
-        void slideToValue(double v);
+        void slideToValue(UiFixed v);
         void addValueField(UiButton *btn);
         bool hasValueField();
         UiButton *getValueField();
         void setRange(int min, int max);
-        void setRange(double min, double max);
+        void setRange(UiFixed min, UiFixed max);
         
     private:
+        void moveKnob(int32_t v);
+
         int _color=TFT_LIGHTGREY;
         int _d = 10; // distance to label
         int _r = 4;  // radius of rounded rectangle
@@ -212,16 +377,23 @@ class UiHslider : public UiButton
 class UiKeypad : public UiPanel
 {
     public:
-        UiKeypad(LGFX &lcd, int x, int y, int bgColor, bool hidden) : 
-            UiPanel(lcd, x, y, _wp, _hp, bgColor, hidden)
+        UiKeypad(UiFrameBuffer &fb, int x, int y, int bgColor, bool hidden) : 
+            UiPanel(fb, x, y, _wp, _hp, bgColor, hidden)
         { if (! hidden) show(); }
 
         void show();
-        void handleKeys(int x, int y);
+        void bindKeys(UiDispatcher &d);
         void addValueField(UiButton *btn);
         void addOkCallback(Callback cb);
 
     private:
+        static void onDigit(UiButton *btn, int x, int y, void *arg);
+        static void onBackspace(UiButton *btn, int x, int y, void *arg);
+        static void onClear(UiButton *btn, int x, int y, void *arg);
+        static void onSign(UiButton *btn, int x, int y, void *arg);
+        static void onCancel(UiButton *btn, int x, int y, void *arg);
+        static void onOk(UiButton *btn, int x, int y, void *arg);
+
         int __x = _x + _gap; // origin x of the top left button (screen coords)
         int __y = _y + _gap; // origin y of the top left button (screen coords)
 
@@ -236,28 +408,95 @@ class UiKeypad : public UiPanel
         UiButton *_targetValueField;
         Callback _okCallback = nullptr;
 
-        UiButton *_btnEntry = new UiButton(this, __x, __y, (_wb + _gap)*_cols - _gap, _hb, "");
-        UiButton *_btn1     = new UiButton(this, __x,               __y+(_hb+_gap), _wb, _hb, "1");
-        UiButton *_btn2     = new UiButton(this, __x+1*(_wb + _gap), __y+(_hb+_gap), _wb, _hb, "2");
-        UiButton *_btn3     = new UiButton(this, __x+2*(_wb + _gap), __y+(_hb+_gap), _wb, _hb, "3");
-        UiButton *_btnC     = new UiButton(this, __x+3*(_wb + _gap), __y+(_hb+_gap), _wb, _hb, "C");
-
-        UiButton *_btn4   = new UiButton(this, __x,               __y+2*(_hb+_gap), _wb, _hb, "4");
-        UiButton *_btn5   = new UiButton(this, __x+1*(_wb + _gap), __y+2*(_hb+_gap), _wb, _hb, "5");
-        UiButton *_btn6   = new UiButton(this, __x+2*(_wb + _gap), __y+2*(_hb+_gap), _wb, _hb, "6"); 
-        UiButton *_btnClr = new UiButton(this, __x+3*(_wb + _gap), __y+2*(_hb+_gap), _wb, _hb, "Clr");
-
-        UiButton *_btn7      = new UiButton(this, __x,               __y+3*(_hb+_gap), _wb, _hb, "7");
-        UiButton *_btn8      = new UiButton(this, __x+1*(_wb + _gap), __y+3*(_hb+_gap), _wb, _hb, "8");
-        UiButton *_btn9      = new UiButton(this, __x+2*(_wb + _gap), __y+3*(_hb+_gap), _wb, _hb, "9");
-        UiButton *_btnCancel = new UiButton(this, __x+3*(_wb + _gap), __y+3*(_hb+_gap), _wb, _hb, "X");
-
-        UiButton *_btnSign = new UiButton(this, __x,               __y+4*(_hb+_gap), _wb, _hb, "+/-");
-        UiButton *_btn0    = new UiButton(this, __x+1*(_wb + _gap), __y+4*(_hb+_gap), _wb, _hb, "0");
-        UiButton *_btnDot  = new UiButton(this, __x+2*(_wb + _gap), __y+4*(_hb+_gap), _wb, _hb, ".");
-        UiButton *_btnOk   = new UiButton(this, __x+3*(_wb + _gap), __y+4*(_hb+_gap), _wb, _hb, "OK");
-
-        std::vector<UiButton *> _btns = {_btnEntry, _btn1, _btn2, _btn3, _btn4, _btn5, _btn6, 
-                                         _btn7, _btn8, _btn9, _btn0, _btnDot, _btnC, _btnClr, 
-                                         _btnCancel, _btnSign, _btnOk};
+        // Rectangle of the key in row r and column c spanning n columns
+        constexpr UiRect key(int r, int c, int n=1) const
+        { 
+            return { int16_t(__x + c*(_wb+_gap)), int16_t(__y + r*(_hb+_gap)), int16_t(n*(_wb+_gap) - _gap), int16_t(_hb) }; 
+        }
+
+        UiButton _btnEntry  {this, key(0, 0, _cols), ""};
+        UiButton _btn1      {this, key(1, 0), "1"};
+        UiButton _btn2      {this, key(1, 1), "2"};
+        UiButton _btn3      {this, key(1, 2), "3"};
+        UiButton _btnC      {this, key(1, 3), "C"};
+
+        UiButton _btn4      {this, key(2, 0), "4"};
+        UiButton _btn5      {this, key(2, 1), "5"};
+        UiButton _btn6      {this, key(2, 2), "6"};
+        UiButton _btnClr    {this, key(2, 3), "Clr"};
+
+        UiButton _btn7      {this, key(3, 0), "7"};
+        UiButton _btn8      {this, key(3, 1), "8"};
+        UiButton _btn9      {this, key(3, 2), "9"};
+        UiButton _btnCancel {this, key(3, 3), "X"};
+
+        UiButton _btnSign   {this, key(4, 0), "+/-"};
+        UiButton _btn0      {this, key(4, 1), "0"};
+        UiButton _btnDot    {this, key(4, 2), "."};
+        UiButton _btnOk     {this, key(4, 3), "OK"};
+
+        std::array<UiButton *, 17> _btns = {&_btnEntry, &_btn1, &_btn2, &_btn3, &_btn4, &_btn5, &_btn6, 
+                                            &_btn7, &_btn8, &_btn9, &_btn0, &_btnDot, &_btnC, &_btnClr, 
+                                            &_btnCancel, &_btnSign, &_btnOk};
+};
+
+
+// When a handler registered with UiDispatcher::on() is called
+enum class UiFire : uint8_t 
+{ 
+    OnRelease,  // pen lifted inside the widget (normal button)
+    OnPress,    // pen down on the widget
+    Repeat,     // pen down, then auto-repeat while held
+    Drag        // pen down and every move until the pen is lifted
+};
+
+// Routes pen down/move/up events to the handlers of the widgets. 
+// Each widget has its own press/release/repeat state, presses within 
+// the debounce time after a release are ignored and auto-repeat is 
+// driven by update(). Widgets are found through a coarse grid of 
+// bitmasks instead of scanning all of them, the widget registered 
+// last wins (e.g. the keys of a keypad over a panel). Widgets of 
+// hidden panels are ignored, while a modal panel is shown only its
+// own widgets are hit.
+class UiDispatcher
+{
+    public:
+        bool on(UiButton *btn, UiHandler handler, void *arg=nullptr, UiFire fire=UiFire::OnRelease);
+        void penDown(int x, int y, uint32_t ms);
+        void penMove(int x, int y, uint32_t ms);
+        void penUp(int x, int y, uint32_t ms);
+        void update(uint32_t ms);
+        bool lastDownHitWidget();
+        UiButton *pressed();
+        void cancel();
+        void setModal(UiPanel *modal);
+        void setTiming(uint16_t msDebounce, uint16_t msRepeatDelay, uint16_t msRepeatRate);
+
+    private:
+        enum class State : uint8_t { Idle, Pressed, Repeating, Cancelled };
+        struct Slot
+        {
+            UiButton *btn;
+            UiHandler handler;
+            void     *arg;
+            UiFire    fire;
+            State     state;
+            uint32_t  msNext;      // time of the next auto-repeat
+            uint32_t  msReleased;  // time of the last release
+        };
+        int  hitTest(int x, int y);
+        void fire(Slot &s, int x, int y);
+
+        static const int _maxSlots = 32;  // one bit per slot in a grid cell
+        static const int _cell = 32;      // grid cell size in pixels
+        static const int _gridSize = (std::max(TFT_WIDTH, TFT_HEIGHT) + _cell - 1) / _cell;
+        Slot     _slots[_maxSlots];
+        int      _nSlots = 0;
+        uint32_t _grid[_gridSize * _gridSize] = {};
+        int      _active = -1;  // slot pressed at pen down
+        UiPanel *_modal = nullptr;
+        bool     _lastDownHit = false;
+        uint16_t _msDebounce = 50;
+        uint16_t _msRepeatDelay = 600;
+        uint16_t _msRepeatRate = 250;
 };
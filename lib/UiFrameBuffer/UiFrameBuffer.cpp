@@ -0,0 +1,360 @@
+/**
+ * Class        Implementation of the class methods of UiFrameBuffer
+ *
+ * Purpose      Indexed back buffer with palette expansion in line bands
+ *              while the previous band is pushed with DMA.
+ *
+ * Remarks      All methods run on the render task. The width must be
+ *              even and the band buffers 32 bit aligned, the expansion
+ *              writes two pixels per store.
+ */
+#include "UiFrameBuffer.h"
+
+
+/**
+ * Attach the sprite to the pixel buffer and clear it. Nothing is 
+ * dirty, the buffer reaches the display only where it is drawn.
+ */
+void UiFrameBuffer::begin()
+{
+    _canvas.setBuffer(_pixels, _w, _h, lgfx::palette_4bit);
+    _canvas.createPalette();
+    _nColors = 0;
+    color(TFT_BLACK);               // index 0 is the clear color
+    memset(_pixels, 0, _w * _h / 2);
+    clearClipRect();
+    for (int b = 0; b < _maxBands; b++) { _dirtyX0[b] = _w; _dirtyX1[b] = -1; }
+    log_i("==> done");
+}
+
+int UiFrameBuffer::width()
+{
+    return _w;
+}
+
+int UiFrameBuffer::height()
+{
+    return _h;
+}
+
+
+/**
+ * Palette index of an RGB565 color. A new color is added to the palette,
+ * when it is full the nearest color is taken.
+ */
+uint8_t UiFrameBuffer::color(uint32_t rgb565)
+{
+    int best = 0;
+    uint32_t bestDist = UINT32_MAX;
+    for (int i = 0; i < _nColors; i++)
+    {
+        if (_palette[i] == rgb565) return i;
+        int dr = (int)(_palette[i] >> 11)        - (int)(rgb565 >> 11);
+        int dg = (int)((_palette[i] >> 5) & 0x3F) - (int)((rgb565 >> 5) & 0x3F);
+        int db = (int)(_palette[i] & 0x1F)       - (int)(rgb565 & 0x1F);
+        uint32_t dist = 4*dr*dr + dg*dg + 4*db*db;
+        if (dist < bestDist) { bestDist = dist; best = i; }
+    }
+    if (_nColors == FB_COLORS) return best;
+    setPaletteColor(_nColors, rgb565);
+    return _nColors++;
+}
+
+void UiFrameBuffer::setPaletteColor(int i, uint16_t rgb565)
+{
+    _palette[i] = rgb565;
+    _canvas.setPaletteColor(i, (rgb565 >> 8) & 0xF8, (rgb565 >> 3) & 0xFC, (rgb565 << 3) & 0xF8);
+
+    // table of all pairs of indexes, the left pixel (high nibble) in the lower half
+    for (int b = 0; b < 256; b++)
+    {
+        uint16_t left  = _palette[b >> 4];
+        uint16_t right = _palette[b & 15];
+        _pairs[b] = (uint16_t)(left << 8 | left >> 8) | (uint32_t)(uint16_t)(right << 8 | right >> 8) << 16;
+    }
+}
+
+/**
+ * Palette index of a pixel of an image. The cells have two colors
+ * mostly, so the last index of a color is remembered in a small hash.
+ */
+uint8_t UiFrameBuffer::index(uint16_t swapped565)
+{
+    uint16_t rgb565 = swapped565 << 8 | swapped565 >> 8;
+    uint8_t &i = _hash[(rgb565 ^ rgb565 >> 8) & 0xFF];
+    if (i < _nColors && _palette[i] == rgb565) return i;
+    i = color(rgb565);
+    return i;
+}
+
+int UiFrameBuffer::colors()
+{
+    return _nColors;
+}
+
+// The clear color, e.g. for hidden panels
+uint32_t UiFrameBuffer::getBaseColor()
+{
+    return _palette[0];
+}
+
+
+void UiFrameBuffer::fillScreen(uint32_t rgb565)
+{
+    _canvas.fillScreen(color(rgb565));
+    markAllDirty();
+}
+
+void UiFrameBuffer::fillRect(int x, int y, int w, int h, uint32_t rgb565)
+{
+    _canvas.fillRect(x, y, w, h, color(rgb565));
+    markDirty(x, y, w, h);
+}
+
+void UiFrameBuffer::fillRoundRect(int x, int y, int w, int h, int r, uint32_t rgb565)
+{
+    _canvas.fillRoundRect(x, y, w, h, r, color(rgb565));
+    markDirty(x, y, w, h);
+}
+
+void UiFrameBuffer::drawRoundRect(int x, int y, int w, int h, int r, uint32_t rgb565)
+{
+    _canvas.drawRoundRect(x, y, w, h, r, color(rgb565));
+    markDirty(x, y, w, h);
+}
+
+void UiFrameBuffer::fillCircle(int x, int y, int r, uint32_t rgb565)
+{
+    _canvas.fillCircle(x, y, r, color(rgb565));
+    markDirty(x - r, y - r, 2*r + 1, 2*r + 1);
+}
+
+void UiFrameBuffer::drawCircle(int x, int y, int r, uint32_t rgb565)
+{
+    _canvas.drawCircle(x, y, r, color(rgb565));
+    markDirty(x - r, y - r, 2*r + 1, 2*r + 1);
+}
+
+
+void UiFrameBuffer::setFont(const GFXfont *font)
+{
+    _canvas.setFont(font);
+}
+
+void UiFrameBuffer::setTextDatum(textdatum_t datum)
+{
+    _canvas.setTextDatum(datum);
+}
+
+// Transparent background
+void UiFrameBuffer::setTextColor(uint32_t rgb565)
+{
+    _canvas.setTextColor(color(rgb565));
+}
+
+void UiFrameBuffer::setTextColor(uint32_t rgb565, uint32_t bgRgb565)
+{
+    _canvas.setTextColor(color(rgb565), color(bgRgb565));
+}
+
+/**
+ * Draw a text with the current font, datum and colors. The area
+ * marked dirty is the text extent around x, y, which covers every 
+ * datum. Returns the width.
+ */
+int UiFrameBuffer::drawString(const char *text, int x, int y)
+{
+    int w = _canvas.drawString(text, x, y);
+    int h = _canvas.fontHeight();
+    markDirty(x - w, y - h, 2*w, 2*h);
+    return w;
+}
+
+void UiFrameBuffer::drawString(const char *text, int x, int y, uint32_t rgb565, uint32_t bgRgb565,
+                               const GFXfont *font, textdatum_t datum)
+{
+    setFont(font);
+    setTextDatum(datum);
+    setTextColor(rgb565, bgRgb565);
+    drawString(text, x, y);
+}
+
+int UiFrameBuffer::textWidth(const char *text)
+{
+    return _canvas.textWidth(text);
+}
+
+int UiFrameBuffer::fontHeight()
+{
+    return _canvas.fontHeight();
+}
+
+
+/**
+ * Write an image of byte-swapped RGB565 pixels into the buffer,
+ * clipped to the clip rectangle
+ */
+void UiFrameBuffer::pushImage(int x, int y, int w, int h, const uint16_t *swapped565)
+{
+    int x0 = max(x, (int)_clipX0), x1 = min(x + w, (int)_clipX1);
+    int y0 = max(y, (int)_clipY0), y1 = min(y + h, (int)_clipY1);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    for (int r = y0; r < y1; r++)
+    {
+        const uint16_t *src = swapped565 + (r - y) * w + (x0 - x);
+        uint8_t *row = _pixels + r * (_w / 2);
+        for (int c = x0; c < x1; c++)
+        {
+            uint8_t i = index(*src++);
+            uint8_t &b = row[c >> 1];
+            b = c & 1 ? (b & 0xF0) | i : (b & 0x0F) | i << 4;
+        }
+    }
+    markDirty(x0, y0, x1 - x0, y1 - y0);
+}
+
+void UiFrameBuffer::setClipRect(int x, int y, int w, int h)
+{
+    _clipX0 = max(x, 0);
+    _clipY0 = max(y, 0);
+    _clipX1 = min(x + w, _w);
+    _clipY1 = min(y + h, _h);
+    _canvas.setClipRect(x, y, w, h);
+}
+
+void UiFrameBuffer::clearClipRect()
+{
+    _clipX0 = _clipY0 = 0;
+    _clipX1 = _w;
+    _clipY1 = _h;
+    _canvas.clearClipRect();
+}
+
+
+/**
+ * Copy a rectangle out of the buffer as RGB565, byte-swapped if
+ * requested. The rectangle must lie within the screen.
+ */
+void UiFrameBuffer::readRect(int x, int y, int w, int h, uint16_t *rgb565, bool swapped)
+{
+    for (int r = 0; r < h; r++)
+    {
+        const uint8_t *src = _pixels + (y + r) * (_w / 2);
+        for (int c = x; c < x + w; c++)
+        {
+            uint8_t b = src[c >> 1];
+            uint16_t p = _palette[c & 1 ? b & 0x0F : b >> 4];
+            *rgb565++ = swapped ? (uint16_t)(p << 8 | p >> 8) : p;
+        }
+    }
+}
+
+// A whole line, e.g. for a screenshot
+void UiFrameBuffer::readLine(int y, uint16_t *rgb565)
+{
+    readRect(0, y, _w, 1, rgb565);
+}
+
+
+void UiFrameBuffer::markDirty(int x, int y, int w, int h)
+{
+    int x0 = max(x, 0), x1 = min(x + w, _w) - 1;
+    int y0 = max(y, 0), y1 = min(y + h, _h) - 1;
+    if (x0 > x1 || y0 > y1) return;
+    for (int b = y0 / FB_BAND_LINES; b <= y1 / FB_BAND_LINES; b++)
+    {
+        if (x0 < _dirtyX0[b]) _dirtyX0[b] = x0;
+        if (x1 > _dirtyX1[b]) _dirtyX1[b] = x1;
+    }
+}
+
+void UiFrameBuffer::markAllDirty()
+{
+    for (int b = 0; b < _maxBands; b++) { _dirtyX0[b] = 0; _dirtyX1[b] = _w - 1; }
+}
+
+
+/**
+ * Push the dirty parts to the display. Called from
+ * a frame hook of the renderer, after all drawing.
+ */
+void UiFrameBuffer::push(LGFX &lcd)
+{
+    uint32_t t0 = micros();
+    int nBands = (_h + FB_BAND_LINES - 1) / FB_BAND_LINES;
+    uint32_t pixels = 0;
+
+    for (int b = 0; b < nBands; b++)
+    {
+        int x0 = _dirtyX0[b], x1 = _dirtyX1[b];
+        if (x0 > x1) continue;
+        _dirtyX0[b] = _w;
+        _dirtyX1[b] = -1;
+
+        // whole bytes of the buffer
+        x0 &= ~1;
+        x1 |= 1;
+        int y0 = b * FB_BAND_LINES;
+        int lines = min(FB_BAND_LINES, _h - y0);
+
+        // The buffer was pushed two bands ago. The bus starts a transfer only after
+        // the previous one, so it is free once the other buffer has been started.
+        // Only the first band must wait, for the transfers of the previous frame.
+        if (pixels == 0) lcd.waitDMA();
+        uint16_t *band = _bands + _nextBand * _w * FB_BAND_LINES;
+        _nextBand ^= 1;
+        expand(band, x0, x1, y0, lines);
+        lcd.pushImageDMA(x0, y0, x1 - x0 + 1, lines, reinterpret_cast<const lgfx::swap565_t *>(band));
+        pixels += (x1 - x0 + 1) * lines;
+    }
+    if (pixels == 0) return;
+
+    _usPushLast = micros() - t0;
+    if (_usPushLast > _usPushMax) _usPushMax = _usPushLast;
+    _pushes++;
+    _pixelsPushed += pixels;
+}
+
+
+/**
+ * Expand columns x0..x1 (x0 even, x1 odd) of lines
+ * y0.. to byte-swapped RGB565, two pixels at a time
+ */
+void UiFrameBuffer::expand(uint16_t *dst, int x0, int x1, int y0, int lines)
+{
+    int pairs = (x1 - x0 + 1) / 2;
+    for (int r = 0; r < lines; r++)
+    {
+        const uint8_t *src = _pixels + (y0 + r) * (_w / 2) + x0 / 2;
+        uint32_t *d = reinterpret_cast<uint32_t *>(dst) + r * pairs;
+        for (int i = 0; i < pairs; i++) d[i] = _pairs[src[i]];
+    }
+}
+
+
+uint32_t UiFrameBuffer::usPushLast()
+{
+    return _usPushLast;
+}
+
+uint32_t UiFrameBuffer::usPushMax()
+{
+    return _usPushMax;
+}
+
+void UiFrameBuffer::printStats()
+{
+    uint32_t dt = millis() - _msStats;
+    log_i("Frame buffer: %u pushes (%u/s), %u pixels/push, push last %u us, max %u us, %d colors",
+          _pushes, dt ? _pushes * 1000 / dt : 0, _pushes ? _pixelsPushed / _pushes : 0,
+          _usPushLast, _usPushMax, _nColors);
+}
+
+void UiFrameBuffer::resetStats()
+{
+    _usPushMax = 0;
+    _pushes = 0;
+    _pixelsPushed = 0;
+    _msStats = millis();
+}
@@ -0,0 +1,114 @@
+/**
+ * Header       UiFrameBuffer.h
+ *
+ * Purpose      Declaration of the class UiFrameBuffer, a back buffer of the
+ *              whole screen with 4 bits per pixel. The 320x240 screen needs
+ *              150 KB in RGB565, 38 KB indexed. The themes use only a
+ *              handful of colors, so 16 palette entries are enough.
+ *              - All panels draw into the buffer instead of the display.
+ *                The drawing methods have the names of LovyanGFX and take
+ *                RGB565 colors, which color() maps to palette indexes.
+ *                They draw on an LGFX_Sprite on the caller's buffer and
+ *                mark the area dirty.
+ *              - pushImage() takes the byte-swapped RGB565 cells of the
+ *                glyph caches and maps them pixel by pixel.
+ *              - push() sends the dirty columns of each band of
+ *                FB_BAND_LINES lines to the display. A band is expanded
+ *                with a 256 entry table, two pixels per byte and one 32 bit
+ *                store, into one of two band buffers, while the other
+ *                one is transferred with DMA.
+ *              - Everything composed within one frame appears at once.
+ *              - readRect() and readLine() give the screenshots, the
+ *                mirror and the backing stores the pixels from RAM, the
+ *                display is never read back over SPI.
+ *              Only the commands of the renderer itself (e.g. the printf of
+ *              the WLAN provisioning) still go to the display. They come
+ *              before the panels, which cover them.
+ *
+ * Usage        uint8_t  fbPixels[320*240/2];
+ *              uint16_t fbBands[2*320*FB_BAND_LINES];
+ *              UiFrameBuffer fb(320, 240, fbPixels, fbBands);
+ *              fb.begin();
+ *              UiPanel panel(fb, 0, 0, 320, 35, TFT_GOLD, false);    // on the render task
+ *              renderer.addFrameHook([](LGFX &lcd, int x, int y, void *arg) { fb.push(lcd); });
+ */
+#pragma once
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include "lgfx_esp32-2432S028.h"
+
+const int FB_BAND_LINES = 8;     // lines expanded and pushed at once
+const int FB_COLORS     = 16;    // palette entries
+
+class UiFrameBuffer
+{
+    public:
+        UiFrameBuffer(int w, int h, uint8_t *pixels, uint16_t *bands) :
+            _w(w), _h(h), _pixels(pixels), _bands(bands)
+        {}
+
+        void begin();
+        int  width();
+        int  height();
+        uint8_t  color(uint32_t rgb565);
+        int      colors();
+        uint32_t getBaseColor();
+
+        void fillScreen(uint32_t rgb565);
+        void fillRect(int x, int y, int w, int h, uint32_t rgb565);
+        void fillRoundRect(int x, int y, int w, int h, int r, uint32_t rgb565);
+        void drawRoundRect(int x, int y, int w, int h, int r, uint32_t rgb565);
+        void fillCircle(int x, int y, int r, uint32_t rgb565);
+        void drawCircle(int x, int y, int r, uint32_t rgb565);
+        void setFont(const GFXfont *font);
+        void setTextDatum(textdatum_t datum);
+        void setTextColor(uint32_t rgb565);
+        void setTextColor(uint32_t rgb565, uint32_t bgRgb565);
+        int  drawString(const char *text, int x, int y);
+        void drawString(const char *text, int x, int y, uint32_t rgb565, uint32_t bgRgb565,
+                        const GFXfont *font, textdatum_t datum=textdatum_t::middle_left);
+        int  textWidth(const char *text);
+        int  fontHeight();
+        void pushImage(int x, int y, int w, int h, const uint16_t *swapped565);
+        void setClipRect(int x, int y, int w, int h);
+        void clearClipRect();
+
+        void readRect(int x, int y, int w, int h, uint16_t *rgb565, bool swapped=false);
+        void readLine(int y, uint16_t *rgb565);
+
+        void markDirty(int x, int y, int w, int h);
+        void markAllDirty();
+        void push(LGFX &lcd);
+
+        uint32_t usPushLast();
+        uint32_t usPushMax();
+        void     printStats();
+        void     resetStats();
+
+    private:
+        void setPaletteColor(int i, uint16_t rgb565);
+        uint8_t index(uint16_t swapped565);
+        void expand(uint16_t *dst, int x0, int x1, int y0, int lines);
+
+        int _w, _h;
+        uint8_t  *_pixels;          // 2 pixels per byte, left pixel in the high nibble
+        uint16_t *_bands;           // 2 band buffers of _w * FB_BAND_LINES pixels
+        LGFX_Sprite _canvas;
+        int16_t _clipX0 = 0, _clipY0 = 0, _clipX1 = 0, _clipY1 = 0;  // x1, y1 exclusive
+
+        uint16_t _palette[FB_COLORS] = {};  // RGB565
+        int      _nColors = 0;
+        uint32_t _pairs[256];           // byte of 2 indexes -> 2 swapped RGB565 pixels
+        uint8_t  _hash[256] = {};       // last index found for a hash of the color
+
+        static const int _maxBands = 320 / FB_BAND_LINES;
+        int16_t _dirtyX0[_maxBands];    // dirty columns of each band, x0 > x1 = clean
+        int16_t _dirtyX1[_maxBands];
+        int     _nextBand = 0;          // band buffer filled next
+
+        uint32_t _usPushLast = 0;
+        uint32_t _usPushMax = 0;
+        uint32_t _pushes = 0;
+        uint32_t _pixelsPushed = 0;
+        uint32_t _msStats = 0;
+};
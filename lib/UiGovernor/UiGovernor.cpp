@@ -0,0 +1,108 @@
+/**
+ * Class        Implementation of the class methods of UiGovernor
+ *
+ * Purpose      Audio first: the UI gives up frames and deferrable
+ *              redraws as soon as the audio path is in danger.
+ *
+ * Remarks      audioTick() and update() run on the loop task, allows()
+ *              is also called from the render task, therefore the
+ *              load is atomic.
+ */
+#include "UiGovernor.h"
+
+const char *UiGovernor::_names[3] = { "Full", "Reduced", "Minimal" };
+const uint32_t UiGovernor::_msFrame[3] = { 20, 50, 100 };
+const uint8_t UiGovernor::_allowed[3] =
+{
+    1 << (int)UiWork::Clock | 1 << (int)UiWork::Marquee | 1 << (int)UiWork::Meter | 1 << (int)UiWork::Mirror,
+    1 << (int)UiWork::Clock,
+    0
+};
+
+
+/**
+ * Called with the bytes waiting in the receive buffer before a copy
+ * and the bytes copied. Copies without data count as one underrun.
+ */
+void UiGovernor::audioTick(int buffered, size_t copied)
+{
+    if (buffered < _minBuffered) _minBuffered = buffered;
+    if (copied > 0) _starved = false;
+    else if (!_starved)
+    {
+        _starved = true;
+        _underruns++;
+    }
+}
+
+
+/**
+ * Decide on the load once per period. Step down one level per period
+ * while the audio is in danger, step up one level after it was
+ * healthy (buffer above high water, no underrun) for GOVERNOR_HOLD_MS.
+ */
+void UiGovernor::update(uint32_t ms)
+{
+    if (ms - _msEval < GOVERNOR_PERIOD_MS) return;
+    _msEval = ms;
+
+    int minBuffered = _minBuffered;
+    uint32_t underruns = _underruns;
+    bool starved = _starved;
+    _minBuffered = INT_MAX;
+    _underruns = 0;
+    _underrunsTotal += underruns;
+
+    int level = (int)_load.load();
+    char reason[64];
+    if (underruns > 0 || starved || minBuffered < _lowWater)
+    {
+        _msHealthySince = ms;
+        if (level == (int)UiLoad::Minimal) return;
+        snprintf(reason, sizeof(reason), "buffer %d bytes, %u underruns", minBuffered, underruns);
+        apply((UiLoad)(level + 1), reason);
+    }
+    else if (minBuffered <= _highWater)
+    {
+        _msHealthySince = ms;
+    }
+    else if (level > (int)UiLoad::Full && ms - _msHealthySince >= GOVERNOR_HOLD_MS)
+    {
+        _msHealthySince = ms;
+        snprintf(reason, sizeof(reason), "buffer %d bytes, healthy for %u ms", minBuffered, GOVERNOR_HOLD_MS);
+        apply((UiLoad)(level - 1), reason);
+    }
+}
+
+
+void UiGovernor::apply(UiLoad load, const char *reason)
+{
+    log_i("Governor: %s -> %s (%s)", _names[(int)_load.load()], _names[(int)load], reason);
+    _load = load;
+    _renderer.setFrameInterval(_msFrame[(int)load]);
+    _changes++;
+}
+
+
+// True if the work may be done at the current load
+bool UiGovernor::allows(UiWork work)
+{
+    return _allowed[(int)_load.load()] & (1 << (int)work);
+}
+
+UiLoad UiGovernor::load()
+{
+    return _load;
+}
+
+// Underruns since start, counted once per period
+uint32_t UiGovernor::underruns()
+{
+    return _underrunsTotal;
+}
+
+void UiGovernor::printStats()
+{
+    log_i("Governor: load %s, %u changes, %u underruns",
+          _names[(int)_load.load()], _changes, _underrunsTotal);
+}
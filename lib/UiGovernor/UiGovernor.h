@@ -0,0 +1,72 @@
+/**
+ * Header       UiGovernor.h
+ *
+ * Purpose      Declaration of the class UiGovernor, which adapts the load
+ *              of the user interface to the health of the audio path.
+ *              loop() reports the fill of the stream receive buffer
+ *              and the bytes of every copy, a copy that finds no data
+ *              starts an underrun: the decoder and I2S run dry. The
+ *              time between two copies says nothing, the copy blocks in
+ *              the I2S write while the decoded audio plays. Once per
+ *              period the governor decides on the UI load:
+ *              - Full     all redraws, 50 frames/s
+ *              - Reduced  marquee, meters and web mirror deferred, 20 frames/s
+ *              - Minimal  also the clock deferred, 10 frames/s
+ *              It steps down at once when the buffer runs low or an
+ *              underrun occurs and steps up again only after the
+ *              audio was healthy for GOVERNOR_HOLD_MS.
+ *              Every decision is logged for tuning.
+ *
+ * Usage        UiGovernor governor(renderer, 512, 2048);
+ *              loop() { int buffered = url.available();
+ *                       governor.audioTick(buffered, copier.copy());
+ *                       governor.update(millis()); }
+ *              if (governor.allows(UiWork::Clock)) ...
+ */
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "Renderer.h"
+
+const uint32_t GOVERNOR_PERIOD_MS = 250;   // evaluation period
+const uint32_t GOVERNOR_HOLD_MS   = 3000;  // healthy time before stepping up
+
+enum class UiLoad : uint8_t { Full, Reduced, Minimal };
+enum class UiWork : uint8_t { Clock, Marquee, Meter, Mirror };
+
+class UiGovernor
+{
+    public:
+        UiGovernor(Renderer &renderer, int lowWater, int highWater) :
+            _renderer(renderer), _lowWater(lowWater), _highWater(highWater)
+        {}
+
+        void audioTick(int buffered, size_t copied);
+        void update(uint32_t ms);
+        bool allows(UiWork work);
+        UiLoad load();
+        uint32_t underruns();
+        void printStats();
+
+    private:
+        void apply(UiLoad load, const char *reason);
+
+        static const char *_names[3];
+        static const uint32_t _msFrame[3];
+        static const uint8_t _allowed[3];   // bit mask of UiWork
+
+        Renderer &_renderer;
+        int      _lowWater;
+        int      _highWater;
+        std::atomic<UiLoad> _load{UiLoad::Full};
+
+        // measured by audioTick() during the current period
+        int      _minBuffered = INT_MAX;
+        uint32_t _underruns = 0;
+        bool     _starved = false;          // the last copy found no data
+
+        uint32_t _msEval = 0;
+        uint32_t _msHealthySince = 0;
+        uint32_t _underrunsTotal = 0;
+        uint32_t _changes = 0;
+};
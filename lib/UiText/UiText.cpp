@@ -0,0 +1,444 @@
+/**
+ * Class        Implementation of the text pipeline
+ *
+ * Purpose      Detection and transcoding of the text encoding,
+ *              decoding of UiRleFont glyphs and the glyph cache.
+ *
+ * Remarks      The cells are stored as byte-swapped RGB565 like the
+ *              cells of UiGlyphAtlas, so they can be pushed as is.
+ */
+#include "UiText.h"
+
+// Length of the UTF-8 sequence starting with c, 0 if c is not a lead byte
+static int utf8SeqLen(uint8_t c)
+{
+    if (c < 0x80) return 1;
+    if (c >= 0xC2 && c <= 0xDF) return 2;
+    if ((c & 0xF0) == 0xE0) return 3;
+    if (c >= 0xF0 && c <= 0xF4) return 4;
+    return 0;
+}
+
+/**
+ * A text that contains bytes above 0x7F is UTF-8 if all of them
+ * form valid sequences, otherwise it is taken as ISO-8859-1.
+ * Latin-1 text practically never forms valid UTF-8 sequences.
+ */
+UiTextEncoding uiDetectEncoding(const char *str)
+{
+    const uint8_t *p = (const uint8_t *)str;
+    bool ascii = true;
+
+    while (*p)
+    {
+        int n = utf8SeqLen(*p);
+        if (n == 0) return UiTextEncoding::Latin1;
+        for (int i = 1; i < n; i++)
+        {
+            if ((p[i] & 0xC0) != 0x80) return UiTextEncoding::Latin1;
+        }
+        if (n > 1) ascii = false;
+        p += n;
+    }
+    return ascii ? UiTextEncoding::Ascii : UiTextEncoding::Utf8;
+}
+
+// Latin-1 replacement of a code point beyond 0xFF, nullptr if there is none
+static const char *latin1Substitute(uint32_t cp)
+{
+    switch (cp)
+    {
+        case 0x2018: case 0x2019: case 0x201A: case 0x2032: return "'";
+        case 0x201C: case 0x201D: case 0x201E: case 0x2033: return "\"";
+        case 0x2010: case 0x2011: case 0x2012: case 0x2013: case 0x2014: case 0x2212: return "-";
+        case 0x2026: return "...";
+        case 0x20AC: return "EUR";
+        case 0x0152: return "OE";
+        case 0x0153: return "oe";
+        default:     return nullptr;
+    }
+}
+
+// Stations that claim ISO-8859-1 often send Windows-1252 punctuation in 0x80..0x9F
+static const uint16_t cp1252[32] = 
+{
+    0x20AC, 0, 0x201A, 0, 0x201E, 0x2026, 0, 0, 0, 0, 0, 0, 0x0152, 0, 0, 0,
+    0, 0x2018, 0x2019, 0x201C, 0x201D, 0, 0x2013, 0x2014, 0, 0, 0, 0, 0x0153, 0, 0, 0
+};
+
+/**
+ * Convert a text to Latin-1. UTF-8 is detected and transcoded,
+ * characters outside of Latin-1 are substituted or replaced by '?'.
+ * Returns the length of the converted text.
+ */
+int uiToLatin1(const char *in, char *out, int size)
+{
+    bool utf8 = uiDetectEncoding(in) == UiTextEncoding::Utf8;
+    const uint8_t *p = (const uint8_t *)in;
+    int len = 0;
+
+    while (*p && len < size-1)
+    {
+        uint32_t cp = *p++;
+        if (utf8 && cp >= 0x80)
+        {
+            int n = utf8SeqLen(cp);
+            cp &= 0x7F >> n;
+            for (int i = 1; i < n; i++) cp = (cp << 6) | (*p++ & 0x3F);
+        }
+        else if (cp >= 0x80 && cp < 0xA0) 
+        {
+            cp = cp1252[cp - 0x80];
+        }
+
+        if ((cp >= 0xA0 && cp < 0x100) || (cp >= 0x20 && cp < 0x7F)) { out[len++] = (char)cp; continue; }
+        const char *sub = latin1Substitute(cp);
+        if (sub == nullptr) sub = (cp > 0 && cp < 0x20) ? " " : "?";  // control characters become blanks
+        while (*sub && len < size-1) out[len++] = *sub++;
+    }
+    out[len] = '\0';
+    return len;
+}
+
+
+/**
+ * Size the cells and the slots from the font metrics
+ * on first use. The whole pool is divided into slots.
+ */
+bool UiFontCache::begin()
+{
+    if (_ready) return true;
+    _cellW  = _font.maxAdvance;
+    _cellH  = _font.ascent + _font.descent;
+    _nSlots = min((uint32_t)_maxSlots, _poolPixels / (_cellW * _cellH));
+    if (_nSlots == 0)
+    {
+        log_e("Pool of %u pixels too small for a cell of %dx%d", _poolPixels, _cellW, _cellH);
+        return false;
+    }
+    clear();
+    _ready = true;
+    log_i("%d slots of %dx%d pixels", _nSlots, _cellW, _cellH);
+    return true;
+}
+
+// Forget all cached cells
+void UiFontCache::clear()
+{
+    memset(_slotGlyph, 0xFF, sizeof(_slotGlyph));
+    memset(_slotUsed, 0, sizeof(_slotUsed));
+    memset(_glyphSlot, 0xFF, sizeof(_glyphSlot));
+}
+
+// Glyph of a character, '?' for characters missing in the subset, -1 if neither exists
+int UiFontCache::glyphIndex(uint8_t c)
+{
+    for (uint8_t ch : { c, (uint8_t)'?' })
+    {
+        if (ch < _font.first || ch > _font.last) continue;
+        uint8_t g = _font.index[ch - _font.first];
+        if (g != 0xFF) return g;
+    }
+    return -1;
+}
+
+/**
+ * Call plot(x, y) for every set pixel of a glyph, x and y relative
+ * to the top left corner of its bitmap.
+ * RLE: alternating runs starting with background, one nibble per run,
+ * a nibble of 15 continues the run with the same color.
+ */
+template<typename Plot> void UiFontCache::decode(const UiRleGlyph &glyph, Plot plot)
+{
+    const uint8_t *src = _font.data + glyph.offset;
+    int total = glyph.w * glyph.h;
+
+    if (glyph.flags & UiRleGlyph::Rle)
+    {
+        bool fg = false;
+        for (int i = 0, n = 0; n < total; i++)
+        {
+            int run = (src[i/2] >> ((i & 1) ? 0 : 4)) & 0x0F;
+            if (fg) for (int k = n; k < n+run; k++) plot(k % glyph.w, k / glyph.w);
+            n += run;
+            if (run != 15) fg = !fg;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < total; i++)
+        {
+            if (src[i/8] & (0x80 >> (i & 7))) plot(i % glyph.w, i / glyph.w);
+        }
+    }
+}
+
+/**
+ * Cell of a glyph in the given colors. A miss renders the glyph
+ * into a free or the least recently used slot. Changing the
+ * colors invalidates the cache.
+ */
+uint16_t *UiFontCache::cell(int g, uint16_t color, uint16_t bgColor)
+{
+    if (color != _color || bgColor != _bgColor)
+    {
+        clear();
+        _color = color;
+        _bgColor = bgColor;
+    }
+    _tick++;
+
+    int slot = _glyphSlot[g];
+    if (slot != 0xFF)
+    {
+        _hits++;
+        _slotUsed[slot] = _tick;
+        return _pool + slot * _cellW * _cellH;
+    }
+
+    _misses++;
+    slot = 0;
+    for (int i = 0; i < _nSlots; i++)
+    {
+        if (_slotGlyph[i] == 0xFF) { slot = i; break; }
+        if (_slotUsed[i] < _slotUsed[slot]) slot = i;
+    }
+    if (_slotGlyph[slot] != 0xFF) _glyphSlot[_slotGlyph[slot]] = 0xFF;
+    _slotGlyph[slot] = g;
+    _slotUsed[slot]  = _tick;
+    _glyphSlot[g]    = slot;
+
+    const UiRleGlyph &glyph = _font.glyphs[g];
+    uint16_t *dst = _pool + slot * _cellW * _cellH;
+    uint16_t fg = (color << 8) | (color >> 8);      // byte-swapped for pushImage
+    uint16_t bg = (bgColor << 8) | (bgColor >> 8);
+    int stride = glyph.xAdvance;
+    for (int i = 0; i < stride * _cellH; i++) dst[i] = bg;
+    decode(glyph, [&](int gx, int gy)   // clipped to the cell
+    {
+        int x = glyph.xOffset + gx, y = _font.ascent + glyph.yOffset + gy;
+        if (x >= 0 && x < stride && y >= 0 && y < _cellH) dst[y * stride + x] = fg;
+    });
+    return dst;
+}
+
+/**
+ * Draw a Latin-1 text, one cell per character. Only the horizontal
+ * and vertical alignment of the datum is used. Returns the width.
+ */
+int UiFontCache::drawString(UiFrameBuffer &fb, const char *latin1, int x, int y, uint16_t color, uint16_t bgColor, textdatum_t datum)
+{
+    if (!begin()) return 0;
+
+    int align = datum & 3;
+    if (align) x -= align == 1 ? textWidth(latin1) / 2 : textWidth(latin1);
+    if (datum & 16) y -= _font.ascent;        // baseline
+    else if (datum & 8) y -= _cellH;          // bottom
+    else if (datum & 4) y -= _cellH / 2;      // middle
+
+    int x0 = x;
+    for (const uint8_t *p = (const uint8_t *)latin1; *p; p++)
+    {
+        int g = glyphIndex(*p);
+        if (g < 0) continue;
+        int w = _font.glyphs[g].xAdvance;
+        fb.pushImage(x, y, w, _cellH, cell(g, color, bgColor));
+        x += w;
+        _drawn++;
+    }
+    return x - x0;
+}
+
+int UiFontCache::textWidth(const char *latin1)
+{
+    int w = 0;
+    for (const uint8_t *p = (const uint8_t *)latin1; *p; p++)
+    {
+        int g = glyphIndex(*p);
+        if (g >= 0) w += _font.glyphs[g].xAdvance;
+    }
+    return w;
+}
+
+/**
+ * Render a Latin-1 text into a 1 bit bitmap of lineHeight() rows with 
+ * stride bytes per row, MSB first. The bitmap must be cleared. 
+ * Returns the width, the text is cut at stride*8 pixels.
+ */
+int UiFontCache::renderBits(const char *latin1, uint8_t *bits, int stride)
+{
+    int maxW = stride * 8;
+    int h = lineHeight();
+    int x = 0;
+
+    for (const uint8_t *p = (const uint8_t *)latin1; *p; p++)
+    {
+        int g = glyphIndex(*p);
+        if (g < 0) continue;
+        const UiRleGlyph &glyph = _font.glyphs[g];
+        if (x + glyph.xAdvance > maxW) break;
+        decode(glyph, [&](int gx, int gy)
+        {
+            int bx = x + glyph.xOffset + gx, by = _font.ascent + glyph.yOffset + gy;
+            if (bx >= 0 && bx < maxW && by >= 0 && by < h) bits[by * stride + bx/8] |= 0x80 >> (bx & 7);
+        });
+        x += glyph.xAdvance;
+    }
+    return x;
+}
+
+int UiFontCache::lineHeight()
+{
+    return _font.ascent + _font.descent;
+}
+
+uint32_t UiFontCache::glyphsDrawn()
+{
+    return _drawn;
+}
+
+uint32_t UiFontCache::hits()
+{
+    return _hits;
+}
+
+uint32_t UiFontCache::misses()
+{
+    return _misses;
+}
+
+void UiFontCache::printStats(const char *name)
+{
+    uint32_t lookups = _hits + _misses;
+    log_i("%s: %u glyphs drawn, cache hit rate %u%% (%u misses), %d slots",
+          name, _drawn, lookups ? 100 * _hits / lookups : 0, _misses, _nSlots);
+}
+// --- UiFontCache ---
+
+
+/**
+ * Pre-render the text into the sprite. A text that fits into the
+ * width is pushed once, a longer one scrolls after a short rest.
+ * Must be called on the render task.
+ */
+void UiMarquee::setText(const char *latin1, uint16_t color, uint16_t bgColor)
+{
+    if (_windowPixels < (uint32_t)_w)
+    {
+        log_e("Window of %u pixels too small for a line of %d", _windowPixels, _w);
+        return;
+    }
+    int width = min(_font.textWidth(latin1), (int)(_spriteBytes / _h) * 8);
+    _stride = (width + 7) / 8;
+    memset(_sprite, 0, _stride * _h);
+    _textW  = max(1, _font.renderBits(latin1, _sprite, _stride));
+    _color   = (color << 8) | (color >> 8);       // byte-swapped for pushImage()
+    _bgColor = (bgColor << 8) | (bgColor >> 8);
+    _pos   = 0;
+    _hold  = _msHold;
+    _msLast = millis();
+    _shown = -1;
+}
+
+bool UiMarquee::hasText()
+{
+    return _textW > 0;
+}
+
+bool UiMarquee::isScrolling()
+{
+    return _textW > _w;
+}
+
+void UiMarquee::setSpeed(int pxPerSecond)
+{
+    _speed = pxPerSecond;
+}
+
+// While paused the title stands still and nothing is pushed
+void UiMarquee::pause(bool paused)
+{
+    _paused = paused;
+}
+
+bool UiMarquee::isPaused()
+{
+    return _paused;
+}
+
+// Push the window again on the next update, e.g. after the panel was redrawn
+void UiMarquee::invalidate()
+{
+    _shown = -1;
+}
+
+/**
+ * Called from a frame hook. The position advances with the elapsed 
+ * time, so the speed does not depend on the frame rate. The window 
+ * is only pushed when it has moved by at least one pixel.
+ */
+void UiMarquee::update(UiFrameBuffer &fb, uint32_t ms)
+{
+    uint32_t dt = ms - _msLast;
+    _msLast = ms;
+    if (_textW == 0) return;
+
+    if (isScrolling() && !_paused)
+    {
+        uint32_t period = (_textW + _gap) * 16;
+        if (_hold > 0) 
+        {
+            _hold = dt >= _hold ? 0 : _hold - dt;
+        }
+        else
+        {
+            _pos += dt * _speed * 16 / 1000;
+            if (_pos >= period) 
+            {
+                _pos = 0;   // the title is back at its start
+                _hold = _msHold;
+            }
+        }
+    }
+    int offset = _pos >> 4;
+    if (offset != _shown && (!_paused || _shown < 0)) push(fb, offset);
+}
+
+/**
+ * Expand the visible part of the sprite line by line into the 
+ * window and copy it into the frame buffer
+ */
+void UiMarquee::push(UiFrameBuffer &fb, int offset)
+{
+    uint32_t t0 = micros();
+    int period = isScrolling() ? _textW + _gap : _w;
+
+    for (int y = 0; y < _h; y++)
+    {
+        const uint8_t *row = _sprite + y * _stride;
+        uint16_t *dst = _window;
+        int sx = offset;
+        for (int x = 0; x < _w; x++)
+        {
+            *dst++ = (sx < _textW && (row[sx >> 3] & (0x80 >> (sx & 7)))) ? _color : _bgColor;
+            if (++sx == period) sx = 0;
+        }
+        fb.pushImage(_x, _y + y, _w, 1, _window);
+    }
+
+    _shown = offset;
+    _pushes++;
+    uint32_t us = micros() - t0;
+    if (us > _usPushMax) _usPushMax = us;
+}
+
+uint32_t UiMarquee::pushes()
+{
+    return _pushes;
+}
+
+uint32_t UiMarquee::usPushMax()
+{
+    return _usPushMax;
+}
+// --- UiMarquee ---
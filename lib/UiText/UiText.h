@@ -0,0 +1,156 @@
+/**
+ * Header       UiText.h
+ * 
+ * Purpose      Text pipeline for metadata from the stream.
+ *              - ICY titles arrive as ISO-8859-1 or as UTF-8. The encoding
+ *                is detected and the text is transcoded to Latin-1, the
+ *                code page of our fonts.
+ *              - UiRleFont is a subsetted font whose glyphs are stored run-
+ *                length encoded or as plain bits. The fonts are generated
+ *                with tools/fontsubset.py.
+ *              - UiFontCache keeps the recently used glyphs as ready-to-copy
+ *                RGB565 cells in a static pool. A cell covers the advance
+ *                width and the full line height, so a text is drawn by
+ *                copying one cell per character into the frame buffer
+ *                without a prior clear.
+ *              - UiMarquee pre-renders a long title once into a 1 bit 
+ *                off-screen sprite and scrolls it by drawing a moving 
+ *                window into the frame buffer from a frame hook of the 
+ *                renderer, one line at a time.
+ *
+ * Usage        uint16_t titlePool[6144];
+ *              UiFontCache titleFont(Calibri12ptRle, titlePool, 6144);
+ *
+ *              char latin1[128];
+ *              uiToLatin1(icyTitle, latin1, sizeof(latin1));
+ *              titleFont.drawString(fb, latin1, 5, 83, TFT_MAROON, TFT_WHITE);  // on the render task
+ *
+ *              uint8_t  titleSprite[6144];
+ *              uint16_t window[310];
+ *              UiMarquee marquee(titleFont, 5, 83, 310, titleSprite, sizeof(titleSprite), window, 310);
+ *              marquee.setText(latin1, TFT_MAROON, TFT_WHITE);        // on the render task
+ *              renderer.addFrameHook([](LGFX &lcd, int x, int y, void *arg) { marquee.update(fb, millis()); });
+ */
+#pragma once
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include "lgfx_esp32-2432S028.h"
+#include "UiFrameBuffer.h"
+
+enum class UiTextEncoding { Ascii, Latin1, Utf8 };
+
+UiTextEncoding uiDetectEncoding(const char *str);
+int uiToLatin1(const char *in, char *out, int size);
+
+struct UiRleGlyph
+{
+    static const uint8_t Rle = 0x01;  // flags: bitmap is run-length encoded
+
+    uint16_t offset;    // into the data of the font
+    uint8_t  w, h;
+    uint8_t  xAdvance;
+    int8_t   xOffset;
+    int8_t   yOffset;   // from the baseline to the top of the bitmap
+    uint8_t  flags;
+};
+
+struct UiRleFont
+{
+    const uint8_t    *data;
+    const UiRleGlyph *glyphs;
+    const uint8_t    *index;    // code-first -> glyph, 0xFF when not in the subset
+    uint8_t first, last;
+    uint8_t ascent, descent;    // line box above and below the baseline
+    uint8_t yAdvance;
+    uint8_t maxAdvance;
+};
+
+class UiFontCache
+{
+    public:
+        UiFontCache(const UiRleFont &font, uint16_t *pool, uint32_t poolPixels) :
+            _font(font), _pool(pool), _poolPixels(poolPixels)
+        {}
+
+        int  drawString(UiFrameBuffer &fb, const char *latin1, int x, int y, uint16_t color, uint16_t bgColor,
+                        textdatum_t datum=textdatum_t::middle_left);
+        int  textWidth(const char *latin1);
+        int  renderBits(const char *latin1, uint8_t *bits, int stride);
+        int  lineHeight();
+        void clear();
+        uint32_t glyphsDrawn();
+        uint32_t hits();
+        uint32_t misses();
+        void printStats(const char *name);
+
+    private:
+        static const int _maxSlots = 64;
+
+        bool begin();
+        int  glyphIndex(uint8_t c);
+        uint16_t *cell(int g, uint16_t color, uint16_t bgColor);
+        template<typename Plot> void decode(const UiRleGlyph &glyph, Plot plot);
+
+        const UiRleFont &_font;
+        uint16_t *_pool;
+        uint32_t _poolPixels;
+        bool     _ready = false;
+        int      _nSlots = 0;
+        int      _cellW = 0;
+        int      _cellH = 0;
+        uint16_t _color = 0;
+        uint16_t _bgColor = 0;
+        uint32_t _tick = 0;
+        uint8_t  _slotGlyph[_maxSlots];   // glyph in the slot, 0xFF = free
+        uint32_t _slotUsed[_maxSlots];    // tick of last use for LRU
+        uint8_t  _glyphSlot[256];         // glyph -> slot, 0xFF = not cached
+        uint32_t _drawn = 0;
+        uint32_t _hits = 0;
+        uint32_t _misses = 0;
+};
+
+class UiMarquee
+{
+    public:
+        UiMarquee(UiFontCache &font, int x, int y, int w, uint8_t *sprite, uint32_t spriteBytes, 
+                  uint16_t *window, uint32_t windowPixels) :
+            _font(font), _x(x), _y(y - font.lineHeight()/2), _w(w), _h(font.lineHeight()),
+            _sprite(sprite), _spriteBytes(spriteBytes), _window(window), _windowPixels(windowPixels)
+        {}
+
+        void setText(const char *latin1, uint16_t color, uint16_t bgColor);
+        bool hasText();
+        bool isScrolling();
+        void setSpeed(int pxPerSecond);
+        void pause(bool paused);
+        bool isPaused();
+        void invalidate();
+        void update(UiFrameBuffer &fb, uint32_t ms);
+        uint32_t pushes();
+        uint32_t usPushMax();
+
+    private:
+        static const int _gap = 40;             // blank pixels before the title repeats
+        static const uint32_t _msHold = 2000;   // rest at the start of the title
+
+        void push(UiFrameBuffer &fb, int offset);
+
+        UiFontCache &_font;
+        int _x, _y, _w, _h;
+        uint8_t  *_sprite;
+        uint32_t _spriteBytes;
+        uint16_t *_window;      // one line, may be shared by marquees on the same task
+        uint32_t _windowPixels;
+        int      _stride = 0;   // bytes per sprite row
+        int      _textW = 0;    // 0 = no text
+        uint16_t _color = 0;    // byte-swapped like the cells
+        uint16_t _bgColor = 0;
+        int      _speed = 30;   // pixels per second
+        uint32_t _pos = 0;      // scroll position in 1/16 pixel
+        uint32_t _hold = _msHold;
+        uint32_t _msLast = 0;
+        int      _shown = -1;   // offset on screen, -1 = must be pushed
+        bool     _paused = false;
+        uint32_t _pushes = 0;
+        uint32_t _usPushMax = 0;
+};
@@ -0,0 +1,192 @@
+/**
+ * Class        Implementation of the functions of WebAssets
+ *
+ * Purpose      Pages are sent from flash without a copy in RAM: static
+ *              assets as they are stored, templates piece by piece
+ *              through a buffer of WEB_TEMPLATE_PART bytes.
+ *
+ * Remarks      Static assets are always sent gzip-compressed, every
+ *              browser accepts it. Cache-Control: no-cache lets the
+ *              browser keep them but revalidate with the ETag, a page
+ *              changed by a new firmware is never stale.
+ */
+#include "WebAssets.h"
+#include <memory>
+
+// State of a template being streamed
+struct TemplateState
+{
+    const WebAsset *asset;
+    TemplateFn fn;
+    void      *arg;
+    uint32_t   pos = 0;                 // next byte of the template
+    int        part = -1;               // next piece of the value of key, -1 = literal text
+    char       key[WEB_TEMPLATE_KEY];
+    char       piece[WEB_TEMPLATE_PART];
+    int        pieceLen = 0;
+    int        piecePos = 0;
+};
+
+static uint32_t requests = 0;
+static uint32_t notModified = 0;
+static uint32_t templates = 0;
+static uint32_t bytesSent = 0;
+
+
+void beginWebAssets(AsyncWebServer &server)
+{
+    for (int i = 0; i < nbrWebAssets; i++)
+    {
+        const WebAsset &asset = webAssets[i];
+        if (!asset.gzip) continue;          // templates are sent by their owners
+        server.on(asset.url, HTTP_GET, [&asset](AsyncWebServerRequest *request) { serveWebAsset(request, asset); });
+    }
+    log_i("==> done");
+}
+
+
+const WebAsset *findWebAsset(const char *url)
+{
+    for (int i = 0; i < nbrWebAssets; i++)
+    {
+        if (strcmp(webAssets[i].url, url) == 0) return &webAssets[i];
+    }
+    log_e("No web asset %s", url);
+    return nullptr;
+}
+
+
+/**
+ * Answer 304 if the browser has the current version,
+ * else send the compressed asset from flash
+ */
+void serveWebAsset(AsyncWebServerRequest *request, const WebAsset &asset)
+{
+    AsyncWebServerResponse *response;
+    requests++;
+    if (request->hasHeader("If-None-Match") && strstr(request->getHeader("If-None-Match")->value().c_str(), asset.etag))
+    {
+        notModified++;
+        response = request->beginResponse(304, "", "");
+    }
+    else
+    {
+        response = request->beginResponse(200, asset.type, asset.data, asset.len);
+        response->addHeader("Content-Encoding", "gzip");
+        bytesSent += asset.len;
+    }
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
+
+
+/**
+ * Fill buf with the next bytes of the page: literal text up to the
+ * next {{key}}, then the pieces of its value. Returns 0 at the end.
+ */
+static size_t fillTemplate(TemplateState &s, uint8_t *buf, size_t maxLen)
+{
+    const char *text = reinterpret_cast<const char *>(s.asset->data);
+    uint32_t len = s.asset->len;
+    size_t n = 0;
+
+    while (n < maxLen)
+    {
+        if (s.piecePos < s.pieceLen)
+        {
+            size_t k = min(maxLen - n, (size_t)(s.pieceLen - s.piecePos));
+            memcpy(buf + n, s.piece + s.piecePos, k);
+            s.piecePos += k;
+            n += k;
+            continue;
+        }
+        if (s.part >= 0)
+        {
+            int k = s.fn(s.key, s.part, s.piece, sizeof(s.piece), s.arg);
+            if (k < 0) s.part = -1;
+            else
+            {
+                s.part++;
+                s.pieceLen = min(k, (int)sizeof(s.piece));
+                s.piecePos = 0;
+            }
+            continue;
+        }
+        if (s.pos >= len) break;
+
+        if (s.pos + 1 < len && text[s.pos] == '{' && text[s.pos + 1] == '{')
+        {
+            uint32_t end = s.pos + 2;
+            int k = 0;
+            while (end + 1 < len && !(text[end] == '}' && text[end + 1] == '}'))
+            {
+                if (k < WEB_TEMPLATE_KEY - 1) s.key[k++] = text[end];
+                end++;
+            }
+            s.key[k] = '\0';
+            s.pos = end + 2;
+            s.part = 0;
+            continue;
+        }
+        // literal text up to the next '{{'
+        uint32_t end = s.pos + 1;
+        while (end < len && end - s.pos < maxLen - n && !(text[end] == '{' && end + 1 < len && text[end + 1] == '{')) end++;
+        memcpy(buf + n, text + s.pos, end - s.pos);
+        n += end - s.pos;
+        s.pos = end;
+    }
+    bytesSent += n;
+    return n;
+}
+
+
+void sendTemplate(AsyncWebServerRequest *request, const WebAsset &asset, TemplateFn fn, void *arg)
+{
+    auto state = std::make_shared<TemplateState>();
+    state->asset = &asset;
+    state->fn = fn;
+    state->arg = arg;
+    templates++;
+    AsyncWebServerResponse *response = request->beginChunkedResponse(asset.type,
+        [state](uint8_t *buf, size_t maxLen, size_t index) -> size_t { return fillTemplate(*state, buf, maxLen); });
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+
+/**
+ * Copy a text with <, >, &, " and ' replaced by entities,
+ * returns the length of the result
+ */
+int htmlEscape(const char *in, char *out, int size)
+{
+    int n = 0;
+    for (; *in; in++)
+    {
+        const char *entity = nullptr;
+        switch (*in)
+        {
+            case '<':  entity = "&lt;";   break;
+            case '>':  entity = "&gt;";   break;
+            case '&':  entity = "&amp;";  break;
+            case '"':  entity = "&quot;"; break;
+            case '\'': entity = "&#39;";  break;
+        }
+        int k = entity ? strlen(entity) : 1;
+        if (n + k >= size) break;
+        if (entity) memcpy(out + n, entity, k);
+        else out[n] = *in;
+        n += k;
+    }
+    if (size > 0) out[n] = '\0';
+    return n;
+}
+
+
+void printWebAssetStats()
+{
+    if (requests == 0 && templates == 0) return;
+    log_i("Web assets: %u requests, %u not modified, %u templates, %u bytes sent",
+          requests, notModified, templates, bytesSent);
+}
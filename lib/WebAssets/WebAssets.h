@@ -0,0 +1,53 @@
+/**
+ * Header       WebAssets.h
+ *
+ * Purpose      Declaration of the web pages compiled into flash by
+ *              tools/webassets.py and of the functions that serve them.
+ *              - serveWebAsset() sends a static asset straight from flash,
+ *                gzip-compressed, with a strong ETag. A request with a
+ *                matching If-None-Match gets 304 without a body.
+ *              - sendTemplate() streams a template in a chunked response
+ *                and asks a callback for the value of each {{key}} field,
+ *                piece by piece, so a long value like the list of the
+ *                networks is never built as a whole.
+ *              - beginWebAssets() registers all static assets at their
+ *                URLs.
+ *              Requests, 304 answers and bytes sent are counted.
+ *
+ * Usage        python tools/webassets.py           // after a change in web/
+ *              beginWebAssets(server);             // /, /mirror, ...
+ *              sendTemplate(request, *findWebAsset("/query"), fillNetworks, nullptr);
+ */
+#pragma once
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+const int WEB_TEMPLATE_KEY  = 24;   // max length of a key incl. '\0'
+const int WEB_TEMPLATE_PART = 128;  // max length of a piece of a value
+
+struct WebAsset
+{
+    const char    *url;
+    const char    *type;
+    const uint8_t *data;
+    uint32_t       len;
+    const char    *etag;
+    bool           gzip;            // false = template, stored as plain text
+};
+
+// Generated by tools/webassets.py
+extern const WebAsset webAssets[];
+extern const int nbrWebAssets;
+
+/**
+ * Writes the piece number part of the value of key into buf and
+ * returns its length, or -1 after the last piece
+ */
+using TemplateFn = int(*)(const char *key, int part, char *buf, int size, void *arg);
+
+void beginWebAssets(AsyncWebServer &server);
+const WebAsset *findWebAsset(const char *url);
+void serveWebAsset(AsyncWebServerRequest *request, const WebAsset &asset);
+void sendTemplate(AsyncWebServerRequest *request, const WebAsset &asset, TemplateFn fn, void *arg);
+int  htmlEscape(const char *in, char *out, int size);
+void printWebAssetStats();
@@ -0,0 +1,341 @@
+// Generated by tools/webassets.py from web/, do not edit
+#include "WebAssets.h"
+
+static const uint8_t asset_index_html[] PROGMEM =
+{
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x57, 0xef, 0x6e, 0xdb, 0x36,
+    0x10, 0xff, 0xde, 0xa7, 0xb8, 0xaa, 0x5d, 0x25, 0x6f, 0xb1, 0x2c, 0x39, 0x4d, 0x9a, 0xd8, 0x96,
+    0x8b, 0x35, 0x4d, 0x81, 0x0d, 0x5b, 0x53, 0x34, 0xdd, 0x80, 0x7e, 0x2b, 0x2d, 0x51, 0x16, 0x5b,
+    0x99, 0x14, 0x48, 0xca, 0x8e, 0x97, 0xe6, 0x5d, 0xf6, 0x2c, 0x7b, 0xb2, 0x1d, 0x49, 0x49, 0x91,
+    0x9d, 0xc0, 0x1b, 0x92, 0x48, 0xe2, 0xfd, 0xe7, 0xdd, 0xef, 0x8e, 0xcc, 0xec, 0xe9, 0xdb, 0xab,
+    0x8b, 0x4f, 0x9f, 0x3f, 0x5c, 0x42, 0xa1, 0x57, 0xe5, 0xfc, 0xc9, 0xcc, 0xbc, 0xa0, 0x24, 0x7c,
+    0x99, 0x78, 0x94, 0x7b, 0x86, 0x40, 0x49, 0x36, 0x7f, 0x02, 0x30, 0x5b, 0x51, 0x4d, 0x20, 0x2d,
+    0x88, 0x54, 0x54, 0x27, 0xde, 0x1f, 0x9f, 0xde, 0x0d, 0xcf, 0xbc, 0x7b, 0x06, 0x27, 0x2b, 0x9a,
+    0x78, 0x6b, 0x46, 0x37, 0x95, 0x90, 0xda, 0x83, 0x54, 0x70, 0x4d, 0x39, 0x0a, 0x6e, 0x58, 0xa6,
+    0x8b, 0x24, 0xa3, 0x6b, 0x96, 0xd2, 0xa1, 0x5d, 0x1c, 0x01, 0xe3, 0x4c, 0x33, 0x52, 0x0e, 0x55,
+    0x4a, 0x4a, 0x9a, 0xc4, 0x61, 0xe4, 0x0c, 0x69, 0xa6, 0x4b, 0x3a, 0xbf, 0xf8, 0xfc, 0x16, 0x3e,
+    0x92, 0x8c, 0x89, 0xd9, 0xc8, 0x11, 0x0c, 0x4b, 0xe9, 0xad, 0xfb, 0x02, 0xf8, 0x11, 0x6e, 0x61,
+    0x45, 0xe4, 0x92, 0xf1, 0x09, 0x44, 0x53, 0xa8, 0x48, 0x96, 0x31, 0xbe, 0xb4, 0xdf, 0x0b, 0x71,
+    0x33, 0x54, 0xec, 0x2f, 0xbb, 0x5c, 0x08, 0x99, 0x51, 0x39, 0x44, 0xd2, 0x14, 0xee, 0xac, 0xe2,
+    0x42, 0x64, 0x5b, 0xb8, 0xb5, 0x9f, 0x00, 0x19, 0x53, 0x55, 0x49, 0xb6, 0x13, 0x58, 0x4a, 0x96,
+    0x4d, 0x1b, 0xe2, 0xd7, 0x5a, 0x69, 0x96, 0x6f, 0x87, 0x4c, 0xd3, 0x95, 0x9a, 0x40, 0x8a, 0x1b,
+    0xa0, 0xb2, 0x65, 0x76, 0x8e, 0x62, 0x49, 0x57, 0x2d, 0x31, 0xc7, 0x6d, 0x0e, 0x73, 0xb2, 0x62,
+    0x25, 0x9a, 0xfa, 0x28, 0x16, 0x42, 0x8b, 0x23, 0x50, 0x84, 0xab, 0xa1, 0xa2, 0x92, 0xe5, 0x3b,
+    0x62, 0x18, 0x19, 0x45, 0xed, 0x71, 0xa5, 0x5b, 0x72, 0x2a, 0x4a, 0x21, 0x27, 0xf0, 0x2c, 0x8d,
+    0xcc, 0x4f, 0x4b, 0x5d, 0x90, 0xf4, 0xdb, 0x52, 0x8a, 0x9a, 0x67, 0xc3, 0x56, 0x20, 0x7e, 0x15,
+    0x93, 0x38, 0x75, 0x02, 0x6e, 0x33, 0xcf, 0x2a, 0xc2, 0x69, 0x79, 0x78, 0x3b, 0xe6, 0x7b, 0xb8,
+    0x24, 0xd5, 0x04, 0xc2, 0x93, 0x5e, 0xcc, 0xb6, 0x08, 0x13, 0x18, 0x47, 0x3d, 0xda, 0xa3, 0x9b,
+    0x7b, 0x24, 0x90, 0xf1, 0xf9, 0xf1, 0xe9, 0x71, 0xe7, 0xa0, 0xc9, 0xb1, 0xc4, 0x6a, 0xd5, 0x6a,
+    0x4f, 0xd7, 0x94, 0xa2, 0x20, 0x99, 0xd8, 0x60, 0x65, 0xe0, 0xac, 0xba, 0x81, 0xf8, 0x14, 0x1f,
+    0x72, 0xb9, 0x20, 0x41, 0x74, 0x04, 0xcd, 0x6f, 0xf8, 0x72, 0x60, 0xd0, 0x80, 0x88, 0x42, 0xa1,
+    0x31, 0xf2, 0x5f, 0xb6, 0x32, 0xf1, 0xc9, 0xf9, 0x11, 0x86, 0x38, 0xc6, 0xc7, 0xf8, 0xd8, 0x48,
+    0x8e, 0x4f, 0x06, 0xfd, 0xfd, 0x17, 0xb1, 0x75, 0x73, 0xbb, 0x93, 0x5a, 0xb7, 0xcd, 0x2e, 0xad,
+    0xa7, 0xa7, 0x67, 0x67, 0xe7, 0xe7, 0x53, 0xd0, 0xf4, 0x46, 0x77, 0xc1, 0x0c, 0x63, 0x74, 0x61,
+    0x1f, 0x11, 0x3c, 0x8b, 0xa2, 0xa8, 0x61, 0x93, 0x92, 0x2d, 0x79, 0x57, 0xf2, 0x36, 0xc9, 0x16,
+    0x80, 0x06, 0x6f, 0x8c, 0x0f, 0x0b, 0xca, 0x96, 0x85, 0x9e, 0xc0, 0x71, 0xdf, 0x45, 0x9e, 0x67,
+    0xaf, 0x8c, 0x0d, 0x27, 0xaf, 0x68, 0x49, 0x53, 0x6d, 0x76, 0x54, 0xd5, 0xf8, 0x5a, 0xd4, 0x5a,
+    0x0b, 0x8e, 0xea, 0x4d, 0xc6, 0xe3, 0x28, 0xfa, 0xa1, 0x07, 0xd8, 0x38, 0xaa, 0x6e, 0xa6, 0xfb,
+    0x39, 0x7c, 0x55, 0xdd, 0xe3, 0xb5, 0x55, 0x77, 0x22, 0x13, 0xe0, 0x82, 0xd3, 0xce, 0xf5, 0xa6,
+    0x40, 0x94, 0x4e, 0x1f, 0xab, 0xd1, 0xcb, 0x8b, 0x9f, 0xdf, 0x9d, 0x60, 0x4c, 0x69, 0x2d, 0x95,
+    0x21, 0x54, 0x82, 0xf5, 0x37, 0xe5, 0xcc, 0x4e, 0x0a, 0xb1, 0xa6, 0x12, 0x8d, 0x8b, 0x8a, 0xa4,
+    0x4c, 0x23, 0x72, 0xa2, 0xf0, 0x6c, 0x57, 0x24, 0x74, 0xce, 0x1f, 0x3a, 0x48, 0x4f, 0xc7, 0x67,
+    0xe3, 0x4e, 0x38, 0x94, 0x62, 0x63, 0x2b, 0xb1, 0x8b, 0x41, 0x87, 0x3e, 0x6c, 0x24, 0xa4, 0x69,
+    0x6a, 0x74, 0xeb, 0x15, 0x37, 0x20, 0xc9, 0xa5, 0xf9, 0x9b, 0x3e, 0x40, 0x67, 0x97, 0x73, 0x4c,
+    0x22, 0x8e, 0x14, 0xb9, 0x6d, 0x8b, 0xdb, 0xb6, 0xd7, 0x4a, 0x70, 0xa1, 0x30, 0x5a, 0xdc, 0x75,
+    0xbf, 0xe8, 0x11, 0xf6, 0x53, 0x57, 0x8f, 0xb3, 0xc8, 0xfc, 0xb4, 0xb6, 0x08, 0x34, 0x20, 0xd9,
+    0x47, 0x84, 0x61, 0xcf, 0x46, 0xcd, 0x50, 0x99, 0x8d, 0xdc, 0x8c, 0x9b, 0x99, 0x01, 0x61, 0xa7,
+    0x4d, 0xc6, 0xd6, 0xc0, 0xb2, 0xc4, 0xb3, 0x3d, 0xe6, 0xb9, 0xb1, 0x33, 0x2b, 0xe2, 0xfe, 0x68,
+    0xc2, 0x95, 0x23, 0xbb, 0x9a, 0x5b, 0x71, 0xa5, 0x89, 0x66, 0x02, 0xa7, 0x26, 0x9a, 0xb6, 0xd4,
+    0x46, 0xa4, 0x35, 0x67, 0xd1, 0xe4, 0xcd, 0x5f, 0xf0, 0x85, 0xaa, 0xa6, 0xb3, 0x11, 0x92, 0x1b,
+    0x81, 0x92, 0x2c, 0x68, 0x39, 0xff, 0xd3, 0xa4, 0x88, 0xc2, 0xcc, 0xa2, 0xc7, 0x2a, 0xac, 0x2d,
+    0xc5, 0x03, 0xbd, 0xad, 0x70, 0xb8, 0x4a, 0x9c, 0xca, 0xb8, 0x40, 0x2c, 0x26, 0x5e, 0x84, 0x6f,
+    0x72, 0x93, 0x78, 0xb1, 0x07, 0x4a, 0xd3, 0x0a, 0x09, 0x61, 0x14, 0x1b, 0xc7, 0xce, 0xd4, 0xbd,
+    0xdf, 0xb4, 0x24, 0x4a, 0xa1, 0xae, 0xd8, 0x20, 0xb7, 0x41, 0x94, 0xdd, 0x9a, 0xa4, 0x6b, 0x0c,
+    0xa5, 0xc4, 0xdc, 0x7d, 0xc0, 0xcf, 0xd9, 0xc8, 0xf1, 0x76, 0x64, 0x38, 0x36, 0x86, 0x37, 0x7f,
+    0x8f, 0x4f, 0x78, 0xb1, 0xd4, 0xd3, 0x7b, 0x99, 0x5e, 0xe8, 0x87, 0x7c, 0x28, 0x2d, 0x24, 0xee,
+    0xf7, 0xda, 0xbc, 0x1e, 0x75, 0x20, 0x29, 0x1e, 0x00, 0x98, 0xe0, 0x8f, 0xf6, 0xfd, 0xa8, 0xfd,
+    0x5d, 0x69, 0x6c, 0x04, 0x2b, 0x8d, 0xef, 0x4e, 0x7a, 0x2f, 0xc7, 0x2d, 0x7a, 0xbc, 0x39, 0x1e,
+    0x41, 0x1c, 0x8b, 0x80, 0xbd, 0x06, 0x61, 0x18, 0xf6, 0x8d, 0x12, 0x28, 0x24, 0xcd, 0x13, 0x6f,
+    0xb4, 0x62, 0x52, 0x0a, 0x89, 0x21, 0xa6, 0x92, 0x52, 0x0e, 0x6e, 0x39, 0x1b, 0x11, 0x8b, 0x82,
+    0x56, 0x61, 0xa6, 0x52, 0xc9, 0xaa, 0xa6, 0x98, 0x68, 0x54, 0x69, 0x78, 0x0e, 0x09, 0x7a, 0x83,
+    0x64, 0x0e, 0x99, 0x48, 0xb1, 0x44, 0x5c, 0x87, 0x4b, 0xaa, 0x2f, 0x8d, 0x6b, 0xae, 0xdf, 0x6c,
+    0x7f, 0xc9, 0x02, 0x96, 0x35, 0xe3, 0xca, 0x29, 0x54, 0x02, 0x1f, 0x09, 0x04, 0x15, 0x31, 0xe7,
+    0xdf, 0x9a, 0x94, 0x35, 0x1d, 0x18, 0xf5, 0x9c, 0xea, 0xb4, 0xb0, 0x54, 0xf8, 0x09, 0x02, 0x4b,
+    0x87, 0xa7, 0x49, 0x02, 0xd8, 0x6e, 0x34, 0x67, 0x9c, 0x66, 0xf0, 0x1a, 0xfc, 0xd7, 0x3e, 0x32,
+    0x1d, 0x6f, 0x02, 0xbe, 0x8f, 0x23, 0x13, 0x27, 0x12, 0xd5, 0x85, 0xc8, 0x70, 0xf9, 0xe1, 0xea,
+    0xfa, 0x93, 0x0f, 0x77, 0xe8, 0xcd, 0xba, 0x73, 0x06, 0xfd, 0x11, 0xa9, 0xd8, 0xa8, 0xc1, 0xa3,
+    0xf2, 0x07, 0xa1, 0x2e, 0x28, 0x0f, 0xa4, 0xf1, 0x28, 0xc3, 0xaf, 0x4a, 0xf0, 0x60, 0xd0, 0xd0,
+    0x4a, 0x66, 0x02, 0x9b, 0x77, 0x07, 0x49, 0x2e, 0x24, 0x04, 0x2e, 0x66, 0x05, 0x22, 0x07, 0xc3,
+    0x1f, 0xc0, 0xf3, 0xc0, 0x6f, 0x8c, 0xa1, 0x2d, 0x9c, 0x5f, 0x01, 0xa7, 0x1b, 0xb8, 0xaa, 0x0c,
+    0x21, 0x50, 0xa1, 0x39, 0xfb, 0xf1, 0xd4, 0x0b, 0x71, 0xcf, 0x83, 0x76, 0xfe, 0x4b, 0xaa, 0x6b,
+    0xc9, 0x1f, 0x84, 0x53, 0x1f, 0x0c, 0x46, 0x15, 0x62, 0xd3, 0x4e, 0xf9, 0x6e, 0x43, 0x35, 0x4f,
+    0x8d, 0x1f, 0x30, 0xcc, 0x40, 0x0d, 0xba, 0x48, 0x77, 0x62, 0x72, 0xd9, 0x49, 0x30, 0x88, 0x86,
+    0x36, 0xbd, 0x97, 0x72, 0x5d, 0xb4, 0x23, 0xe4, 0x48, 0x3d, 0x19, 0xdb, 0x9a, 0x26, 0x34, 0x04,
+    0xfb, 0x85, 0xbb, 0xba, 0x58, 0x41, 0x77, 0x00, 0x7c, 0xff, 0x0e, 0xfe, 0x3f, 0x7f, 0xfb, 0x3d,
+    0x79, 0x87, 0x45, 0x54, 0xb0, 0xd8, 0xff, 0x0d, 0x93, 0x14, 0x6a, 0xb1, 0x5c, 0x96, 0x34, 0xf0,
+    0x31, 0x1e, 0x93, 0x0c, 0x27, 0x81, 0xe0, 0x1b, 0x3c, 0xa6, 0xb6, 0xef, 0xa7, 0x93, 0x36, 0xf5,
+    0xc6, 0x86, 0xa9, 0xa0, 0xa3, 0xf8, 0xa6, 0xe8, 0x0e, 0xf3, 0x7e, 0x7b, 0x02, 0x3e, 0x79, 0x90,
+    0x00, 0xc1, 0xf1, 0x6a, 0x86, 0xf3, 0x01, 0xad, 0x51, 0x93, 0x59, 0x03, 0xb8, 0x5d, 0x18, 0x60,
+    0x54, 0x3e, 0x76, 0x88, 0xc1, 0x12, 0x0d, 0x35, 0x5e, 0xa0, 0xa8, 0x76, 0x19, 0x69, 0x02, 0xec,
+    0x67, 0xea, 0x80, 0xb5, 0x46, 0x06, 0x8d, 0x59, 0xe5, 0x83, 0xf6, 0xcc, 0x90, 0x71, 0xd6, 0x4a,
+    0x96, 0x7e, 0x33, 0xf8, 0x1f, 0xec, 0x59, 0x73, 0x12, 0x9d, 0x82, 0x99, 0x38, 0x87, 0x15, 0x9c,
+    0xc4, 0xf4, 0x3e, 0x01, 0x38, 0x5b, 0xfe, 0xd3, 0x05, 0xde, 0x2f, 0x46, 0x8d, 0x64, 0xa7, 0xe9,
+    0x66, 0xcf, 0xff, 0x52, 0x6d, 0x45, 0xfb, 0xba, 0xae, 0x8c, 0x07, 0x74, 0x1b, 0x19, 0xcc, 0x93,
+    0xe0, 0x36, 0x49, 0xc1, 0xe3, 0xb0, 0x31, 0x17, 0x65, 0x82, 0x57, 0x20, 0x0b, 0x9c, 0x01, 0x96,
+    0x3f, 0xc2, 0x7a, 0xc7, 0x83, 0x16, 0xfe, 0xae, 0x15, 0xe9, 0x1a, 0x81, 0xa2, 0xd0, 0x8d, 0xe9,
+    0xbb, 0x4b, 0xb3, 0xb8, 0x16, 0xb5, 0x4c, 0x69, 0xe3, 0xcb, 0xb1, 0xdb, 0x00, 0xdd, 0xca, 0xb4,
+    0xa9, 0x95, 0x34, 0x5e, 0x28, 0xa7, 0x32, 0xf0, 0xeb, 0x2a, 0xc3, 0xa3, 0x18, 0x43, 0xa2, 0xfd,
+    0x8e, 0x77, 0x1e, 0x72, 0x89, 0x4d, 0x8c, 0x0e, 0x7e, 0xbd, 0xbe, 0x7a, 0x1f, 0x56, 0xe6, 0x92,
+    0x1f, 0xd0, 0x10, 0xc5, 0x49, 0x07, 0x5f, 0x96, 0x43, 0x60, 0xa5, 0x42, 0xd7, 0xc8, 0x03, 0xd7,
+    0x91, 0x3b, 0xa4, 0xe9, 0x8e, 0x4d, 0x03, 0x6d, 0xc7, 0xee, 0xa6, 0x72, 0xdf, 0x98, 0x9b, 0x2b,
+    0x1d, 0x6b, 0xbf, 0x2b, 0x1a, 0x49, 0x80, 0x2f, 0x8b, 0x3a, 0xcf, 0xf1, 0xae, 0xf2, 0xfc, 0xf6,
+    0x77, 0x9c, 0x93, 0x21, 0x9e, 0x7f, 0x01, 0xce, 0x73, 0x1d, 0x3a, 0x32, 0xcd, 0x06, 0x77, 0x61,
+    0xd8, 0xf2, 0xc8, 0xcd, 0x3e, 0x0f, 0x16, 0x5b, 0x4d, 0xd5, 0x11, 0x48, 0xa5, 0x18, 0x9a, 0xd0,
+    0xa1, 0xf9, 0xb8, 0x83, 0xec, 0xcd, 0xea, 0xc8, 0x4e, 0x59, 0x29, 0x6b, 0xae, 0x2c, 0xa3, 0x5b,
+    0xdd, 0x7d, 0xb9, 0x9f, 0x41, 0xbd, 0x84, 0xe2, 0xed, 0xcb, 0x1c, 0x0f, 0x5d, 0xb1, 0x0f, 0x05,
+    0x0f, 0xb6, 0xd4, 0xfd, 0xf3, 0xc7, 0xf6, 0x2e, 0x5e, 0x0c, 0x9a, 0xb3, 0x04, 0x8f, 0x2f, 0x7b,
+    0xdb, 0xc0, 0x9b, 0x84, 0xfd, 0xc7, 0xeb, 0x5f, 0xc4, 0x07, 0xe8, 0xb8, 0x89, 0x0d, 0x00, 0x00,
+};
+
+static const uint8_t asset_mirror_html[] PROGMEM =
+{
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x56, 0x6d, 0x6f, 0xe2, 0x46,
+    0x10, 0xfe, 0x9e, 0x5f, 0x31, 0x25, 0xd7, 0xc3, 0x34, 0x60, 0x8c, 0x81, 0x24, 0xc5, 0x80, 0x74,
+    0x4d, 0xae, 0xd2, 0x49, 0xad, 0x5a, 0xb5, 0xb9, 0x56, 0xa7, 0x53, 0x24, 0x16, 0x7b, 0x81, 0x55,
+    0x6c, 0xaf, 0xe3, 0x5d, 0xde, 0x9a, 0xf2, 0xdf, 0x3b, 0xe3, 0xb5, 0xc1, 0x76, 0xe8, 0x9d, 0xaa,
+    0x86, 0x20, 0xec, 0x9d, 0x99, 0x67, 0xde, 0x67, 0x67, 0xfc, 0xcd, 0xfd, 0x2f, 0x77, 0x0f, 0x9f,
+    0x7e, 0x7d, 0x0f, 0x2b, 0x1d, 0x85, 0xd3, 0x8b, 0x31, 0xfd, 0x40, 0xc8, 0xe2, 0xe5, 0xa4, 0xc1,
+    0xe3, 0x06, 0x1d, 0x70, 0x16, 0x4c, 0x2f, 0x00, 0xc6, 0x11, 0xd7, 0x0c, 0xfc, 0x15, 0x4b, 0x15,
+    0xd7, 0x93, 0xc6, 0xc7, 0x87, 0x1f, 0x3b, 0xb7, 0x8d, 0x13, 0x21, 0x66, 0x11, 0x9f, 0x34, 0x36,
+    0x82, 0x6f, 0x13, 0x99, 0xea, 0x06, 0xf8, 0x32, 0xd6, 0x3c, 0x46, 0xc6, 0xad, 0x08, 0xf4, 0x6a,
+    0x12, 0xf0, 0x8d, 0xf0, 0x79, 0x27, 0x7b, 0x69, 0x83, 0x88, 0x85, 0x16, 0x2c, 0xec, 0x28, 0x9f,
+    0x85, 0x7c, 0xd2, 0xb3, 0x1d, 0x03, 0xa4, 0x85, 0x0e, 0xf9, 0xf4, 0xee, 0xd3, 0x3d, 0xfc, 0x2c,
+    0xd2, 0x54, 0xa6, 0xe3, 0xae, 0x39, 0x21, 0x9a, 0xd2, 0x7b, 0xf3, 0x04, 0x30, 0x97, 0xc1, 0x1e,
+    0x7f, 0x5e, 0x20, 0x62, 0xe9, 0x52, 0xc4, 0x23, 0x70, 0x3c, 0x48, 0x58, 0x10, 0x88, 0x78, 0x39,
+    0x82, 0x1e, 0x8f, 0x3c, 0x98, 0x33, 0xff, 0x69, 0x99, 0xca, 0x75, 0x1c, 0x74, 0x7c, 0x19, 0xca,
+    0x74, 0x04, 0x97, 0xbd, 0x9b, 0x1e, 0xeb, 0xf9, 0x1e, 0x14, 0xef, 0xbe, 0x43, 0x1f, 0x0f, 0x16,
+    0x68, 0x67, 0x67, 0xc1, 0x22, 0x11, 0xee, 0x47, 0xf0, 0x9b, 0x9c, 0x4b, 0x2d, 0xdb, 0xa0, 0x58,
+    0xac, 0x3a, 0x8a, 0xa7, 0x62, 0x91, 0x33, 0x28, 0xf1, 0x17, 0x47, 0xec, 0x5e, 0xa2, 0x3d, 0x38,
+    0x64, 0x46, 0xf8, 0x2c, 0xde, 0x30, 0x85, 0x46, 0x04, 0x42, 0x25, 0x21, 0x43, 0xe1, 0x79, 0x28,
+    0xfd, 0x27, 0xd4, 0x2d, 0xd3, 0x80, 0xa3, 0x86, 0x5e, 0xb2, 0x03, 0x25, 0x43, 0x11, 0xc0, 0xe5,
+    0xc0, 0xa1, 0x8f, 0x07, 0x22, 0x62, 0x4b, 0xde, 0x49, 0x79, 0x8c, 0x0c, 0x99, 0xb1, 0x89, 0xd8,
+    0xf1, 0x90, 0x69, 0x1e, 0x78, 0x90, 0x45, 0x66, 0x04, 0xd7, 0x03, 0x27, 0xd9, 0x15, 0x3a, 0x2e,
+    0x95, 0x66, 0x5a, 0x1d, 0x1d, 0xed, 0x68, 0x99, 0xa0, 0xb3, 0xf6, 0x90, 0x5c, 0xac, 0xd8, 0x1d,
+    0xc9, 0x58, 0xaa, 0x84, 0xf9, 0xdc, 0x48, 0x8e, 0xbb, 0x79, 0xb4, 0xc6, 0x5d, 0x93, 0xbd, 0x31,
+    0x85, 0x2c, 0x0b, 0x63, 0x6e, 0xb6, 0x08, 0x26, 0x0d, 0xe5, 0xa7, 0x1c, 0x53, 0x6c, 0x34, 0x4f,
+    0x1a, 0x7d, 0xd7, 0x69, 0xc0, 0x8a, 0x8b, 0xe5, 0x0a, 0x93, 0xe6, 0x0e, 0x30, 0x25, 0xe3, 0xae,
+    0xe1, 0xce, 0x04, 0x03, 0xb1, 0x31, 0x52, 0x64, 0x52, 0x63, 0x8a, 0xe9, 0x8d, 0xb9, 0xaf, 0xd1,
+    0x0b, 0xb0, 0x6d, 0x7b, 0xdc, 0x45, 0xb2, 0x49, 0x93, 0x9f, 0x8a, 0x44, 0x9b, 0x3c, 0x21, 0x8f,
+    0xd2, 0x45, 0xa0, 0x26, 0x10, 0x48, 0x7f, 0x1d, 0x61, 0x49, 0xd8, 0x4b, 0xae, 0xdf, 0x87, 0x9c,
+    0x1e, 0x7f, 0xd8, 0x7f, 0x08, 0xac, 0xa6, 0x31, 0xa4, 0xd9, 0xf2, 0xca, 0x52, 0x7a, 0x87, 0x22,
+    0x46, 0x96, 0x04, 0xee, 0xa8, 0x9c, 0x76, 0xda, 0x6a, 0xba, 0x41, 0x95, 0xd1, 0x84, 0xe8, 0x4b,
+    0xe8, 0xc4, 0x50, 0xc8, 0x84, 0x5c, 0x63, 0x16, 0x96, 0x04, 0xad, 0x77, 0x36, 0xea, 0xc5, 0xe0,
+    0x7f, 0xa0, 0xac, 0xdc, 0x33, 0xcd, 0xac, 0x5c, 0x5d, 0x5e, 0xa4, 0xf9, 0x9b, 0x09, 0x49, 0x49,
+    0x7e, 0xbe, 0xd7, 0x9c, 0x34, 0x3a, 0xde, 0x45, 0x76, 0xb6, 0x58, 0xc7, 0x18, 0x08, 0x19, 0x43,
+    0xb2, 0xd6, 0x16, 0x16, 0x8f, 0xdf, 0x82, 0x97, 0x8c, 0x50, 0x98, 0x18, 0x20, 0x33, 0x2a, 0xb5,
+    0x03, 0xd4, 0xe1, 0xe5, 0x94, 0xe0, 0xb3, 0x7c, 0xcc, 0x1e, 0x26, 0x60, 0xf9, 0x30, 0x9d, 0x62,
+    0x6d, 0xb5, 0xe0, 0x3b, 0x18, 0xba, 0x37, 0x70, 0x05, 0x6e, 0x9f, 0x4e, 0xae, 0x4b, 0xbc, 0x78,
+    0xd8, 0x7b, 0x3c, 0xf2, 0x0e, 0xe1, 0x2d, 0x5c, 0xf7, 0x89, 0xdf, 0x1d, 0x7e, 0x8f, 0xa4, 0xfe,
+    0x39, 0x7e, 0x37, 0xe7, 0x7f, 0x0b, 0xfd, 0xaf, 0x41, 0xf7, 0x89, 0xd5, 0x1d, 0x0e, 0xcd, 0xe9,
+    0xa1, 0xe6, 0x96, 0x16, 0x21, 0x57, 0xd6, 0xe6, 0xe4, 0x15, 0x05, 0x21, 0x41, 0x89, 0x23, 0xca,
+    0x42, 0xa6, 0x60, 0xd1, 0xa9, 0xc6, 0xd3, 0x0d, 0x65, 0xe0, 0xa3, 0x88, 0x75, 0xef, 0xda, 0x1a,
+    0xb4, 0x41, 0xa7, 0x6b, 0xde, 0xf2, 0x90, 0x32, 0xa5, 0x36, 0xd5, 0x9d, 0xce, 0x09, 0xa7, 0x88,
+    0xcf, 0xae, 0x26, 0x95, 0xe4, 0x52, 0x6d, 0xd8, 0xd7, 0x29, 0xe4, 0x41, 0x81, 0x59, 0x43, 0xd9,
+    0x96, 0x79, 0x6f, 0x33, 0xd6, 0x01, 0x42, 0xac, 0x5e, 0x1f, 0x0f, 0xf1, 0x78, 0x8b, 0x5d, 0xaa,
+    0xce, 0xa0, 0x5f, 0xbf, 0x42, 0x27, 0xbf, 0x9e, 0x91, 0x93, 0xa8, 0xb7, 0x6d, 0xc0, 0xe6, 0xc5,
+    0x97, 0x67, 0x32, 0x04, 0x83, 0x9a, 0xc1, 0xe0, 0x3c, 0x33, 0xe5, 0x50, 0x35, 0x88, 0x51, 0x34,
+    0x90, 0x32, 0x05, 0xcb, 0xda, 0x23, 0xbf, 0x25, 0xa0, 0x8b, 0x56, 0xfe, 0x0d, 0x4e, 0x8b, 0xf2,
+    0x41, 0x15, 0x91, 0x55, 0x1a, 0x92, 0x76, 0xf8, 0x15, 0xf0, 0x2d, 0x6c, 0x89, 0x30, 0x38, 0x01,
+    0x6d, 0x57, 0x18, 0x7b, 0xb0, 0x9e, 0x61, 0x4c, 0x7a, 0xcb, 0x91, 0x2b, 0x94, 0xc4, 0x35, 0x1f,
+    0x9e, 0x8f, 0x11, 0x47, 0x13, 0x31, 0xa9, 0x5e, 0x49, 0x42, 0x2c, 0xc0, 0x8a, 0xb1, 0x1e, 0x9c,
+    0xdd, 0xad, 0xe3, 0x38, 0x55, 0xb4, 0x63, 0xdf, 0xfd, 0x07, 0xbc, 0x52, 0xe2, 0x9f, 0x50, 0xcc,
+    0x40, 0xdf, 0x2c, 0x16, 0x38, 0x34, 0x9f, 0x4c, 0xba, 0x9f, 0x28, 0xdd, 0xd4, 0x16, 0x4c, 0x5b,
+    0xe2, 0xea, 0xaa, 0x45, 0xcd, 0x51, 0x46, 0x38, 0x00, 0x0f, 0x15, 0xaf, 0x19, 0x52, 0x05, 0x2d,
+    0x63, 0xb5, 0x73, 0x23, 0x6a, 0x98, 0xe7, 0xec, 0xad, 0xaa, 0xb9, 0x78, 0xfd, 0x44, 0xfd, 0x8f,
+    0x28, 0xa7, 0xe6, 0xc7, 0x7c, 0xb4, 0xc1, 0xc9, 0xfe, 0x77, 0x58, 0x79, 0x58, 0x22, 0x58, 0x3c,
+    0x25, 0x18, 0xaa, 0x78, 0x4c, 0x42, 0x71, 0x70, 0x38, 0xdb, 0x2b, 0xf9, 0x58, 0xb4, 0xea, 0x23,
+    0x60, 0x4b, 0xb5, 0x16, 0xf3, 0x2d, 0xfc, 0xc9, 0xe7, 0xbf, 0xe3, 0x35, 0xc1, 0xb5, 0x35, 0xdb,
+    0xaa, 0x51, 0xb7, 0xfb, 0xe6, 0x05, 0x6f, 0x0d, 0x46, 0xb2, 0xf6, 0x4a, 0x2a, 0x7d, 0xe8, 0x46,
+    0xd9, 0xcd, 0xd7, 0xdd, 0xaa, 0xd9, 0x51, 0xf7, 0x56, 0xd9, 0x73, 0x11, 0xb3, 0x74, 0xff, 0xb0,
+    0x4f, 0x38, 0xe2, 0x34, 0x59, 0x9a, 0xb2, 0xfd, 0x7c, 0xbd, 0x58, 0xf0, 0xb4, 0x59, 0x62, 0x92,
+    0x71, 0xc4, 0x95, 0x42, 0x7f, 0xc8, 0x52, 0xaa, 0xbb, 0x7a, 0xa3, 0x6d, 0x72, 0x23, 0xc8, 0xdf,
+    0x3f, 0xf0, 0xa6, 0xb6, 0x78, 0x36, 0x93, 0x4a, 0x4e, 0x9a, 0xd9, 0x86, 0x31, 0x36, 0x14, 0x9b,
+    0xde, 0x7f, 0xe2, 0xf1, 0x52, 0xaf, 0x4e, 0x3c, 0x6a, 0x2b, 0xb4, 0xbf, 0x02, 0xab, 0xd4, 0x55,
+    0x54, 0xd1, 0x95, 0xda, 0x64, 0x98, 0x55, 0x67, 0x54, 0xad, 0xaf, 0xd2, 0x70, 0xad, 0x15, 0xd9,
+    0xeb, 0x96, 0x2e, 0x09, 0x98, 0xf9, 0xfb, 0x6f, 0x83, 0xe5, 0x9c, 0x44, 0x76, 0xf9, 0x1d, 0x15,
+    0x51, 0x9b, 0x56, 0x74, 0x5f, 0x41, 0x33, 0xd9, 0x35, 0xab, 0x92, 0xff, 0xe7, 0x4e, 0xc8, 0x23,
+    0x87, 0x72, 0x4f, 0x5e, 0x3d, 0x06, 0xbd, 0x6a, 0x0c, 0x8a, 0x51, 0xfa, 0x75, 0x41, 0xb7, 0x2a,
+    0x88, 0xd9, 0x55, 0x58, 0x7c, 0x16, 0x65, 0x2f, 0x0b, 0xf9, 0x3b, 0x2a, 0x01, 0xeb, 0x73, 0x3f,
+    0xab, 0xd7, 0x52, 0x26, 0xdc, 0x56, 0xe5, 0xb5, 0xdf, 0x7a, 0x6c, 0xd5, 0x82, 0x94, 0xdd, 0x87,
+    0x36, 0x5d, 0xa6, 0x77, 0x66, 0x45, 0x43, 0xc7, 0x67, 0x8b, 0x14, 0xd7, 0x37, 0x78, 0xf3, 0x72,
+    0x2e, 0x2b, 0x87, 0x51, 0x99, 0xd0, 0x77, 0x8f, 0xc1, 0x3f, 0x98, 0x72, 0x69, 0xc3, 0x0c, 0xae,
+    0x2a, 0x2a, 0xce, 0xfd, 0xcd, 0x70, 0xd7, 0x8b, 0x6b, 0x1a, 0x6e, 0x8f, 0x40, 0x11, 0xa2, 0xa4,
+    0x5a, 0xd7, 0xe8, 0x3d, 0xa7, 0xc2, 0xa0, 0xa5, 0x66, 0x21, 0xb2, 0x64, 0x5a, 0x73, 0xe5, 0xb3,
+    0x2f, 0x84, 0xb2, 0x68, 0xf6, 0x43, 0xa5, 0x47, 0xfc, 0x50, 0x2a, 0xea, 0x10, 0xec, 0x51, 0x6a,
+    0x91, 0xb3, 0xf1, 0x68, 0xe2, 0x52, 0x97, 0xb7, 0x32, 0x0f, 0xd0, 0x32, 0xae, 0xd3, 0x7d, 0xbe,
+    0xea, 0x34, 0x3d, 0xc0, 0xfd, 0xf7, 0x41, 0x44, 0x5c, 0xe2, 0x0c, 0xca, 0x99, 0xda, 0xe0, 0xd2,
+    0x44, 0xf5, 0x0a, 0x55, 0x87, 0x62, 0x41, 0x31, 0xc3, 0xc0, 0x33, 0x3b, 0x59, 0xbe, 0x1a, 0x8d,
+    0xbb, 0x66, 0x1b, 0xc3, 0xe5, 0x2c, 0x5b, 0xb9, 0xff, 0x01, 0x70, 0x1a, 0x5a, 0xfd, 0x83, 0x0b,
+    0x00, 0x00,
+};
+
+static const uint8_t asset_query_tmpl_html[] PROGMEM =
+{
+    0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+    0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x65, 0x6e, 0x22, 0x3e,
+    0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22, 0x3e,
+    0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76,
+    0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+    0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77,
+    0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63,
+    0x61, 0x6c, 0x65, 0x3d, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74, 0x69, 0x74,
+    0x6c, 0x65, 0x3e, 0x45, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x43, 0x72, 0x65, 0x64, 0x65, 0x6e, 0x74,
+    0x69, 0x61, 0x6c, 0x73, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+    0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x7b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30,
+    0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x69, 0x7a, 0x69,
+    0x6e, 0x67, 0x3a, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x78, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x2c,
+    0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65,
+    0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x52,
+    0x6f, 0x62, 0x6f, 0x74, 0x6f, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69,
+    0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69,
+    0x7a, 0x65, 0x3a, 0x20, 0x31, 0x32, 0x70, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x3a, 0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e,
+    0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
+    0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x31, 0x37, 0x31, 0x61, 0x31,
+    0x63, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f,
+    0x64, 0x79, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c,
+    0x61, 0x79, 0x3a, 0x20, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d, 0x63, 0x6f,
+    0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x20, 0x31, 0x66, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x74, 0x65, 0x2d,
+    0x72, 0x6f, 0x77, 0x73, 0x3a, 0x20, 0x31, 0x66, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20, 0x63, 0x65,
+    0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6a, 0x75, 0x73, 0x74,
+    0x69, 0x66, 0x79, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65,
+    0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x23, 0x70,
+    0x61, 0x6e, 0x65, 0x6c, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x3a, 0x20, 0x31, 0x38, 0x72, 0x65, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x20,
+    0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61,
+    0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x20, 0x30, 0x20, 0x31, 0x72,
+    0x65, 0x6d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b,
+    0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x32,
+    0x39, 0x33, 0x36, 0x33, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72,
+    0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x31, 0x72, 0x65, 0x6d,
+    0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64,
+    0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 0x38, 0x70, 0x78, 0x20, 0x31, 0x36, 0x70, 0x78, 0x20, 0x72,
+    0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x34,
+    0x29, 0x2c, 0x20, 0x69, 0x6e, 0x73, 0x65, 0x74, 0x20, 0x30, 0x20, 0x32, 0x70, 0x78, 0x20, 0x34,
+    0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x31, 0x35, 0x39, 0x2c, 0x20, 0x32, 0x30, 0x32,
+    0x2c, 0x20, 0x32, 0x32, 0x33, 0x2c, 0x20, 0x30, 0x2e, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x7d, 0x20, 0x20, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x31, 0x20, 0x7b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a,
+    0x20, 0x31, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+    0x65, 0x78, 0x74, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 0x32, 0x70,
+    0x78, 0x20, 0x34, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c,
+    0x20, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74,
+    0x65, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75,
+    0x74, 0x74, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63,
+    0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23,
+    0x34, 0x43, 0x41, 0x46, 0x35, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69,
+    0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3b, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x35,
+    0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+    0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x20, 0x70, 0x6f,
+    0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72,
+    0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x37, 0x70, 0x78, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20,
+    0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a,
+    0x20, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c,
+    0x6f, 0x72, 0x3a, 0x20, 0x23, 0x34, 0x43, 0x41, 0x46, 0x35, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x72, 0x65, 0x6d, 0x20,
+    0x31, 0x72, 0x65, 0x6d, 0x20, 0x30, 0x72, 0x65, 0x6d, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74,
+    0x79, 0x70, 0x65, 0x3d, 0x74, 0x65, 0x78, 0x74, 0x5d, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74,
+    0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x5d, 0x20,
+    0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31,
+    0x30, 0x30, 0x25, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69,
+    0x6e, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x32, 0x70, 0x78, 0x20, 0x32, 0x30,
+    0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+    0x79, 0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x32,
+    0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x69, 0x7a, 0x69, 0x6e, 0x67,
+    0x3a, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x78, 0x3b, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75,
+    0x73, 0x3a, 0x20, 0x37, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x7b,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3a, 0x20,
+    0x30, 0x2e, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x2e, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x72, 0x69, 0x64, 0x2d, 0x67, 0x61, 0x70, 0x3a, 0x20,
+    0x2e, 0x32, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x2e, 0x69, 0x6e, 0x73, 0x65, 0x74, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x36, 0x36, 0x38, 0x38, 0x39, 0x39,
+    0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x73, 0x68, 0x61,
+    0x64, 0x6f, 0x77, 0x3a, 0x20, 0x2d, 0x31, 0x70, 0x78, 0x20, 0x2d, 0x31, 0x70, 0x78, 0x20, 0x30,
+    0x20, 0x23, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x20, 0x30,
+    0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a,
+    0x20, 0x31, 0x32, 0x70, 0x78, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e,
+    0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+    0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64,
+    0x20, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f,
+    0x78, 0x2d, 0x73, 0x69, 0x7a, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+    0x2d, 0x62, 0x6f, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64,
+    0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x37, 0x70, 0x78, 0x3b, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x74,
+    0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f,
+    0x64, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70,
+    0x61, 0x6e, 0x65, 0x6c, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x31, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x73, 0x65, 0x74, 0x22, 0x3e, 0x41, 0x75, 0x74,
+    0x6f, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x64, 0x69,
+    0x73, 0x70, 0x6c, 0x61, 0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x66,
+    0x6f, 0x72, 0x6d, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x67, 0x65, 0x74,
+    0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61,
+    0x62, 0x65, 0x6c, 0x3e, 0x53, 0x53, 0x49, 0x44, 0x20, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62,
+    0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73,
+    0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x73, 0x69, 0x64, 0x22, 0x20,
+    0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x73, 0x69, 0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x7b, 0x6e, 0x65, 0x74, 0x77, 0x6f,
+    0x72, 0x6b, 0x73, 0x7d, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x50, 0x61, 0x73, 0x73, 0x77,
+    0x6f, 0x72, 0x64, 0x20, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+    0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63,
+    0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x45, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x50,
+    0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70,
+    0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+    0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75,
+    0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69,
+    0x74, 0x22, 0x3e, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74,
+    0x6f, 0x6e, 0x3e, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72,
+    0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x73,
+    0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74,
+    0x6d, 0x6c, 0x3e, 0x0a,
+};
+
+const WebAsset webAssets[] =
+{
+    { "/", "text/html", asset_index_html, 1472, "\"6dd6b1489f9c062c\"", true },
+    { "/mirror", "text/html", asset_mirror_html, 1234, "\"7b2090794686521a\"", true },
+    { "/query", "text/html", asset_query_tmpl_html, 2372, "\"5cfaacb8e50c4465\"", false },
+};
+const int nbrWebAssets = sizeof(webAssets) / sizeof(webAssets[0]);
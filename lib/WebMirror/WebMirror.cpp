@@ -0,0 +1,265 @@
+/**
+ * Class        Implementation of the class methods of WebMirror
+ *
+ * Purpose      Damage is found by comparing tile hashes of a band copied
+ *              from the frame buffer, so the panels need not report what
+ *              they draw and the display is never read back.
+ *
+ * Remarks      scan() runs on the render task, the WebSocket events on
+ *              the async TCP task. They share the resend counter and the
+ *              acknowledge, which are atomic. The bands are read at
+ *              different frames, fast animations appear torn until the
+ *              next pass.
+ */
+#include "WebMirror.h"
+
+const int32_t MIRROR_BURST = 2 * MIRROR_MSG_SIZE;   // max tokens saved up
+
+
+void WebMirror::begin(AsyncWebServer &server)
+{
+    _ws.onEvent([this](AsyncWebSocket *ws, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
+                { onEvent(client, type, data, len); });
+    server.addHandler(&_ws);
+    _msLastBand = millis();
+    log_i("==> done");
+}
+
+
+/**
+ * Frame hook: read, compare and send the next band if
+ * the bandwidth cap and the clients allow it
+ */
+void WebMirror::scan()
+{
+    if (_ws.count() == 0) return;
+    uint32_t ms = millis();
+    if (ms - _msLastBand < _msBand) return;
+    _tokens = min<int32_t>(MIRROR_BURST, _tokens + (int32_t)((uint64_t)_rate * (ms - _msLastBand) / 1000));
+    _msLastBand = ms;
+    if (_tokens <= 0)              { _throttled++;  return; }
+    if (!_ws.availableForWriteAll()) { _backlogged++; return; }
+
+    if (_fb.width() != _w || _fb.height() != _h) resize(_fb.width(), _fb.height());
+    if (_bandY == 0)
+    {
+        _msFrameStart = ms;
+        _frameBytes = 0;
+    }
+    int lines = min(MIRROR_TILE, _h - _bandY);
+    _fb.readRect(0, _bandY, _w, lines, _band);
+
+    bool all = _resendBands > 0;
+    if (all) _resendBands--;
+    _len = 6;
+    _nTiles = 0;
+    uint32_t *hash = &_hash[(_bandY / MIRROR_TILE) * _cols];
+    for (int c = 0; c < _cols; c++)
+    {
+        int x = c * MIRROR_TILE;
+        int w = min(MIRROR_TILE, _w - x);
+        for (int r = 0; r < lines; r++) memcpy(&_tile[r * w], &_band[r * _w + x], w * sizeof(uint16_t));
+        uint32_t h = tileHash(w * lines);
+        if (!all && h == hash[c]) continue;
+        hash[c] = h;
+        if (_len + MIRROR_TILE_BYTES > MIRROR_MSG_SIZE) sendTiles();
+        encodeTile(x, _bandY, w, lines);
+    }
+    if (_nTiles > 0) sendTiles();
+
+    _bandY += lines;
+    if (_bandY >= _h)
+    {
+        _bandY = 0;
+        endFrame(ms);
+    }
+}
+
+
+void WebMirror::setMaxRate(uint32_t bytesPerSecond)
+{
+    _rate = bytesPerSecond;
+}
+
+
+/**
+ * Announce the size of the screen and send all tiles again
+ */
+void WebMirror::resize(int w, int h)
+{
+    _w = min(w, MIRROR_MAX_SIZE);
+    _h = min(h, MIRROR_MAX_SIZE);
+    _cols = (_w + MIRROR_TILE - 1) / MIRROR_TILE;
+    _bandY = 0;
+    _resendBands = (_h + MIRROR_TILE - 1) / MIRROR_TILE;
+    uint8_t msg[6] = { 0, 0, (uint8_t)_w, (uint8_t)(_w >> 8), (uint8_t)_h, (uint8_t)(_h >> 8) };
+    _ws.binaryAll(msg, sizeof(msg));
+}
+
+
+// FNV-1a over two pixels at a time
+uint32_t WebMirror::tileHash(int n)
+{
+    const uint32_t *p = reinterpret_cast<const uint32_t *>(_tile);
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < n / 2; i++) h = (h ^ p[i]) * 16777619u;
+    if (n & 1) h = (h ^ _tile[n - 1]) * 16777619u;
+    return h;
+}
+
+
+/**
+ * Append the tile to the message, runs of 3 and more pixels
+ * as 0x8000|n color, everything else as n literal colors
+ */
+void WebMirror::encodeTile(int x, int y, int w, int h)
+{
+    uint8_t *head = &_msg[_len];
+    uint16_t *out = reinterpret_cast<uint16_t *>(head + 8);
+    int used = 0;
+    int n = w * h;
+    int i = 0;
+    while (i < n)
+    {
+        int run = 1;
+        while (i + run < n && _tile[i + run] == _tile[i]) run++;
+        if (run >= 3)
+        {
+            out[used++] = 0x8000 | run;
+            out[used++] = _tile[i];
+            i += run;
+            continue;
+        }
+        int k = 0;
+        while (i + k < n && !(i + k + 2 < n && _tile[i+k] == _tile[i+k+1] && _tile[i+k] == _tile[i+k+2])) k++;
+        out[used++] = k;
+        memcpy(&out[used], &_tile[i], k * sizeof(uint16_t));
+        used += k;
+        i += k;
+    }
+    head[0] = x;  head[1] = x >> 8;
+    head[2] = y;  head[3] = y >> 8;
+    head[4] = w;  head[5] = h;
+    head[6] = used;  head[7] = used >> 8;
+    _len += 8 + 2 * used;
+    _nTiles++;
+}
+
+
+void WebMirror::sendTiles()
+{
+    _msg[0] = 1;
+    _msg[1] = 0;
+    _msg[2] = _frame;   _msg[3] = _frame >> 8;
+    _msg[4] = _nTiles;  _msg[5] = _nTiles >> 8;
+    _ws.binaryAll(_msg, _len);
+    _tokens -= _len;
+    _frameBytes += _len;
+    _bytes += _len;
+    _tiles += _nTiles;
+    _len = 6;
+    _nTiles = 0;
+}
+
+
+/**
+ * A pass over the screen is complete. If anything was sent, tell the
+ * browser, which answers with an acknowledge for the round trip time.
+ */
+void WebMirror::endFrame(uint32_t ms)
+{
+    _msScanLast = ms - _msFrameStart;
+    if (_frameBytes == 0) return;
+
+    uint32_t rtt = _msRttLast;
+    uint8_t msg[12] = { 2, 0, (uint8_t)_frame, (uint8_t)(_frame >> 8),
+                        (uint8_t)_frameBytes, (uint8_t)(_frameBytes >> 8), (uint8_t)(_frameBytes >> 16), (uint8_t)(_frameBytes >> 24),
+                        (uint8_t)_msScanLast, (uint8_t)(_msScanLast >> 8), (uint8_t)rtt, (uint8_t)(rtt >> 8) };
+    _msEndSent = millis();
+    _ws.binaryAll(msg, sizeof(msg));
+    _frameBytesLast = _frameBytes;
+    if (_frameBytes > _frameBytesMax) _frameBytesMax = _frameBytes;
+    _frames++;
+    _frame++;
+}
+
+
+// Runs on the async TCP task
+void WebMirror::onEvent(AsyncWebSocketClient *client, AwsEventType type, uint8_t *data, size_t len)
+{
+    switch (type)
+    {
+        case WS_EVT_CONNECT:
+        {
+            _ws.cleanupClients(MIRROR_MAX_CLIENTS);
+            int w = min(_fb.width(), MIRROR_MAX_SIZE);
+            int h = min(_fb.height(), MIRROR_MAX_SIZE);
+            uint8_t msg[6] = { 0, 0, (uint8_t)w, (uint8_t)(w >> 8), (uint8_t)h, (uint8_t)(h >> 8) };
+            client->binary(msg, sizeof(msg));
+            _resendBands = (h + MIRROR_TILE - 1) / MIRROR_TILE;
+            log_i("Mirror client %u connected, %d clients", client->id(), clients());
+        }
+        break;
+
+        case WS_EVT_DISCONNECT:
+            log_i("Mirror client %u disconnected", client->id());
+        break;
+
+        case WS_EVT_DATA:
+            if (len == 4 && data[0] == 3)
+            {
+                uint16_t frame = data[2] | data[3] << 8;
+                if (frame == (uint16_t)(_frame - 1) && frame != _frameAcked)
+                {
+                    _frameAcked = frame;
+                    uint32_t rtt = millis() - _msEndSent;
+                    _msRttLast = rtt;
+                    if (rtt > _msRttMax) _msRttMax = rtt;
+                }
+            }
+        break;
+
+        default:
+        break;
+    }
+}
+
+
+int WebMirror::clients()
+{
+    return _ws.count();
+}
+
+
+uint32_t WebMirror::frameBytesLast()
+{
+    return _frameBytesLast;
+}
+
+
+uint32_t WebMirror::msRttLast()
+{
+    return _msRttLast;
+}
+
+
+void WebMirror::printStats()
+{
+    if (_ws.count() == 0 && _frames == 0) return;
+    log_i("Mirror: %d clients, %u frames, %u tiles, %u bytes, frame last %u bytes, max %u bytes, "
+          "scan %u ms, rtt %u ms (max %u ms), skipped %u (cap) %u (queue)",
+          clients(), _frames, _tiles, _bytes, _frameBytesLast, _frameBytesMax,
+          _msScanLast, (uint32_t)_msRttLast, _msRttMax, _throttled, _backlogged);
+}
+
+
+void WebMirror::resetStats()
+{
+    _frames = 0;
+    _tiles = 0;
+    _bytes = 0;
+    _frameBytesMax = 0;
+    _msRttMax = 0;
+    _throttled = 0;
+    _backlogged = 0;
+}
@@ -0,0 +1,116 @@
+/**
+ * Header       WebMirror.h
+ *
+ * Purpose      Declaration of the class WebMirror, a live copy of the
+ *              screen in the browser for remote support.
+ *              - A frame hook on the render task copies one band of
+ *                MIRROR_TILE lines per call from the frame buffer, which
+ *                all panels draw into, and hashes each tile of
+ *                MIRROR_TILE x MIRROR_TILE pixels. Only tiles whose hash
+ *                changed are sent, no drawing code has to report damage.
+ *              - A changed tile is compressed into runs and literals of
+ *                RGB565 words, like UiBackingStore does. A flat tile needs
+ *                4 bytes.
+ *              - The tiles of a band go out as one binary WebSocket
+ *                message. The page web/mirror.html, served at /mirror,
+ *                composes them into an image buffer and draws the
+ *                changed tiles on a canvas.
+ *              - A token bucket caps the bandwidth, a band is skipped
+ *                while the bucket is empty or a client still has
+ *                messages queued. Skipped changes are found again by the
+ *                next pass, so nothing is lost, it only gets coarser.
+ *              Bytes per frame, the scan time of a pass and the round trip
+ *              of the acknowledge of the browser are logged and shown on
+ *              the page.
+ *
+ * Usage        WebMirror mirror(frameBuffer);
+ *              mirror.begin(server);           // ws://<host>/mirror/ws
+ *              renderer.addFrameHook([](LGFX &lcd, int x, int y, void *arg) { mirror.scan(); });
+ *
+ * Remarks      Messages, all numbers little endian
+ *              0 size       u8 type, u8 0, u16 width, u16 height
+ *              1 tiles      u8 type, u8 0, u16 frame, u16 tiles, per tile:
+ *                           u16 x, u16 y, u8 w, u8 h, u16 words, words
+ *                           0x8000|n color = run, n colors = literals
+ *              2 frame end  u8 type, u8 0, u16 frame, u32 bytes, u16 scan ms, u16 rtt ms
+ *              3 ack        u8 type, u8 0, u16 frame (browser to device)
+ */
+#pragma once
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <LovyanGFX.hpp>
+#include "lgfx_esp32-2432S028.h"
+#include "UiFrameBuffer.h"
+#include <atomic>
+
+const int MIRROR_TILE        = 16;                  // tile size and lines per band
+const int MIRROR_MAX_SIZE    = 320;                 // max width and height of the screen
+const int MIRROR_MAX_TILES   = (MIRROR_MAX_SIZE / MIRROR_TILE) * (MIRROR_MAX_SIZE / MIRROR_TILE);
+const int MIRROR_MSG_SIZE    = 4096;                // bytes per WebSocket message
+const int MIRROR_TILE_BYTES  = 8 + 4 * MIRROR_TILE * MIRROR_TILE;  // worst case of an encoded tile
+const int MIRROR_MAX_CLIENTS = 2;
+
+class WebMirror
+{
+    public:
+        WebMirror(UiFrameBuffer &fb, uint32_t maxBytesPerSecond=32768, uint32_t msBand=25) :
+            _fb(fb), _rate(maxBytesPerSecond), _msBand(msBand)
+        {}
+
+        void begin(AsyncWebServer &server);
+        void scan();
+        void setMaxRate(uint32_t bytesPerSecond);
+
+        int      clients();
+        uint32_t frameBytesLast();
+        uint32_t msRttLast();
+        void     printStats();
+        void     resetStats();
+
+    private:
+        void onEvent(AsyncWebSocketClient *client, AwsEventType type, uint8_t *data, size_t len);
+        void resize(int w, int h);
+        uint32_t tileHash(int n);
+        void encodeTile(int x, int y, int w, int h);
+        void sendTiles();
+        void endFrame(uint32_t ms);
+
+        UiFrameBuffer &_fb;             // the pixels are read in scan() on the render task
+        AsyncWebSocket _ws{"/mirror/ws"};
+        uint32_t _rate;                 // bytes per second
+        uint32_t _msBand;               // min time between two bands
+        int32_t  _tokens = 0;
+        uint32_t _msLastBand = 0;
+
+        int      _w = 0, _h = 0;
+        int      _cols = 0;
+        int      _bandY = 0;            // first line of the next band
+        std::atomic<int> _resendBands{0};   // bands sent in full, after a client connected
+        uint32_t _hash[MIRROR_MAX_TILES];
+
+        alignas(4) uint16_t _band[MIRROR_TILE * MIRROR_MAX_SIZE];
+        alignas(4) uint16_t _tile[MIRROR_TILE * MIRROR_TILE];
+        alignas(4) uint8_t  _msg[MIRROR_MSG_SIZE];
+        int      _len = 0;
+        int      _nTiles = 0;
+
+        // the current pass over the screen
+        uint16_t _frame = 0;
+        uint32_t _msFrameStart = 0;
+        uint32_t _frameBytes = 0;
+
+        // acknowledge of the last frame end
+        std::atomic<uint16_t> _frameAcked{0xFFFF};
+        std::atomic<uint32_t> _msEndSent{0};
+        std::atomic<uint32_t> _msRttLast{0};
+
+        uint32_t _frames = 0;           // passes with changes
+        uint32_t _frameBytesLast = 0;
+        uint32_t _frameBytesMax = 0;
+        uint32_t _msScanLast = 0;
+        uint32_t _msRttMax = 0;
+        uint32_t _bytes = 0;
+        uint32_t _tiles = 0;
+        uint32_t _throttled = 0;        // bands skipped for the bandwidth cap
+        uint32_t _backlogged = 0;       // bands skipped for a full client queue
+};
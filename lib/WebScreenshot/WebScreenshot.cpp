@@ -0,0 +1,166 @@
+/**
+ * Class        Implementation of the class methods of WebScreenshot
+ *
+ * Purpose      Stream the screen band by band. The filler never blocks
+ *              the async TCP task, it returns RESPONSE_TRY_AGAIN while
+ *              the render task reads the next band.
+ *
+ * Remarks      PNG is streamed top-down, BMP bottom-up as the file
+ *              format requires. The bands are read at different frames,
+ *              a screen that changes meanwhile may show a seam.
+ */
+#include "WebScreenshot.h"
+
+
+void WebScreenshot::begin(AsyncWebServer &server, const char *path)
+{
+    server.on(path, HTTP_GET, [this](AsyncWebServerRequest *request) { handle(request); });
+    log_i("==> done");
+}
+
+
+void WebScreenshot::handle(AsyncWebServerRequest *request)
+{
+    // a band still being read belongs to an aborted transfer
+    if (_bandPending || _busy.exchange(true))
+    {
+        request->send(503, "text/plain", "Screenshot in progress");
+        return;
+    }
+    // the callbacks of an earlier request may still come, e.g. its disconnect
+    uint32_t transfer = ++_transfer;
+    _png = !(request->hasParam("format") && request->getParam("format")->value() == "bmp");
+    _w = min(_fb.width(), WEB_MAX_WIDTH);
+    _h = _fb.height();
+    _y = _png ? 0 : _h;
+    _done = false;
+    _bandReady = false;
+    _head = _tail = 0;
+    _bytes = 0;
+    _msStart = millis();
+
+    bool ok = true;
+    if (_png) ok = _encoder.begin(_w, _h);
+    else _tail = bmpHeader(_out, _w, _h, 24);    // the output buffer is empty
+    if (!ok)
+    {
+        _busy = false;
+        request->send(500, "text/plain", "No memory");
+        return;
+    }
+
+    AsyncWebServerResponse *response = request->beginChunkedResponse(_png ? "image/png" : "image/bmp",
+        [this, transfer](uint8_t *buf, size_t maxLen, size_t index) -> size_t 
+        { return transfer == _transfer ? fill(buf, maxLen) : 0; });
+    response->addHeader("Cache-Control", "no-store");
+    request->onDisconnect([this, transfer]() { if (transfer == _transfer) finish(false); });
+    request->send(response);
+}
+
+
+/**
+ * Hand out the encoded data, encode the band when it has been
+ * read or ask the render task for the next band
+ */
+size_t WebScreenshot::fill(uint8_t *buf, size_t maxLen)
+{
+    for (;;)
+    {
+        if (_tail > _head)
+        {
+            size_t n = min(maxLen, (size_t)(_tail - _head));
+            memcpy(buf, _out + _head, n);
+            _head += n;
+            _bytes += n;
+            return n;
+        }
+        _head = _tail = 0;
+        if (_done)
+        {
+            finish(true);
+            return 0;
+        }
+        if (_bandReady)
+        {
+            _bandReady = false;
+            if (!encodeBand())
+            {
+                log_e("Band does not fit into the output buffer");
+                finish(false);
+                return 0;
+            }
+            continue;
+        }
+        if (!_bandPending)
+        {
+            _lines = _png ? min(WEB_BAND_LINES, _h - _y) : min(WEB_BAND_LINES, _y);
+            int y0 = _png ? _y : _y - _lines;
+            _bandPending = true;
+            if (!_renderer.call(readBand, 0, y0, this)) _bandPending = false;    // queue full, try again
+        }
+        return RESPONSE_TRY_AGAIN;
+    }
+}
+
+
+// Runs on the render task
+void WebScreenshot::readBand(LGFX &lcd, int x, int y, void *arg)
+{
+    WebScreenshot *self = static_cast<WebScreenshot *>(arg);
+    self->_fb.readRect(0, y, self->_w, self->_lines, self->_band);
+    self->_bandReady = true;
+    self->_bandPending = false;
+}
+
+
+bool WebScreenshot::encodeBand()
+{
+    bool ok = true;
+    if (_png)
+    {
+        for (int r = 0; r < _lines && ok; r++) ok = _encoder.addRow(_band + r * _w);
+        _y += _lines;
+        if (_y >= _h)
+        {
+            ok = _encoder.end() && ok;
+            _done = true;
+        }
+    }
+    else
+    {
+        int rowSize = bmpRowSize(_w, 24);
+        memset(_row + 3 * _w, 0, rowSize - 3 * _w);
+        for (int r = _lines - 1; r >= 0 && ok; r--)
+        {
+            rgb565ToBgr888(_band + r * _w, _row, _w);
+            ok = sink(_row, rowSize, this);
+        }
+        _y -= _lines;
+        _done = _y <= 0;
+    }
+    return ok;
+}
+
+
+bool WebScreenshot::sink(const uint8_t *data, int len, void *arg)
+{
+    WebScreenshot *self = static_cast<WebScreenshot *>(arg);
+    if (self->_tail + len > WEB_OUT_SIZE) return false;
+    memcpy(self->_out + self->_tail, data, len);
+    self->_tail += len;
+    return true;
+}
+
+
+/**
+ * Called when the last byte is handed out and again on disconnect
+ */
+void WebScreenshot::finish(bool completed)
+{
+    if (!_busy) return;
+    if (_png && !_done) _encoder.end();     // frees the row buffers
+    uint32_t ms = millis() - _msStart;
+    log_i("Screenshot %s %s: %u bytes in %u ms, %u bytes buffers", _png ? "PNG" : "BMP",
+          completed ? "sent" : "aborted", _bytes, ms, sizeof(_band) + sizeof(_row) + sizeof(_out));
+    _busy = false;
+}
@@ -0,0 +1,72 @@
+/**
+ * Header       WebScreenshot.h
+ *
+ * Purpose      Declaration of the class WebScreenshot, an HTTP endpoint that
+ *              streams the screen as PNG or 24 bit BMP in a chunked response.
+ *              Nothing is written to the SD card.
+ *              - The response filler runs on the async TCP task. When it
+ *                needs pixels, it asks the render task, the owner of the
+ *                frame buffer, to copy the next band of WEB_BAND_LINES 
+ *                lines and returns "try again" instead of waiting. The 
+ *                display is not read back.
+ *              - The band is encoded into an output buffer, which is
+ *                drained into the TCP send buffer before the next band is
+ *                read. The memory needed depends on the width of the
+ *                screen only.
+ *              One screenshot is streamed at a time, a second request gets
+ *              503. Size and time of each transfer are logged.
+ *
+ * Usage        WebScreenshot webScreenshot(frameBuffer, renderer);
+ *              webScreenshot.begin(server);    // GET /screenshot?format=png|bmp
+ *              server.begin();
+ */
+#pragma once
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <atomic>
+#include "Renderer.h"
+#include "UiFrameBuffer.h"
+#include "ImageCodec.h"
+
+const int WEB_BAND_LINES = 4;       // lines copied from the frame buffer at once
+const int WEB_MAX_WIDTH  = 320;
+const int WEB_OUT_SIZE   = 8192;    // encoded data of one band, worst case of PNG
+
+class WebScreenshot
+{
+    public:
+        WebScreenshot(UiFrameBuffer &fb, Renderer &renderer) : _fb(fb), _renderer(renderer)
+        {}
+
+        void begin(AsyncWebServer &server, const char *path="/screenshot");
+
+    private:
+        void   handle(AsyncWebServerRequest *request);
+        size_t fill(uint8_t *buf, size_t maxLen);
+        bool   encodeBand();
+        void   finish(bool completed);
+        static void readBand(LGFX &lcd, int x, int y, void *arg);
+        static bool sink(const uint8_t *data, int len, void *arg);
+
+        UiFrameBuffer &_fb;         // for the size only, the pixels are read on the render task
+        Renderer      &_renderer;
+
+        std::atomic<bool> _busy{false};         // a response is streaming
+        std::atomic<uint32_t> _transfer{0};     // number of the streaming response
+        std::atomic<bool> _bandPending{false};  // the render task is reading a band
+        std::atomic<bool> _bandReady{false};
+        bool     _png = true;
+        bool     _done = false;
+        int      _w = 0, _h = 0;
+        int      _y = 0;                        // first line of the next band
+        int      _lines = 0;                    // lines in the band
+
+        alignas(4) uint16_t _band[WEB_BAND_LINES * WEB_MAX_WIDTH];
+        alignas(4) uint8_t  _row[3 * WEB_MAX_WIDTH + 4];
+        uint8_t  _out[WEB_OUT_SIZE];
+        int      _head = 0, _tail = 0;          // unsent data in _out
+        PngEncoder _encoder{sink, this};
+
+        uint32_t _msStart = 0;
+        uint32_t _bytes = 0;
+};
@@ -0,0 +1,261 @@
+/**
+ * Class        Implementation of the class methods of XmlReader
+ *
+ * Purpose      A state machine that takes one character after the other,
+ *              so a tag, an entity or a CDATA section may be split
+ *              anywhere between two calls of feed().
+ *
+ * Remarks      The text of an element is reported when the next tag
+ *              begins, with the whitespace around it removed. Text between
+ *              two end tags, mixed content, is reported without a name.
+ */
+#include "XmlReader.h"
+
+static const char CDATA[] = "[CDATA[";
+
+
+void XmlReader::begin(XmlFn fn, void *arg)
+{
+    _fn = fn;
+    _arg = arg;
+    reset();
+}
+
+
+// Start a new document
+void XmlReader::reset()
+{
+    _state = State::Text;
+    _nameLen = 0;
+    _element[0] = '\0';
+    _textLen = 0;
+    _entityLen = -1;
+    _run = 0;
+}
+
+
+void XmlReader::feed(const char *data, int len)
+{
+    _bytes += len;
+    for (int i = 0; i < len; i++)
+    {
+        char c = data[i];
+        bool space = c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        switch (_state)
+        {
+            case State::Text:
+                if (c == '<') _state = State::Open;
+                else putText(c);
+            break;
+
+            case State::Open:
+                _nameLen = 0;
+                if (c == '/')      { flushText(); _state = State::EndName; }
+                else if (c == '!') _state = State::Markup;
+                else if (c == '?') _state = State::Skip;
+                else
+                {
+                    flushText();
+                    put(_name, _nameLen, XML_NAME_LEN, c);
+                    _state = State::StartName;
+                }
+            break;
+
+            case State::Markup:         // <!-- or <![CDATA[ or <!DOCTYPE
+                put(_name, _nameLen, XML_NAME_LEN, c);
+                if (_nameLen == 2 && _name[0] == '-' && _name[1] == '-') { _state = State::Comment; _run = 0; }
+                else if (_nameLen == 7 && strncmp(_name, CDATA, 7) == 0)  { _state = State::CData; _run = 0; }
+                else if (strncmp(_name, "--", min(_nameLen, 2)) != 0 && strncmp(_name, CDATA, _nameLen) != 0) _state = State::Skip;
+            break;
+
+            case State::Comment:
+                if (c == '-') _run++;
+                else if (c == '>' && _run >= 2) _state = State::Text;
+                else _run = 0;
+            break;
+
+            case State::CData:
+                if (c == ']' && _run < 2) _run++;
+                else if (c == '>' && _run == 2) { _state = State::Text; _run = 0; }
+                else if (c == ']') put(_text, _textLen, XML_TEXT_LEN, c);
+                else
+                {
+                    for (; _run > 0; _run--) put(_text, _textLen, XML_TEXT_LEN, ']');
+                    put(_text, _textLen, XML_TEXT_LEN, c);
+                }
+            break;
+
+            case State::Skip:
+                if (c == '>') _state = State::Text;
+            break;
+
+            case State::StartName:
+                if (space)         { startElement(); _state = State::Tag; }
+                else if (c == '/') { startElement(); _state = State::EmptyEnd; }
+                else if (c == '>') { startElement(); _state = State::Text; }
+                else put(_name, _nameLen, XML_NAME_LEN, c);
+            break;
+
+            case State::Tag:
+                if (c == '/') _state = State::EmptyEnd;
+                else if (c == '>') _state = State::Text;
+                else if (!space)
+                {
+                    _nameLen = 0;
+                    put(_name, _nameLen, XML_NAME_LEN, c);
+                    _state = State::AttrName;
+                }
+            break;
+
+            case State::AttrName:
+                if (c == '=' || space) _state = State::AttrEq;
+                else if (c == '/') _state = State::EmptyEnd;
+                else if (c == '>') _state = State::Text;
+                else put(_name, _nameLen, XML_NAME_LEN, c);
+            break;
+
+            case State::AttrEq:
+                if (c == '"' || c == '\'')
+                {
+                    _quote = c;
+                    _textLen = 0;
+                    _entityLen = -1;
+                    _state = State::AttrValue;
+                }
+                else if (c == '>') _state = State::Text;
+            break;
+
+            case State::AttrValue:
+                if (c != _quote)
+                {
+                    putText(c);
+                    break;
+                }
+                _name[_nameLen] = '\0';
+                _text[_textLen] = '\0';
+                _fn(XmlEvent::Attribute, _name, _text, _arg);
+                _textLen = 0;
+                _state = State::Tag;
+            break;
+
+            case State::EmptyEnd:
+                if (c != '>') break;
+                _fn(XmlEvent::End, _element, "", _arg);
+                _element[0] = '\0';
+                _state = State::Text;
+            break;
+
+            case State::EndName:
+                if (c == '>')
+                {
+                    _name[_nameLen] = '\0';
+                    _fn(XmlEvent::End, _name, "", _arg);
+                    _element[0] = '\0';
+                    _state = State::Text;
+                }
+                else if (!space) put(_name, _nameLen, XML_NAME_LEN, c);
+            break;
+        }
+    }
+}
+
+
+// Append c if there is room, the last byte is kept for the '\0'
+void XmlReader::put(char *buf, int &len, int size, char c)
+{
+    if (len < size - 1) buf[len++] = c;
+}
+
+
+void XmlReader::putText(char c)
+{
+    if (_entityLen >= 0) entity(c);
+    else if (c == '&') _entityLen = 0;
+    else put(_text, _textLen, XML_TEXT_LEN, c);
+}
+
+
+/**
+ * Collect the name of an entity up to the ';' and append its
+ * character, UTF-8 encoded. Anything else is kept as it is.
+ */
+void XmlReader::entity(char c)
+{
+    if (c != ';')
+    {
+        if (_entityLen < (int)sizeof(_entity) - 1)
+        {
+            _entity[_entityLen++] = c;
+            return;
+        }
+        put(_text, _textLen, XML_TEXT_LEN, '&');
+        for (int i = 0; i < _entityLen; i++) put(_text, _textLen, XML_TEXT_LEN, _entity[i]);
+        put(_text, _textLen, XML_TEXT_LEN, c);
+        _entityLen = -1;
+        return;
+    }
+    _entity[_entityLen] = '\0';
+    _entityLen = -1;
+    uint32_t cp = 0;
+    if (strcmp(_entity, "amp") == 0)       cp = '&';
+    else if (strcmp(_entity, "lt") == 0)   cp = '<';
+    else if (strcmp(_entity, "gt") == 0)   cp = '>';
+    else if (strcmp(_entity, "quot") == 0) cp = '"';
+    else if (strcmp(_entity, "apos") == 0) cp = '\'';
+    else if (_entity[0] == '#') cp = _entity[1] == 'x' ? strtoul(_entity + 2, nullptr, 16) : strtoul(_entity + 1, nullptr, 10);
+    if (cp == 0 || cp > 0x10FFFF)
+    {
+        put(_text, _textLen, XML_TEXT_LEN, '&');
+        for (const char *p = _entity; *p; p++) put(_text, _textLen, XML_TEXT_LEN, *p);
+        put(_text, _textLen, XML_TEXT_LEN, ';');
+        return;
+    }
+    char utf8[4];
+    int n;
+    if (cp < 0x80)         { utf8[0] = cp; n = 1; }
+    else if (cp < 0x800)   { utf8[0] = 0xC0 | cp >> 6;  utf8[1] = 0x80 | (cp & 0x3F); n = 2; }
+    else if (cp < 0x10000) { utf8[0] = 0xE0 | cp >> 12; utf8[1] = 0x80 | (cp >> 6 & 0x3F); utf8[2] = 0x80 | (cp & 0x3F); n = 3; }
+    else                   { utf8[0] = 0xF0 | cp >> 18; utf8[1] = 0x80 | (cp >> 12 & 0x3F); utf8[2] = 0x80 | (cp >> 6 & 0x3F); utf8[3] = 0x80 | (cp & 0x3F); n = 4; }
+    if (_textLen + n < XML_TEXT_LEN) for (int i = 0; i < n; i++) _text[_textLen++] = utf8[i];
+}
+
+
+/**
+ * Report the text collected since the last tag,
+ * whitespace only is no text
+ */
+void XmlReader::flushText()
+{
+    if (_entityLen >= 0)                    // an unterminated '&' is kept
+    {
+        put(_text, _textLen, XML_TEXT_LEN, '&');
+        for (int i = 0; i < _entityLen; i++) put(_text, _textLen, XML_TEXT_LEN, _entity[i]);
+        _entityLen = -1;
+    }
+    int start = 0;
+    while (start < _textLen && isspace((uint8_t)_text[start])) start++;
+    while (_textLen > start && isspace((uint8_t)_text[_textLen - 1])) _textLen--;
+    _text[_textLen] = '\0';
+    if (_textLen > start) _fn(XmlEvent::Text, _element, _text + start, _arg);
+    _textLen = 0;
+}
+
+
+void XmlReader::startElement()
+{
+    _name[_nameLen] = '\0';
+    strlcpy(_element, _name, sizeof(_element));
+    _elements++;
+    _fn(XmlEvent::Start, _element, "", _arg);
+}
+
+
+uint32_t XmlReader::bytes()
+{
+    return _bytes;
+}
+
+uint32_t XmlReader::elements()
+{
+    return _elements;
+}
@@ -0,0 +1,76 @@
+/**
+ * Header       XmlReader.h
+ *
+ * Purpose      Declaration of the class XmlReader, a streaming XML parser.
+ *              The document is fed in pieces of any size, as they come
+ *              from the network, and reported element by element to a
+ *              callback. Nothing is kept but the current name and text,
+ *              a feed of a megabyte needs no more RAM than one of a
+ *              kilobyte.
+ *              - Start and end of elements, attributes and text are
+ *                reported. The text of an element comes as one piece,
+ *                cut at XML_TEXT_LEN - 1 bytes.
+ *              - The entities &amp; &lt; &gt; &quot; &apos; and &#nn;
+ *                are replaced, the text stays UTF-8.
+ *              - CDATA is text, comments, declarations and processing
+ *                instructions are skipped.
+ *              It is no validating parser: malformed documents give
+ *              strange events, but never an overflow.
+ *
+ * Usage        XmlReader xml;
+ *              xml.begin([](XmlEvent event, const char *name, const char *value, void *arg) { ... }, this);
+ *              while (n = client.read(buf, sizeof(buf))) xml.feed(buf, n);
+ */
+#pragma once
+#include <Arduino.h>
+
+const int XML_NAME_LEN = 32;        // element and attribute names, with namespace prefix
+const int XML_TEXT_LEN = 320;       // text and attribute values, long enough for a URL
+
+enum class XmlEvent : uint8_t
+{
+    Start,          // name = element
+    Attribute,      // name = attribute, value = its value
+    Text,           // name = element, value = its text
+    End             // name = element, also for <empty/>
+};
+
+using XmlFn = void(*)(XmlEvent event, const char *name, const char *value, void *arg);
+
+class XmlReader
+{
+    public:
+        void begin(XmlFn fn, void *arg);
+        void feed(const char *data, int len);
+        void reset();
+        uint32_t bytes();
+        uint32_t elements();
+
+    private:
+        enum class State : uint8_t
+        {
+            Text, Open, Markup, Comment, CData, Skip,
+            StartName, EndName, Tag, AttrName, AttrEq, AttrValue, EmptyEnd
+        };
+
+        void put(char *buf, int &len, int size, char c);
+        void putText(char c);
+        void entity(char c);
+        void flushText();
+        void startElement();
+
+        XmlFn  _fn = nullptr;
+        void  *_arg = nullptr;
+        State  _state = State::Text;
+        char   _name[XML_NAME_LEN];         // element, at the end of a start tag the attribute
+        int    _nameLen = 0;
+        char   _element[XML_NAME_LEN];      // the element the text belongs to
+        char   _text[XML_TEXT_LEN];
+        int    _textLen = 0;
+        char   _entity[8];
+        int    _entityLen = -1;             // -1 = no entity
+        char   _quote = 0;
+        int    _run = 0;                    // matched characters of --> ]]> or <![CDATA[
+        uint32_t _bytes = 0;
+        uint32_t _elements = 0;
+};
@@ -14,14 +14,17 @@
  * In order to be able to use the touchpad in addition to the display and the SD card, 
  * a software SPI must be implemented for this.
 */
-void initSDCard(SPIClass &spi)
+bool initSDCard(SPIClass &spi)
 {
   // Use custom SPI class
   spi.begin(TF_SCLK, TF_MISO, TF_MOSI, TF_CS);
   if (!SD.begin(TF_CS, spi)) // 👉 Use default frequency of 4MHz
+  {
       log_e("==> SD.begin failed!");
-  else
-      log_e("==> done");
+      return false;
+  }
+  log_e("==> done");
+  return true;
 
 /*     // Use default VSPI with pins 5, 18, 19, 23 (CS, SCLK, MISO, MOSI)
     if (!SD.begin()) // 👉 Use default frequency of 4MHz
@@ -29,17 +29,20 @@
  *              stereo headphones or 2 Max98357 for speakers.
  * 
  *              To display metadata with correct german "Umlaute" we must
- *              supply a font with a coding range from 32 to 255. For this 
- *              purpose, we can convert the ttf font Calibri or any other  
- *              with the fontconvert tool and include the resulting header file.
+ *              supply a font with a coding range from 32 to 255. The titles
+ *              arrive as ISO-8859-1 or UTF-8 and are transcoded to Latin-1.
+ *              The compressed subset fonts are generated with
  * 
- *              fontconvert c:\windows\fonts\calibri.ttf 12 32 255 > Calibri12pt8b.h  
+ *              python tools/fontsubset.py --ttf c:\windows\fonts\calibri.ttf --size 12 --name Calibri12ptRle > include/Calibri12ptRle.h
+ *              python tools/fontsubset.py --gfx include/Calibri12pt8b.h --name Calibri12ptRle > include/Calibri12ptRle.h
  * 
  * Caveats      ☢️ The touchpad and SD card are wired on the circuit board in such 
- *              a way that they cannot be used simultaneously. Therefore, the 
- *              touchpad function must be interrupted in order to activate the 
- *              SD card and take a screenshot. Afterwards, the SD card is 
- *              deactivated and the touchpad is put back into operation.
+ *              a way that they share VSPI on different pins and cannot be
+ *              used simultaneously. The SpiArbiter hands the bus to one of 
+ *              them at a time, a touch sample or a block of the SD card, and
+ *              switches the pins in the GPIO matrix. Both stay initialized, 
+ *              the touchpad keeps working while files are written or read. 
+ *              The screen is grabbed into RAM first, the radio keeps playing.
  *
  *              👉 The new AudioTools library needs arduino framework 3.x which is not
  *              supported in platformio so we have to add this line in platformio.ini:
@@ -83,19 +86,41 @@
  *              https://github.com/pschatzmann/arduino-audio-tools/wiki/Volume-Control
  *              https://www.analog.com/media/en/technical-documentation/data-sheets/MAX98357A-MAX98357B.pdf
  * 
- *              How to convert ttf fonts see:
+ *              How to convert ttf fonts with fontconvert see:
  *              https://www.youtube.com/watch?v=L8MmTISmwZ8
  *              https://github.com/KrisKasprzak/FontConvert/blob/main/FontConvert.zip
  *              http://oleddisplay.squix.ch/
  */
 #include <AudioTools.h>
 #include <AudioTools/AudioCodecs/CodecMP3Helix.h>
+#include <AudioTools/AudioCodecs/CodecAACHelix.h>
 #include <SD.h>
 #include "ESP32AutoConnect.h"
 #include "UiComponents.h"
+#include "Renderer.h"
+#include "TouchInput.h"
+#include "AudioMeter.h"
+#include "UiGovernor.h"
+#include "UiText.h"
+#include "UiFrameBuffer.h"
+#include "ScreenCapture.h"
+#include "WebScreenshot.h"
+#include "WebMirror.h"
+#include "RestApi.h"
+#include "EventStream.h"
+#include "WebAssets.h"
+#include "FileManager.h"
+#include "SpiArbiter.h"
+#include "StreamRecorder.h"
+#include "Timeshift.h"
+#include "Podcast.h"
+#include "HlsStream.h"
 #include "Calibri8pt8b.h"
 #include "Calibri12pt8b.h"
+#include "Calibri8ptRle.h"
+#include "Calibri12ptRle.h"
 #include "Wait.h"
+#include <atomic>
 
 /** CYD rotation definitions. The origin is always upper left corner
 o-------------.    o---|¨|--.    o-------------.    o--------.
@@ -121,11 +146,17 @@ AsyncWebServer server(80);
 
 I2SConfig config;
 ICYStream url(1024);      // or use URLStream url(1024) but no meta data evailable
+HlsStream hls;            // the source of the stations with a .m3u8 playlist
 
 I2SStream i2s;   // final output of decoded stream, fetched to the external DAC
 VolumeStream volume(i2s);
-EncodedAudioStream dec(&volume, new MP3DecoderHelix()); // decode stream and route it to the volume control
-StreamCopy copier(dec, url);  // copies mp3-stream from url to the decoder
+AudioMeter meter(volume); // taps the decoded PCM for the level and spectrum display
+MP3DecoderHelix mp3Decoder;
+AACDecoderHelix aacDecoder;   // for HLS stations, which mostly send AAC
+EncodedAudioStream dec(&meter, &mp3Decoder); // decode stream and route it via the meter to the volume control
+StreamRecorder recorder(dec, SD); // records the mp3-stream on its way to the decoder
+Timeshift timeshift(recorder, SD); // keeps the last minutes on the SD card for pause and rewind
+StreamCopy copier(timeshift, url); // copies mp3-stream from url to the decoder
 
 using Action = void(&)(LGFX &lcd);
 using Radiostation = struct rs{ const char *name; const char *url; };
@@ -133,10 +164,48 @@ using Radiostation = struct rs{ const char *name; const char *url; };
 //                    Text       Background  Border      Shadow      Font
 UiTheme dateTimeTheme(TFT_GREEN, DARKERGREY, DARKERGREY, DARKERGREY, &fonts::FreeSans12pt7b);
 
+// Pre-rendered digits and separators for the clock and the station number
+uint16_t clockCells[4608];
+uint16_t stationCells[2816];
+UiGlyphAtlas clockGlyphs(dateTimeTheme, "0123456789:-", clockCells, sizeof(clockCells) / sizeof(uint16_t));
+UiGlyphAtlas stationGlyphs(defaultTheme, "0123456789", stationCells, sizeof(stationCells) / sizeof(uint16_t));
+
+// Glyph caches for the metadata, 12 cells of 21x24 and 20 cells of 14x17 pixels
+uint16_t composerPool[6048];
+uint16_t opusPool[4760];
+UiFontCache composerFont(Calibri12ptRle, composerPool, sizeof(composerPool) / sizeof(uint16_t));
+UiFontCache opusFont(Calibri8ptRle, opusPool, sizeof(opusPool) / sizeof(uint16_t));
+
+// Off-screen sprites of the titles (1 bit, up to 2048 pixels wide) and
+// the line both marquees expand them into
+uint8_t  composerSprite[24 * 256];
+uint8_t  opusSprite[17 * 256];
+uint16_t marqueeWindow[310];
+
+// Health of the audio path: bytes in the receive buffer of the stream,
+// below the low water the decoder may soon find no data
+const int STREAM_LOW_WATER  = 512;
+const int STREAM_HIGH_WATER = 2048;
+
 LGFX lcd;
+Renderer renderer(lcd);   // the only task that draws on lcd
+
+// Indexed back buffer of the whole screen in landscape orientation (4 bit, 
+// 38 KB instead of 150 KB) and the two bands it is expanded into. All panels
+// draw into it, the screenshots and the mirror read it.
+constexpr int SCREEN_W = 320;
+constexpr int SCREEN_H = 240;
+alignas(4) uint8_t  fbPixels[SCREEN_W * SCREEN_H / 2];
+alignas(4) uint16_t fbBands[2 * SCREEN_W * FB_BAND_LINES];
+UiFrameBuffer frameBuffer(SCREEN_W, SCREEN_H, fbPixels, fbBands);
+
+UiGovernor governor(renderer, STREAM_LOW_WATER, STREAM_HIGH_WATER); // adapts the UI to the audio health
+UiDispatcher dispatcher;  // routes touch events to the button handlers
 GFXfont myFont = fonts::DejaVu18;
 SPIClass sdcardSPI(VSPI); // uncomment this line to take screenshots
+SpiArbiter vspi(VSPI_HOST); // shares VSPI between the SD card and the touchpad
 Wait waitDateTime(1000);  // diplay date and time every second
+Wait waitRenderStats(60000); // log render statistics every minute
 Preferences prefs;        // stores current station and volume
 
 extern void nop(LGFX &lcd);
@@ -147,13 +216,19 @@ extern void initESP32AutoConnect(AsyncWebServer &webServer, Preferences &prefs,
 extern void initDisplay(LGFX &lcd, uint8_t rot, GFXfont *theFont=&myFont, Action greet=nop);
 extern void initPrefs();
 extern void printPrefs();
-extern void initSDCard(SPIClass &spi);
+extern bool initSDCard(SPIClass &spi);
 extern void printSDCardInfo();
 extern void listFiles(File dir, int indent=0);
-extern bool saveBmpToSD_16bit(LGFX &lcd, const char *filename);
-extern bool saveBmpToSD_24bit(LGFX &lcd, const char *filename);
 extern GFXfont defaultFont;
 
+TouchInput touch(lcd, getMappedTouch);  // pen interrupt driven touch events
+ScreenCapture capture(SD);              // screenshots written in the background
+WebScreenshot webScreenshot(frameBuffer, renderer); // screenshots streamed to the browser
+WebMirror mirror(frameBuffer);          // live copy of the screen in the browser
+FileManager files(SD);                  // list, download and delete the files on the SD card
+PodcastFeed feed;                       // the newest episodes of a podcast feed
+EpisodeStream episode;                  // source of the copier while an episode plays
+
 
 Radiostation radioStation[] =
 {
@@ -186,10 +261,44 @@ Radiostation radioStation[] =
   { "Capital London", "http://vis.media-ice.musicradio.com/CapitalMP3" },
   { "ORF",            "https://orf-live.ors-shoutcast.at/vbg-q1a" },
   { "Beatles Radio",  "http://www.beatlesradio.com:8000/stream/1/" },
+  { "BBC Radio 4",    "http://as-hls-ww-live.akamaized.net/pool_904/live/ww/bbc_radio_fourfm/bbc_radio_fourfm.isml/bbc_radio_fourfm-audio%3d96000.norewind.m3u8" },
 };
 constexpr int nbrRadiostations = sizeof(radioStation) / sizeof(radioStation[0]);
+
+// RSS feeds with MP3 enclosures, build with -D PODCAST_TEST_FEED=\"http://<pc>:8000/feed.xml\" 
+// to add the feed of tools/podcastserver.py
+Radiostation podcastFeed[] =
+{
+  { "Planet Money",  "https://feeds.npr.org/510289/podcast.xml" },
+  { "NPR News Now",  "https://feeds.npr.org/500005/podcast.xml" },
+#ifdef PODCAST_TEST_FEED
+  { "Test feed",     PODCAST_TEST_FEED },
+#endif
+};
+constexpr int nbrPodcasts = sizeof(podcastFeed) / sizeof(podcastFeed[0]);
+bool podcastMode   = false;  // an episode plays instead of the station
+bool podcastPaused = false;
+bool hlsMode       = false;  // the station is played from its HLS playlist
+int  currentEpisode = -1;
 int   currentStation = 5;    // preselected station
 float currentVolume  = 0.33; // initial loudness
+char  currentTitle[API_TITLE_LEN]; // last title of the meta data, Latin-1
+
+const char *stationName(int index) { return radioStation[index].name; }
+const char *podcastName(int index) { return podcastFeed[index].name; }
+RestApi api(stationName, nbrRadiostations); // JSON control, the commands are applied in loop()
+void readTelemetry(Telemetry &t);
+EventStream events(api, readTelemetry);     // status and telemetry pushed to dashboards
+
+// Requests from the UI, which runs on the render task, to the player in loop()
+std::atomic<bool> restartRequested(false);
+std::atomic<bool> volumeRequested(false);
+std::atomic<bool> screenshotRequested(false);
+std::atomic<bool> pauseRequested(false);
+std::atomic<bool> rewindRequested(false);
+std::atomic<bool> liveRequested(false);
+
+const int REWIND_SECONDS = 30;  // per touch of the rewind button
 
 // Forward declaration of functions
 void firstStation();
@@ -197,13 +306,17 @@ void lastStation();
 void nextStation();
 void prevStation();
 void showCurrent();
+void selectStation(int station);
+void setVolume(float loudness);
+void publishStatus();
+void stopPlaying();
 void cbShowMetaData(MetaDataType info, const char *str, int len);
 
 class UiPanelTitle : public UiPanel
 {
     public:
-        UiPanelTitle(LGFX &lcd, int x, int y, int w, int h, int bgColor, bool hidden=true) : 
-            UiPanel(lcd, x, y, w, h, bgColor, hidden)
+        UiPanelTitle(UiFrameBuffer &fb, UiRect r, int bgColor, bool hidden=true) : 
+            UiPanel(fb, r, bgColor, hidden)
         {
             if (! _hidden) { show(); }
         }
@@ -211,7 +324,7 @@ class UiPanelTitle : public UiPanel
         void show()
         {
             UiPanel::show();
-            _lcd.setTextDatum(textdatum_t::middle_left);
+            _fb.setTextDatum(textdatum_t::middle_left);
             panelText(60, 20, "CYD Web Radio", TFT_MAROON, fonts::DejaVu24);
         }
     private:
@@ -221,52 +334,92 @@ class UiPanelTitle : public UiPanel
 class UiPanelDateTime : public UiPanel
 {
     public:
-      UiPanelDateTime(LGFX & lcd, int x, int y, int w, int h, int bgColor, bool hidden=true) :
-        UiPanel(lcd, x, y, w, h, bgColor, hidden)
+      UiPanelDateTime(UiFrameBuffer &fb, UiRect r, int bgColor, bool hidden=true) :
+        UiPanel(fb, r, bgColor, hidden)
         {
           if (! _hidden) { show(); }
         }
 
         void updateDateTime();
+        uint32_t usRenderMax() { return _usRenderMax; }
 
         void show()
         {
             UiPanel::show();
-            for (int i = 0; i < _btns.size(); i++)
-            {
-                _btns.at(i)->draw();
-            }
+            _theTime.draw();
+            _theDate.draw();
         }
 
     private:
-        UiButton *_theTime = new UiButton(this, _x+8,  _y+2,  94, 24, dateTimeTheme, "");
-        UiButton *_theDate = new UiButton(this, _x+190, _y+2, 122, 24, dateTimeTheme, "");
-        
-        std::vector<UiButton *> _btns = { _theTime, _theDate }; 
+        UiGlyphButton _theTime {this, _x+8,  _y+2,  94, 24, dateTimeTheme, clockGlyphs, ""};
+        UiGlyphButton _theDate {this, _x+190, _y+2, 122, 24, dateTimeTheme, clockGlyphs, ""};
+        uint32_t _usRenderMax = 0; // longest time and date update so far
 };
 
 
 class UiPanelMetaData : public UiPanel
 {
     public:
-        UiPanelMetaData(LGFX &lcd, int x, int y, int w, int h, int bgColor, bool hidden=true) : 
-            UiPanel(lcd, x, y, w, h, bgColor, hidden) 
+        UiPanelMetaData(UiFrameBuffer &fb, UiRect r, int bgColor, bool hidden=true) : 
+            UiPanel(fb, r, bgColor, hidden) 
+        {
+            if (! _hidden) { show(); }
+        }
+
+        void show()
         {
-            if (! _hidden) 
-            { 
-              show(); 
-              panelText(5, 18, "Composer", TFT_MAROON, Calibri12pt8b);
-              panelText(5, 38, "Opus", TFT_MAROON, Calibri8pt8b);
+            UiPanel::show(); 
+            if (! _composer.hasText()) 
+            {
+                _composer.setText("Composer", TFT_MAROON, _bgColor);
+                _opus.setText("Opus", TFT_MAROON, _bgColor);
             }
+            _composer.invalidate();
+            _opus.invalidate();
+        }
+
+        // Called from the audio path with Latin-1 text, the drawing is done by the render task
+        void showTitle(Renderer &r, const char *composer, const char *opus)
+        {
+            r.callText(setComposer, 0, 0, composer, this);
+            r.callText(setOpus, 0, 0, opus, this);
         }
+
+        // Called from a frame hook of the renderer
+        void animate(uint32_t ms, bool paused)
+        {
+            if (_hidden) return;
+            _composer.pause(paused);
+            _opus.pause(paused);
+            _composer.update(_fb, ms);
+            _opus.update(_fb, ms);
+        }
+
+    private:
+        static void setComposer(LGFX &lcd, int x, int y, const char *text, void *arg)
+        {
+            UiPanelMetaData *p = static_cast<UiPanelMetaData *>(arg);
+            p->_composer.setText(text, TFT_MAROON, p->_bgColor);
+        }
+
+        static void setOpus(LGFX &lcd, int x, int y, const char *text, void *arg)
+        {
+            UiPanelMetaData *p = static_cast<UiPanelMetaData *>(arg);
+            p->_opus.setText(text, TFT_MAROON, p->_bgColor);
+        }
+
+        UiMarquee _composer { composerFont, _x+5, _y+18, _w-10, composerSprite, sizeof(composerSprite), 
+                              marqueeWindow, sizeof(marqueeWindow) / sizeof(uint16_t) };
+        UiMarquee _opus     { opusFont, _x+5, _y+38, _w-10, opusSprite, sizeof(opusSprite), 
+                              marqueeWindow, sizeof(marqueeWindow) / sizeof(uint16_t) };
 };
 
 
 class UiPanelRadio : public UiPanel
 {
     public:
-        UiPanelRadio(LGFX &lcd, int x, int y, int w, int h, int bgColor, bool hidden=true) : 
-            UiPanel(lcd, x, y, w, h, bgColor, hidden)
+        UiPanelRadio(UiFrameBuffer &fb, UiRect r, int bgColor, bool hidden=true) : 
+            UiPanel(fb, r, bgColor, hidden)
         {
             if (! _hidden) { show(); }
         }
@@ -274,56 +427,233 @@ class UiPanelRadio : public UiPanel
         void show()
         {
             UiPanel::show();
-            for (int i = 0; i < _btns.size(); i++)
+            for (UiButton *b : _btns) { b->draw(); }
+        }
+
+        void bindKeys(UiDispatcher &d);
+        void dragVolume(int x);
+        UiGlyphButton &station() { return _station; }
+        UiHslider &volume() { return _volume; }
+        void showPlayback(bool paused, bool podcast, int seconds);
+
+    private:
+      static constexpr int D = 5; // distance from the left panel side
+      static constexpr int d = 4; // distance between buttons
+      UiGlyphButton _station {this, _x+D,           _y+10,  40, 26, defaultTheme, stationGlyphs, "", ""}; 
+      UiHslider     _volume  {this, _x+D+1*d+65,    _y+60, 155,  8, TFT_GOLD, "Volume"};
+      UiButton      _recall  {this, _x+D,           _y+50,  60, 26, "recall"}; 
+      UiButton      _store   {this, _x+D,           _y+90,  60, 26, "store"};
+      UiButton      _first   {this, _x+2*D+1*d+60,  _y+90,  40, 26, "<<", ""};
+      UiButton      _previous{this, _x+2*D+2*d+100, _y+90,  32, 26, "<", ""};
+      UiButton      _next    {this, _x+2*D+3*d+133, _y+90,  32, 26, ">", ""};
+      UiButton      _last    {this, _x+2*D+4*d+165, _y+90,  40, 26, ">>", "Stations"};
+      UiButton      _pause   {this, _x+250,         _y+10,  62, 26, "||", ""};
+      UiButton      _rewind  {this, _x+250,         _y+50,  62, 26, "-30s", ""};
+      UiButton      _live    {this, _x+250,         _y+90,  62, 26, "live", "Timeshift"};
+      
+      bool          _podcastShown = false;
+      
+      std::array<UiButton *, 11> _btns = { &_station, &_volume, &_first, &_previous, &_next, &_last, &_store, &_recall,
+                                           &_pause, &_rewind, &_live };
+};
+
+// Stereo level and spectrum display, shares the area of the radio panel.
+// Only the segments that change are drawn, the back buffer pushes them 
+// at the end of the frame.
+class UiPanelMeter : public UiPanel
+{
+    public:
+        UiPanelMeter(UiFrameBuffer &fb, UiRect r, int bgColor, bool hidden=true) : 
+            UiPanel(fb, r, bgColor, hidden)
+        {
+            if (! _hidden) { show(); }
+        }
+
+        void show()
+        {
+            _hidden = false;
+            _fb.fillRect(_x, _y, _w, _h, _bgColor);
+            _fb.drawString("L", _x+5, _y+VU_Y+VU_H/2, TFT_WHITE, _bgColor, &fonts::DejaVu12);
+            _fb.drawString("R", _x+5, _y+VU_Y+VU_DY+VU_H/2, TFT_WHITE, _bgColor, &fonts::DejaVu12);
+            for (int bar = 0; bar < BARS; bar++)
             {
-                _btns.at(i)->draw();
+                for (int s = 0; s < segments(bar); s++) segment(bar, s, false);
+                _shown[bar] = 0;
             }
+            _peakShown[0] = _peakShown[1] = -1;
         }
 
-        void handleKeys(int x, int y);
-        std::vector<UiButton *> getButtons() { return _btns; }
+        // Called from a frame hook of the renderer
+        void animate(AudioMeter &m)
+        {
+            if (_hidden) return;
+            uint32_t t0 = micros();
+            if (m.getLevels(_levels, _seq))
+            {
+                for (int c = 0; c < 2; c++) 
+                {
+                    _target[c] = AudioMeter::toSegments(_levels.rms[c], VU_SEGS);
+                    _peak[c]   = AudioMeter::toSegments(_levels.peak[c], VU_SEGS) - 1;
+                }
+                for (int b = 0; b < METER_BANDS; b++) _target[2+b] = AudioMeter::toSegments(_levels.band[b], SP_SEGS);
+            }
+
+            int changed = 0;
+            for (int bar = 0; bar < BARS; bar++)
+            {
+                // rise at once, fall by one segment per frame
+                int next = _target[bar] >= _shown[bar] ? _target[bar] : _shown[bar] - 1;
+                for (int s = _shown[bar]; s < next; s++) segment(bar, s, true);
+                for (int s = next; s < _shown[bar]; s++) segment(bar, s, false);
+                changed += abs(next - _shown[bar]);
+                _shown[bar] = next;
+            }
+            for (int c = 0; c < 2; c++)
+            {
+                if (_peakShown[c] == _peak[c]) continue;
+                if (_peakShown[c] >= 0) segment(c, _peakShown[c], _peakShown[c] < _shown[c]);
+                if (_peak[c] >= _shown[c]) _fb.fillRect(_x+VU_X+_peak[c]*VU_SEG_W, _y+VU_Y+c*VU_DY, VU_SEG_W-1, VU_H, TFT_WHITE);
+                _peakShown[c] = _peak[c];
+            }
+
+            if (changed == 0) return;
+            uint32_t us = micros() - t0;
+            _frames++;
+            _usSum += us;
+            if (us > _usMax) _usMax = us;
+        }
+
+        void printStats()
+        {
+            uint32_t ms = millis();
+            log_i("Meter panel: %u frames (%u/s), draw avg %u us, max %u us", 
+                  _frames, _frames * 1000 / max((uint32_t)1, ms - _msStats), _frames ? _usSum / _frames : 0, _usMax);
+            _frames = _usSum = _usMax = 0;
+            _msStats = ms;
+        }
 
     private:
-      int D = 5; // distance from the left panel side
-      int d = 4;  // distance between buttons
-      UiButton  *_station  = new UiButton(this,  _x+D,           _y+10,  40, 26, defaultTheme, "", ""); 
-      UiHslider *_volume   = new UiHslider(this, _x+D+1*d+65,    _y+60, 155,  8, TFT_GOLD, "Volume");
-      UiButton  *_recall   = new UiButton(this,  _x+D,           _y+50,  60, 26, "recall"); 
-      UiButton  *_store    = new UiButton(this,  _x+D,           _y+90,  60, 26, "store");
-      UiButton  *_first    = new UiButton(this,  _x+2*D+1*d+60,  _y+90,  40, 26, "<<", "");
-      UiButton  *_previous = new UiButton(this,  _x+2*D+2*d+100, _y+90,  32, 26, "<", "");
-      UiButton  *_next     = new UiButton(this,  _x+2*D+3*d+133, _y+90,  32, 26, ">", "");
-      UiButton  *_last     = new UiButton(this,  _x+2*D+4*d+165, _y+90,  40, 26, ">>", "Stations");
-      
-      std::vector<UiButton *> _btns = { _station, _volume, _first, _previous, _next, _last, _store, _recall};
+        static constexpr int VU_SEGS = 48, VU_SEG_W = 6, VU_X = 20, VU_Y = 6, VU_H = 10, VU_DY = 14;
+        static constexpr int SP_SEGS = 20, SP_SEG_H = 4, SP_BAR_W = 12, SP_X = 20, SP_BOTTOM = 120;
+        static constexpr int BARS = 2 + METER_BANDS;
+
+        static int segments(int bar) { return bar < 2 ? VU_SEGS : SP_SEGS; }
+
+        void segment(int bar, int s, bool lit)
+        {
+            int n = segments(bar);
+            uint32_t color = !lit ? DARKERGREY : s < n*7/10 ? TFT_GREEN : s < n*9/10 ? TFT_YELLOW : TFT_RED;
+            if (bar < 2) _fb.fillRect(_x+VU_X+s*VU_SEG_W, _y+VU_Y+bar*VU_DY, VU_SEG_W-1, VU_H, color);
+            else _fb.fillRect(_x+SP_X+(bar-2)*SP_BAR_W, _y+SP_BOTTOM-(s+1)*SP_SEG_H, SP_BAR_W-2, SP_SEG_H-1, color);
+        }
+
+        AudioLevels _levels;
+        uint32_t _seq = 0;
+        int _target[BARS] = {};
+        int _shown[BARS] = {};
+        int _peak[2] = { -1, -1 };
+        int _peakShown[2] = { -1, -1 };
+        uint32_t _frames = 0, _usSum = 0, _usMax = 0, _msStats = 0;
 };
 
-// Declare pointers to the panels and initialize them with nullptr
-UiPanelTitle    *panelTitle = nullptr;
-UiPanelDateTime *panelDateTime = nullptr;
-UiPanelMetaData *panelMetaData = nullptr;
-UiPanelRadio    *panelRadio = nullptr; 
+// Compile-time layout of the screen in landscape orientation
+constexpr UiRect titleArea    { 0,   0, SCREEN_W, 35 };
+constexpr UiRect dateTimeArea { 0,  35, SCREEN_W, 30 };
+constexpr UiRect metaDataArea { 0,  65, SCREEN_W, 50 };
+constexpr UiRect radioArea    { 0, 115, SCREEN_W, SCREEN_H-115 };
 
-// Declare the static class variable again here in main
-std::vector<UiPanel *> UiPanel::panels;
+// The panels and their widgets live in static storage, they are 
+// created hidden and shown in initPanels() when the display is ready
+UiPanelTitle    panelTitle(frameBuffer, titleArea, TFT_GOLD);
+UiPanelDateTime panelDateTime(frameBuffer, dateTimeArea, DARKERGREY);
+UiPanelMetaData panelMetaData(frameBuffer, metaDataArea, TFT_SILVER);
+UiPanelRadio    panelRadio(frameBuffer, radioArea, TFT_MAROON); 
+UiPanelMeter    panelMeter(frameBuffer, radioArea, TFT_BLACK);
 
+// Define the static class variable with all panels here in main
+UiPanel *UiPanel::panels[UiPanel::maxPanels] = { &panelTitle, &panelDateTime, &panelMetaData, &panelRadio, &panelMeter };
 
-void startPlaying(int station, float loudness)
+// Keypad to type the number of a station, opened by a long press on the station 
+// number. The screen under it is saved compressed and restored when it closes.
+uint16_t       keypadSaved[8192];   // 16 KB instead of 53 KB for 180x149 raw
+UiBackingStore keypadStore(keypadSaved, 8192);
+UiKeypad       keypad(frameBuffer, 66, SCREEN_H-149, DARKERGREY, true);
+
+
+void startOutput(float loudness)
 {
   i2s.begin(config);
   dec.begin();
   volume.begin(config);
   volume.setVolume(loudness);
-  UiHslider* s = static_cast<UiHslider *>(panelRadio->getButtons().at(1));
-  s->slideToValue(loudness);
-  url.begin(radioStation[station]. url, "audio/mp3");
+}
+
+
+/**
+ * An HLS station is fetched segment by segment, the decoder
+ * is chosen by the codec of its first segment
+ */
+void startPlaying(int station, float loudness)
+{
+  const char *stationUrl = radioStation[station].url;
+  hlsMode = strstr(stationUrl, ".m3u8") != nullptr;
+  if (hlsMode)
+  {
+    if (!hls.begin(stationUrl)) log_e("HLS station %s does not play", radioStation[station].name);
+    dec.setDecoder(hls.codec() == HlsCodec::Aac ? static_cast<AudioDecoder *>(&aacDecoder) : &mp3Decoder);
+    startOutput(loudness);
+    copier.begin(timeshift, hls);
+    return;
+  }
+  dec.setDecoder(&mp3Decoder);
+  startOutput(loudness);
+  url.begin(stationUrl, "audio/mp3");
+  copier.begin(timeshift, url);
+}
+
+
+/**
+ * Play an episode of the loaded feed instead of the station,
+ * the station is played again by the next restart request
+ */
+bool startEpisode(int index)
+{
+  char feedTitle[RENDER_TEXT_LEN];
+  const PodcastEpisode &e = feed.episode(index);
+  stopPlaying();
+  hlsMode = false;
+  dec.setDecoder(&mp3Decoder);
+  startOutput(currentVolume);
+  if (!episode.open(e.url)) return false;
+  copier.begin(timeshift, episode);
+  podcastMode = true;
+  podcastPaused = false;
+  currentEpisode = index;
+  uiToLatin1(e.title, currentTitle, sizeof(currentTitle));
+  uiToLatin1(feed.title(), feedTitle, sizeof(feedTitle));
+  panelMetaData.showTitle(renderer, feedTitle, currentTitle);
+  return true;
+}
+
+
+// Bytes the source of the copier has ready
+int sourceAvailable()
+{
+  if (podcastMode) return episode.available();
+  return hlsMode ? hls.available() : url.available();
 }
 
 
 void stopPlaying()
 {
-  //panelMetaData->show();
+  //panelMetaData.show();
+  recorder.stop();            // a recording ends with the station
+  timeshift.restart();        // no rewind into the previous station
+  episode.close();
+  podcastMode = false;
+  podcastPaused = false;      // else the station would not be copied
   url.end();
+  hls.end();
   volume.end();
   dec.end();
   i2s.end();
@@ -333,8 +663,7 @@ void stopPlaying()
 void firstStation()
 {
   currentStation = 0;
-  stopPlaying();
-  startPlaying(currentStation, currentVolume); 
+  restartRequested = true;
   showCurrent();
 }
 
@@ -342,8 +671,7 @@ void firstStation()
 void lastStation()
 {
   currentStation = nbrRadiostations - 1;
-  stopPlaying();
-  startPlaying(currentStation, currentVolume);
+  restartRequested = true;
   showCurrent();
 }
 
@@ -352,8 +680,7 @@ void nextStation()
 {
   currentStation++;
   if (currentStation == nbrRadiostations) currentStation = 0;
-  stopPlaying();
-  startPlaying(currentStation, currentVolume);
+  restartRequested = true;
   showCurrent();
 }
 
@@ -362,11 +689,43 @@ void prevStation()
 {
   if (currentStation == 0) currentStation = nbrRadiostations;
   currentStation--;
-  stopPlaying();
-  startPlaying(currentStation, currentVolume);
+  restartRequested = true;
   showCurrent();
 }
 
+void selectStation(int station)
+{
+  currentStation = station;
+  restartRequested = true;
+  showCurrent();
+}
+
+
+/**
+ * Show the keypad over the radio panel. Runs on the render task.
+ */
+void openKeypad()
+{
+  if (panelRadio.isHidden() || ! keypad.isHidden()) return;
+  keypad.show();
+  keypadStore.printStats("Keypad store");
+}
+
+// Before a panel under the keypad draws, the keypad gives way
+void closeKeypad()
+{
+  if (! keypad.isHidden()) keypad.close();
+}
+
+
+void setVolume(float loudness)
+{
+  closeKeypad();
+  currentVolume = loudness;
+  volumeRequested = true;
+  panelRadio.volume().slideToValue(UiFixed::fromFloat(loudness));
+}
+
 void storePreference()
 {
   prefs.begin("SETTINGS");
@@ -384,8 +743,9 @@ void recallPreferences()
   currentVolume = prefs.getFloat("VOLUME");
   prefs.end();
   log_i("station=%d, volume=%f", currentStation, currentVolume);
-  stopPlaying();
-  startPlaying(currentStation, currentVolume);
+  restartRequested = true;
+  closeKeypad();
+  panelRadio.volume().slideToValue(UiFixed::fromFloat(currentVolume));
   showCurrent();
   log_i("Settings recalled from Preferences");
 }
@@ -393,49 +753,157 @@ void recallPreferences()
 
 void showCurrent() 
 {
-  panelRadio->getButtons().at(0)->updateValue(currentStation);
-  panelRadio->getButtons().at(0)->clearLabel();
-  panelRadio->getButtons().at(0)->setLabel(radioStation[currentStation].name);
+  closeKeypad();
+  UiGlyphButton &station = panelRadio.station();
+  station.updateValue(currentStation);
+  log_i("station number: %d cells in %lu us", station.cellsLastRedraw(), station.usLastRedraw());
+  station.clearLabel();
+  station.setLabel(radioStation[currentStation].name);
   Serial.printf_P(PSTR("Current Station: %s --> %s\n"), radioStation[currentStation].name, radioStation[currentStation].url);
 };
 
 
-  /**
-   * Save a screenshot to SD card 
-   */
-  void takeScreenShot()
+/**
+ * Grab the screen on the render task and let the capture task
+ * write it to the SD card. loop() does not wait for the grab,
+ * the radio keeps playing.
+ */
+void takeScreenShot()
+{
+  static char filename[CAPTURE_NAME_LEN];   // read by the render task
+  tm rtcTime;
+
+  if (capture.isBusy()) 
   {
-    tm   rtcTime;
-    char buf[48];
-    int  bufSize = sizeof(buf);
-    getLocalTime(&rtcTime);
-    strftime(buf, bufSize, "/Screenshots/Scr%Y%m%d_%H%M%S.bmp", &rtcTime);
-    log_i("filename = %s", buf);
-    stopPlaying();
-    initSDCard(sdcardSPI); 
-    saveBmpToSD_24bit(lcd, buf) ? log_i("screenshot %s saved to SD card", buf) : log_i("saving screensho failed");
-    SD.end();
-    sdcardSPI.end();
-    lcd.touch()->init();
-    startPlaying(currentStation, currentVolume);
+    log_w("previous screenshot not yet written");
+    return;
   }
+  getLocalTime(&rtcTime);
+  strftime(filename, sizeof(filename), "/Screenshots/Scr%Y%m%d_%H%M%S.png", &rtcTime);
+  log_i("filename = %s", filename);
+  renderer.call([](LGFX &lcd, int x, int y, void *arg) 
+    { if (capture.grab(frameBuffer)) capture.save(static_cast<const char *>(arg), CaptureFormat::Png); }, 0, 0, filename);
+}
+
+
+/**
+ * Files the player keeps open for writing, the file manager
+ * does not delete them. Called on the async TCP task.
+ */
+bool fileInUse(const char *path)
+{
+  return strcasecmp(path, TIMESHIFT_FILE) == 0 || recorder.isWriting(path);
+}
+
+
+/**
+ * Apply a command of the web API. The same functions as for the
+ * buttons are called on the render task, which owns the panels.
+ * The player itself is restarted by the requests they set.
+ */
+void applyCommand(const PlayerCommand &cmd)
+{
+  switch (cmd.op)
+  {
+    case PlayerOp::Station:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) { selectStation(x); }, cmd.value);
+    break;
+    case PlayerOp::Volume:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) { setVolume(x / 1000.0f); }, cmd.value);
+    break;
+    case PlayerOp::Next:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) { nextStation(); });
+    break;
+    case PlayerOp::Prev:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) { prevStation(); });
+    break;
+    case PlayerOp::Store:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) { storePreference(); });
+    break;
+    case PlayerOp::Recall:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) { recallPreferences(); });
+    break;
+    case PlayerOp::Record:
+      if (cmd.value) recorder.start(currentTitle[0] ? currentTitle : radioStation[currentStation].name,
+                                    hlsMode && hls.codec() == HlsCodec::Aac ? "aac" : "mp3");
+      else recorder.stop();
+      publishStatus();
+    break;
+    case PlayerOp::Podcast:
+      stopPlaying();
+      if (!feed.load(podcastFeed[cmd.value].url) || !startEpisode(0)) restartRequested = true;  // the station again
+      publishStatus();
+    break;
+    case PlayerOp::Episode:
+      if (cmd.value >= feed.count()) log_w("No episode %d", cmd.value);
+      else if (!startEpisode(cmd.value)) restartRequested = true;
+      publishStatus();
+    break;
+    case PlayerOp::Seek:
+      if (podcastMode) episode.seek(cmd.value);
+      publishStatus();
+    break;
+  }
+  api.commandDone(cmd);
+}
+
+
+/**
+ * Hand the current state of the player to the web API
+ */
+void publishStatus()
+{
+  PlayerStatus s;
+  s.station = currentStation;
+  s.volume = lroundf(currentVolume * 1000.0f);
+  strlcpy(s.name, radioStation[currentStation].name, sizeof(s.name));
+  strlcpy(s.title, currentTitle, sizeof(s.title));
+  s.recording = recorder.isRecording();
+  s.podcast = podcastMode;
+  s.episode = podcastMode ? currentEpisode : -1;
+  s.position = podcastMode ? episode.position() : 0;
+  s.duration = podcastMode ? episode.duration() : 0;
+  api.publish(s);
+}
+
+
+/**
+ * Sample the telemetry of the event stream, called in loop()
+ */
+void readTelemetry(Telemetry &t)
+{
+  static AudioLevels lv = {};
+  static uint32_t seq = 0;
+  meter.getLevels(lv, seq);
+  t.buffered = sourceAvailable();
+  t.peak = max(lv.peak[0], lv.peak[1]);
+  t.rssi = WiFi.RSSI();
+  t.underruns = governor.underruns();
+}
 
 
 void cbShowMetaData(MetaDataType info, const char *str, int len)
 {
-  String txt;
-  int indexDash;
+  char title[RENDER_TEXT_LEN];
+  char *dash;
   switch (info)
   {
     case MetaDataType::Title:
       log_i("%s", MetaDataTypeStr[MetaDataType::Title]);
-      log_i("%s", str);
-      indexDash = String(str).indexOf(" -"); //log_i("index dash = %d", indexDash);
-      panelMetaData->show();
-      txt = String(str).substring(0, indexDash);
-      panelMetaData->panelText(5, 18, txt, TFT_MAROON, Calibri12pt8b);
-      txt = String(str).substring(indexDash > 0 ? indexDash+3 : 0);
-      panelMetaData->panelText(5, 38, txt, TFT_MAROON, Calibri8pt8b);
+      log_i("%s (%s)", str, uiDetectEncoding(str) == UiTextEncoding::Utf8 ? "UTF-8" : "Latin-1");
+      uiToLatin1(str, title, sizeof(title));
+      strlcpy(currentTitle, title, sizeof(currentTitle));
+      publishStatus();
+      dash = strstr(title, " -");  // "composer - opus"
+      if (dash == nullptr) 
+      {
+        panelMetaData.showTitle(renderer, title, title);
+        break;
+      }
+      *dash = '\0';
+      dash += 2;
+      while (*dash == ' ') dash++;
+      panelMetaData.showTitle(renderer, title, dash);
     break;
     case MetaDataType::Artist:
       log_i("%s", MetaDataTypeStr[MetaDataType::Artist]);
@@ -460,69 +928,165 @@ void cbShowMetaData(MetaDataType info, const char *str, int len)
 }
 
 
-void UiPanelRadio::handleKeys(int x, int y)
+/**
+ * Register the handlers of the buttons with the dispatcher
+ */
+void UiPanelRadio::bindKeys(UiDispatcher &d)
 {
-  UiHslider *slider;
-  double loudness;
+  d.on(&_station,  [](UiButton *b, int x, int y, void *arg) { screenshotRequested = true; });
+  d.on(&_volume,   [](UiButton *b, int x, int y, void *arg) { static_cast<UiPanelRadio *>(arg)->dragVolume(x); }, this, UiFire::Drag);
+  d.on(&_first,    [](UiButton *b, int x, int y, void *arg) { firstStation(); });
+  d.on(&_previous, [](UiButton *b, int x, int y, void *arg) { prevStation(); }, nullptr, UiFire::Repeat);
+  d.on(&_next,     [](UiButton *b, int x, int y, void *arg) { nextStation(); }, nullptr, UiFire::Repeat);
+  d.on(&_last,     [](UiButton *b, int x, int y, void *arg) { lastStation(); });
+  d.on(&_store,    [](UiButton *b, int x, int y, void *arg) { storePreference(); });
+  d.on(&_recall,   [](UiButton *b, int x, int y, void *arg) { recallPreferences(); });
+  d.on(&_pause,    [](UiButton *b, int x, int y, void *arg) { pauseRequested = true; });
+  d.on(&_rewind,   [](UiButton *b, int x, int y, void *arg) { rewindRequested = true; }, nullptr, UiFire::Repeat);
+  d.on(&_live,     [](UiButton *b, int x, int y, void *arg) { liveRequested = true; });
+}
 
-    for (int i = 0; i < _btns.size(); i++)
-    {
-        if (_btns.at(i)->touched(x, y)) 
-        {
-            log_i("Key pressed: %d", i);
-            switch(i)
-            {
-                case 0: // station
-                  takeScreenShot();
-                break;
-
-                case 1: // slider
-                  slider = (UiHslider *)_btns.at(i);
-                  slider->slideToPosition(x);
-                  slider->getValue(loudness);
-                  currentVolume = (float)loudness;
-                  volume.setVolume(currentVolume);                      
-                break;
-
-                case 2:  
-                  firstStation();   
-                break;
-
-                case 3:
-                  prevStation();                   
-                break;
-
-                case 4: // first
-                  nextStation();                   
-                break;
-
-                case 5: // previous
-                  lastStation();
-                break;
-
-                case 6: // save
-                  storePreference();
-                break;
-                
-                case 7: // recall
-                  recallPreferences();
-                break;
-            }
-            delay(100);
-        }
-    }
+
+/**
+ * Pause or play on the pause button, on the live button the delay
+ * behind the live stream as -m:ss or the position of the episode
+ */
+void UiPanelRadio::showPlayback(bool paused, bool podcast, int seconds)
+{
+  char buf[12];
+  _pause.updateValue(paused ? ">" : "||");
+  if (podcast) snprintf(buf, sizeof(buf), "%d:%02d", seconds / 60, seconds % 60);
+  else if (seconds == 0) strlcpy(buf, "live", sizeof(buf));
+  else snprintf(buf, sizeof(buf), "-%d:%02d", seconds / 60, seconds % 60);
+  _live.updateValue(buf);
+  if (podcast == _podcastShown) return;
+  _podcastShown = podcast;
+  _live.clearLabel();
+  _live.setLabel(podcast ? "Podcast" : "Timeshift");
 }
 
 
+/**
+ * Update the timeshift buttons when the state, the delay or the
+ * position of the episode has changed, called in loop()
+ */
+void showPlayback()
+{
+  static int shownState = 0;
+  static int shownSeconds = 0;
+  int state   = (podcastMode ? podcastPaused : timeshift.isPaused()) | podcastMode << 1;
+  int seconds = podcastMode ? episode.position() : timeshift.delaySeconds();
+  if (state == shownState && seconds == shownSeconds) return;
+  if (podcastMode) publishStatus();
+  shownState = state;
+  shownSeconds = seconds;
+  renderer.call([](LGFX &lcd, int x, int y, void *arg) { panelRadio.showPlayback(x & 1, x & 2, y); }, state, seconds);
+}
+
+
+void UiPanelRadio::dragVolume(int x)
+{
+  UiFixed loudness;
+  _volume.slideToPosition(x);
+  _volume.getValue(loudness);
+  currentVolume = loudness.toFloat();
+  volumeRequested = true;
+}
+
+
+/**
+ * Swap the radio panel and the level meter. 
+ * Runs on the render task.
+ */
+void toggleMeter()
+{
+  closeKeypad();
+  if (panelMeter.isHidden()) panelRadio.hide(&panelMeter);
+  else panelMeter.hide(&panelRadio);
+}
+
+
+/**
+ * Handle a touch event in loop(). Pen down, drag and up are passed 
+ * to the dispatcher, a horizontal swipe changes the station, a long
+ * press on the station number opens the keypad and a long press
+ * outside of the widgets toggles the level meter.
+ * The handlers run on the render task, so nothing here blocks 
+ * the radio.
+ */
+void handleTouchEvent(const TouchEvent &e)
+{
+  switch (e.type)
+  {
+    case TouchEventType::Down:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) { dispatcher.penDown(x, y, millis()); }, e.x, e.y);
+    break;
+
+    case TouchEventType::Drag:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) { dispatcher.penMove(x, y, millis()); }, e.x, e.y);
+    break;
+
+    case TouchEventType::Up:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) { dispatcher.penUp(x, y, millis()); }, e.x, e.y);
+    break;
+
+    case TouchEventType::LongPress:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) 
+        { 
+          if (dispatcher.pressed() == &panelRadio.station()) 
+          {
+            dispatcher.cancel();      // no screenshot when the pen is lifted
+            openKeypad();
+          }
+          else if (! dispatcher.lastDownHitWidget() && keypad.isHidden()) toggleMeter(); 
+        });
+    break;
+
+    case TouchEventType::SwipeLeft:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) 
+        { if (! dispatcher.lastDownHitWidget() && ! panelRadio.isHidden() && keypad.isHidden()) nextStation(); });
+    break;
+
+    case TouchEventType::SwipeRight:
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) 
+        { if (! dispatcher.lastDownHitWidget() && ! panelRadio.isHidden() && keypad.isHidden()) prevStation(); });
+    break;
+
+    default:
+    break;
+  }
+}
+
+
+/**
+ * Show time and date. Only the digits that have changed 
+ * since the last second are pushed from the glyph atlas.
+ * The render time is logged once a minute.
+ */
 void UiPanelDateTime::updateDateTime()
 {
     tm   rtcTime;
     char buf[12];
+    auto put2 = [](char *p, int v) { p[0] = '0' + v / 10; p[1] = '0' + v % 10; };
+
     getLocalTime(&rtcTime);
-    strftime(buf, sizeof(buf), "%T", &rtcTime); // hh:mm:ss
-    _theTime->updateValue(buf);
-    strftime(buf, sizeof(buf), "%F", &rtcTime); // YYYY-MM-DD
-    _theDate->updateValue(buf);
+    uint32_t t0 = micros();
+    put2(&buf[0], rtcTime.tm_hour);  buf[2] = ':';  // hh:mm:ss
+    put2(&buf[3], rtcTime.tm_min);   buf[5] = ':';
+    put2(&buf[6], rtcTime.tm_sec);   buf[8] = '\0';
+    _theTime.updateValue(buf);
+    int cells = _theTime.cellsLastRedraw();
+
+    int year = rtcTime.tm_year + 1900;              // YYYY-MM-DD
+    put2(&buf[0], year / 100);  put2(&buf[2], year % 100);  buf[4] = '-';
+    put2(&buf[5], rtcTime.tm_mon + 1);  buf[7] = '-';
+    put2(&buf[8], rtcTime.tm_mday);     buf[10] = '\0';
+    _theDate.updateValue(buf);
+    cells += _theDate.cellsLastRedraw();
+
+    uint32_t us = micros() - t0;
+    if (us > _usRenderMax) _usRenderMax = us;
+    if (rtcTime.tm_sec == 0) log_i("date/time: %d cells in %lu us (max %lu us)", cells, us, _usRenderMax);
 }
 
 
@@ -539,6 +1103,7 @@ void initAudio()
   config.pin_bck  = I2S_BCKL;
   config.pin_ws   = I2S_WSEL;
   config.pin_data = I2S_DOUT;
+  meter.startAnalysis();
   startPlaying(currentStation, currentVolume);
   log_i("==> done");  
 }
@@ -555,22 +1120,99 @@ void initRTC()
 }
 
 
+/**
+ * Show the statically allocated panels. The heap 
+ * delta shows whether the UI still allocates memory.
+ */
 void initPanels()
 {
-  // Create the panels and showm them ( argument hidden is set to false)
-  panelTitle    = new UiPanelTitle(lcd, 0, 0,  lcd.width(), 35, TFT_GOLD,  false);
-  panelDateTime = new UiPanelDateTime(lcd, 0, 35, lcd.width(), 30, DARKERGREY, false);
-  panelMetaData = new UiPanelMetaData(lcd, 0, 65, lcd.width(), 50, TFT_SILVER, false);
-  panelRadio    = new UiPanelRadio(lcd, 0, 115, lcd.width(), lcd.height()-115, TFT_MAROON,  false);
+  uint32_t freeHeap = ESP.getFreeHeap();
 
-  // Initialize the static class variable with all panels
-  UiPanel::panels = { panelTitle, panelDateTime, panelMetaData, panelRadio };
+  for (int i = 0; i < UiPanel::maxPanels && UiPanel::panels[i]; i++) 
+  {
+    if (UiPanel::panels[i] != &panelMeter) UiPanel::panels[i]->show(); // the meter replaces the radio panel on demand
+  }
 
-  panelRadio->getButtons().at(0)->updateValue(currentStation);
-  panelRadio->getButtons().at(0)->setLabel(radioStation[currentStation].name);
-  UiHslider *s = reinterpret_cast<UiHslider *>(panelRadio->getButtons().at(1));
-  s->setRange(0.0, 1.0);
-  s->slideToValue(currentVolume);
+  panelRadio.station().setRange(0, nbrRadiostations - 1);
+  panelRadio.station().updateValue(currentStation);
+  panelRadio.station().setLabel(radioStation[currentStation].name);
+  UiHslider &s = panelRadio.volume();
+  s.setRange(UiFixed::from(0.0), UiFixed::from(1.0));
+  s.slideToValue(UiFixed::fromFloat(currentVolume));
+  panelRadio.bindKeys(dispatcher);
+  keypad.setBackingStore(&keypadStore);
+  keypad.addValueField(&panelRadio.station());
+  keypad.addOkCallback([](UiButton *b) { int station; b->getValue(station); selectStation(station); });
+  keypad.bindKeys(dispatcher);      // after the radio panel, the keys are on top
+  dispatcher.setModal(&keypad);
+
+  int heapDelta = (int)(freeHeap - ESP.getFreeHeap());
+  log_i("UI static size %u bytes, heap delta %d bytes", 
+        sizeof(panelTitle) + sizeof(panelDateTime) + sizeof(panelMetaData) + sizeof(panelRadio) 
+        + sizeof(clockCells) + sizeof(stationCells) + sizeof(composerPool) + sizeof(opusPool)
+        + sizeof(composerSprite) + sizeof(opusSprite) + sizeof(marqueeWindow)
+        + sizeof(fbPixels) + sizeof(fbBands) + sizeof(keypad) + sizeof(keypadStore) + sizeof(keypadSaved), heapDelta);
+  if (heapDelta > 0) log_w("==> UI allocated %d bytes on the heap", heapDelta);
+}
+
+
+/**
+ * Measure the value model of the widgets on the device: CPU cycles 
+ * per value update and the heap bytes the updates allocate.
+ * Must run on the render task, because the widgets redraw.
+ */
+void benchmarkValueModel()
+{
+  const int n = 200;
+  UiHslider &s = panelRadio.volume();
+  UiButton &b = panelRadio.station();
+  UiFixed v;
+  uint32_t freeHeap = ESP.getFreeHeap();
+
+  uint32_t c0 = ESP.getCycleCount();
+  for (int i = 0; i < n; i++) b.updateValue(i % 100);
+  uint32_t c1 = ESP.getCycleCount();
+  for (int i = 0; i < n; i++) { s.slideToPosition(SCREEN_W/4 + i % 100); s.getValue(v); }
+  uint32_t c2 = ESP.getCycleCount();
+  int heapDelta = (int)(freeHeap - ESP.getFreeHeap());
+
+  log_i("updateValue %u cycles, slide+getValue %u cycles, heap delta %d bytes", 
+        (c1-c0) / n, (c2-c1) / n, heapDelta);
+  b.updateValue(currentStation);
+  s.slideToValue(UiFixed::fromFloat(currentVolume));
+}
+
+
+/**
+ * Compare the GFXfont path of LovyanGFX with the cached subset fonts:
+ * flash size of the fonts and rendered glyphs per second. 
+ * Must run on the render task, the metadata panel is redrawn afterwards.
+ */
+void benchmarkFonts()
+{
+  const int n = 50;
+  const char *text = "Mozart - Klaviersonate Nr. 11 A-Dur";
+  int len = strlen(text);
+  int x = metaDataArea.x + 5, y = metaDataArea.y + 18;
+
+  frameBuffer.setFont(&Calibri12pt8b);
+  frameBuffer.setTextDatum(textdatum_t::middle_left);
+  frameBuffer.setTextColor(TFT_MAROON, panelMetaData.getPanelColor());
+  uint32_t t0 = micros();
+  for (int i = 0; i < n; i++) frameBuffer.drawString(text, x, y);
+  uint32_t t1 = micros();
+  for (int i = 0; i < n; i++) composerFont.drawString(frameBuffer, text, x, y, TFT_MAROON, panelMetaData.getPanelColor());
+  uint32_t t2 = micros();
+
+  log_i("GFXfont 12pt: %u bytes flash, %u glyphs/s", 
+        sizeof(Calibri12pt8bBitmaps) + sizeof(Calibri12pt8bGlyphs), (uint32_t)(1000000ULL * n * len / (t1-t0)));
+  log_i("UiRleFont 12pt: %u bytes flash, %u glyphs/s", 
+        sizeof(Calibri12ptRleData) + sizeof(Calibri12ptRleGlyphs) + sizeof(Calibri12ptRleIndex), (uint32_t)(1000000ULL * n * len / (t2-t1)));
+  log_i("GFXfont 8pt: %u bytes flash, UiRleFont 8pt: %u bytes flash", 
+        sizeof(Calibri8pt8bBitmaps) + sizeof(Calibri8pt8bGlyphs), 
+        sizeof(Calibri8ptRleData) + sizeof(Calibri8ptRleGlyphs) + sizeof(Calibri8ptRleIndex));
+  composerFont.printStats("composer");
+  panelMetaData.show();
 }
 
 
@@ -583,36 +1225,141 @@ void setup()
   
   // Initialize the display without prior calibration
   initDisplay(lcd, static_cast<uint8_t>(ROTATION::LANDSCAPE_USB_LEFT));
+  frameBuffer.begin();
+  renderer.addFrameHook([](LGFX &lcd, int x, int y, void *arg) { dispatcher.update(millis()); }); // auto-repeat
+  renderer.addFrameHook([](LGFX &lcd, int x, int y, void *arg) { if (keypad.isHidden()) panelMetaData.animate(millis(), ! governor.allows(UiWork::Marquee)); });
+  renderer.addFrameHook([](LGFX &lcd, int x, int y, void *arg) { if (governor.allows(UiWork::Meter)) panelMeter.animate(meter); });
+  renderer.addFrameHook([](LGFX &lcd, int x, int y, void *arg) { if (governor.allows(UiWork::Mirror)) mirror.scan(); });
+  renderer.addFrameHook([](LGFX &lcd, int x, int y, void *arg) { frameBuffer.push(lcd); }); // after all drawing into the back buffer
+  renderer.begin();           // from now on only the render task draws
   initPrefs();
   printPrefs();
   initESP32AutoConnect(server, prefs, HOST_NAME);
-  initPanels();
-  initSDCard(sdcardSPI);      // Init SD card to take screenshots
-  printSDCardInfo();          // Print SD card details 
-  listFiles(SD.open("/"));    // List the files on SD card
-  SD.end();                   // Stop SD card to get touchpad working
-  sdcardSPI.end();
-  lcd.touch()->init();
+  webScreenshot.begin(server); // GET http://cyd-radio/screenshot[?format=bmp]
+  mirror.begin(server);        // http://cyd-radio/mirror
+  api.setPodcasts(podcastName, nbrPodcasts);
+  api.begin(server);           // http://cyd-radio/api/status
+  events.begin(server);        // http://cyd-radio/api/events
+  beginWebAssets(server);      // http://cyd-radio/ and /mirror from flash
+  files.begin(server);         // http://cyd-radio/api/files?dir=/Screenshots
+  feed.begin(server);          // http://cyd-radio/api/episodes
+  renderer.callAndWait([](LGFX &lcd, int x, int y, void *arg) { initPanels(); });
+  //renderer.callAndWait([](LGFX &lcd, int x, int y, void *arg) { benchmarkValueModel(); });
+  //renderer.callAndWait([](LGFX &lcd, int x, int y, void *arg) { benchmarkFonts(); });
+  //renderer.callAndWait([](LGFX &lcd, int x, int y, void *arg) { if (capture.grab(frameBuffer)) capture.benchmark(); });
+  vspi.addClient(SpiClient::Touch, { TP_SCLK, TP_MISO, TP_MOSI });
+  vspi.addClient(SpiClient::Sd,    { TF_SCLK, TF_MISO, TF_MOSI });
+  bool sdReady = initSDCard(sdcardSPI);
+  if (sdReady)                // Init SD card to take screenshots, it stays mounted
+  {
+    printSDCardInfo();        // Print SD card details 
+    listFiles(SD.open("/"));  // List the files on SD card
+  }
+  vspi.begin(SpiClient::Sd);  // the pins are routed to the SD card now
+  touch.setBus(vspi);
+  touch.begin();
+  capture.setBus(vspi);
+  capture.begin();
+  recorder.setBus(vspi);
+  recorder.startWriter();
+  //recorder.benchmark();
+  timeshift.setBus(vspi);
+  if (sdReady) timeshift.enable();  // the ring file needs the card
+  hls.startFetcher();
+  files.setBus(vspi);
+  files.setBusyCheck(fileInUse);
+  server.begin();             // after the bus is shared, the web handlers use the SD card
   initAudio();
+  publishStatus();
   initRTC();
   
   waitDateTime.begin();
+  waitRenderStats.begin();
   log_i("==> done");
 }
 
 
 void loop()
 {
-    int x, y;
+    TouchEvent e;
+
+    // Audio first, the governor watches the buffer and the copies without data
+    if (!podcastPaused)
+    {
+      int buffered = sourceAvailable();
+      governor.audioTick(buffered, copier.copy());
+    }
+    if (hls.discontinuity()) { dec.end(); dec.begin(); }   // new timestamps or codec parameters
+    timeshift.pump();
+    governor.update(millis());
   
-    if (!panelDateTime->isHidden() && waitDateTime.isOver()) { panelDateTime->updateDateTime(); }
+    if (!panelDateTime.isHidden() && governor.allows(UiWork::Clock) && waitDateTime.isOver()) 
+    { 
+      renderer.call([](LGFX &lcd, int x, int y, void *arg) { panelDateTime.updateDateTime(); }); 
+    }
  
-    if (getMappedTouch(lcd, x, y))
+    while (touch.getEvent(e)) handleTouchEvent(e);
+
+    // Apply the commands of the web API, the UI functions run on the render task
+    PlayerCommand cmd;
+    while (api.getCommand(cmd)) applyCommand(cmd);
+
+    // Apply the requests of the UI to the player
+    if (restartRequested.exchange(false))    { stopPlaying(); startPlaying(currentStation, currentVolume); publishStatus(); }
+    if (volumeRequested.exchange(false))     { volume.setVolume(currentVolume); publishStatus(); }
+    if (screenshotRequested.exchange(false)) { takeScreenShot(); }
+    // An episode is paused by not reading it, and rewound by a seek
+    if (pauseRequested.exchange(false))
     {
-        //Serial.printf("Key pressed at %3d, %3d\n", x, y);
-        if (!panelRadio->isHidden()) panelRadio->handleKeys(x, y);
-        vTaskDelay(pdMS_TO_TICKS(200));
+      if (podcastMode) podcastPaused = !podcastPaused;
+      else if (timeshift.isPaused()) timeshift.resume();
+      else timeshift.pause();
+    }
+    if (rewindRequested.exchange(false))
+    {
+      if (podcastMode) episode.seek(episode.position() - REWIND_SECONDS);
+      else timeshift.rewind(REWIND_SECONDS);
+    }
+    if (liveRequested.exchange(false))
+    {
+      if (podcastMode) restartRequested = true;   // back to the station
+      else timeshift.goLive();
+    }
+    // The writer of the recorder only reports a failed block, e.g. a full card
+    if (recorder.isRecording() && recorder.failed()) { recorder.stop(); publishStatus(); }
+    showPlayback();
+    events.update(millis());
+    if (waitRenderStats.isOver()) 
+    { 
+      renderer.printStats(); 
+      touch.printStats(); 
+      composerFont.printStats("composer");
+      meter.printStats();
+      meter.resetStats();
+      panelMeter.printStats();
+      frameBuffer.printStats();
+      frameBuffer.resetStats();
+      governor.printStats();
+      mirror.printStats();
+      api.printStats();
+      api.resetStats();
+      events.printStats();
+      events.resetStats();
+      printWebAssetStats();
+      files.printStats();
+      files.resetStats();
+      recorder.printStats();
+      recorder.resetStats();
+      timeshift.printStats();
+      timeshift.resetStats();
+      feed.printStats();
+      feed.resetStats();
+      episode.printStats();
+      episode.resetStats();
+      hls.printStats();
+      hls.resetStats();
+      vspi.printStats();
+      vspi.resetStats();
+      mirror.resetStats();
     }
-
-    copier.copy();
 }
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * Header       Arduino.h
+ *
+ * Purpose      The part of the Arduino core and of FreeRTOS that the
+ *              libraries under test use, for the unit tests on the host
+ *              (pio test -e native).
+ *              - A task is a std::thread, its notification value a
+ *                counter guarded by a condition variable.
+ *              - log_x() prints to stdout.
+ */
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <ctime>
+#include <strings.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using std::min;
+using std::max;
+
+#define log_e(format, ...) printf("[E] " format "\n", ##__VA_ARGS__)
+#define log_w(format, ...) printf("[W] " format "\n", ##__VA_ARGS__)
+#define log_i(format, ...) printf("[I] " format "\n", ##__VA_ARGS__)
+#define log_d(format, ...) do {} while (0)
+
+inline uint32_t millis()
+{
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+inline uint32_t micros()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+inline void delay(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+inline bool getLocalTime(tm *info, uint32_t ms=5000)
+{
+    time_t now = time(nullptr);
+    localtime_r(&now, info);
+    return true;
+}
+
+
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+#define pdTRUE        1
+#define pdFALSE       0
+#define pdPASS        1
+#define portMAX_DELAY 0xFFFFFFFF
+
+struct HostTask
+{
+    std::mutex              mutex;
+    std::condition_variable notified;
+    uint32_t                value = 0;
+};
+typedef HostTask *TaskHandle_t;
+
+inline thread_local HostTask *hostCurrentTask = nullptr;
+
+// The handle is set before the task runs, the thread lives until the process ends
+inline BaseType_t xTaskCreatePinnedToCore(void (*fn)(void *), const char *name, uint32_t stack,
+                                          void *arg, UBaseType_t priority, TaskHandle_t *handle,
+                                          BaseType_t core)
+{
+    HostTask *task = new HostTask();
+    if (handle) *handle = task;
+    std::thread([task, fn, arg]() { hostCurrentTask = task; fn(arg); }).detach();
+    return pdPASS;
+}
+
+inline void xTaskNotifyGive(TaskHandle_t task)
+{
+    {
+        std::lock_guard<std::mutex> lock(task->mutex);
+        task->value++;
+    }
+    task->notified.notify_one();
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait)
+{
+    HostTask *task = hostCurrentTask;
+    std::unique_lock<std::mutex> lock(task->mutex);
+    task->notified.wait(lock, [task]() { return task->value > 0; });
+    uint32_t value = task->value;
+    task->value = clear ? 0 : value - 1;
+    return value;
+}
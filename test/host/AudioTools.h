@@ -0,0 +1,30 @@
+/**
+ * Header       AudioTools.h
+ *
+ * Purpose      The base class AudioStream of arduino-audio-tools as far as
+ *              the pass-through streams under test use it, for the unit
+ *              tests on the host.
+ */
+#pragma once
+#include <Arduino.h>
+
+struct AudioInfo
+{
+    int sample_rate = 0;
+    int channels = 0;
+    int bits_per_sample = 0;
+};
+
+class AudioStream
+{
+    public:
+        virtual ~AudioStream() = default;
+
+        virtual size_t write(const uint8_t *data, size_t len) = 0;
+        virtual int availableForWrite() { return 1024; }
+        virtual void setAudioInfo(AudioInfo info) { _info = info; }
+        AudioInfo audioInfo() { return _info; }
+
+    protected:
+        AudioInfo _info;
+};
@@ -0,0 +1,123 @@
+/**
+ * Header       FS.h
+ *
+ * Purpose      fs::FS and fs::File of the Arduino core on a directory of
+ *              the host, for the unit tests on the host.
+ *              - FS(root) maps the paths of the card to root + path, the
+ *                root plays the mount point of the card.
+ *              - Every data write is logged with its offset and length.
+ *              - hold(true) lets the writes wait until hold(false), like
+ *                a card that is busy, to fill the ring of a writer.
+ */
+#pragma once
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+namespace fs
+{
+
+struct HostWrite
+{
+    uint32_t offset;
+    size_t   len;
+};
+
+class FS;
+
+class File
+{
+    public:
+        File() = default;
+        File(FILE *f, FS *fs) : _f(f, fclose), _fs(fs)
+        {}
+
+        operator bool() const { return _f != nullptr; }
+        size_t write(uint8_t c) { return write(&c, 1); }
+        size_t write(const uint8_t *data, size_t len);
+        int    read(uint8_t *data, size_t len) { return _f ? fread(data, 1, len, _f.get()) : 0; }
+        bool   seek(uint32_t pos) { return _f && fseek(_f.get(), pos, SEEK_SET) == 0; }
+        size_t position() { return _f ? ftell(_f.get()) : 0; }
+        void   flush() { if (_f) fflush(_f.get()); }
+        void   close() { _f.reset(); }
+
+    private:
+        std::shared_ptr<FILE> _f;
+        FS *_fs = nullptr;
+};
+
+class FS
+{
+    public:
+        FS(const char *root) : _root(root)
+        {}
+
+        File open(const char *path, const char *mode=FILE_READ)
+        {
+            FILE *f = fopen(hostPath(path).c_str(), mode);
+            return f ? File(f, this) : File();
+        }
+        bool exists(const char *path)
+        {
+            struct stat st;
+            return stat(hostPath(path).c_str(), &st) == 0;
+        }
+        bool mkdir(const char *path) { return ::mkdir(hostPath(path).c_str(), 0755) == 0; }
+        bool remove(const char *path) { return ::remove(hostPath(path).c_str()) == 0; }
+        std::string hostPath(const char *path) { return _root + path; }
+
+        void hold(bool on)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _hold = on;
+            }
+            _released.notify_all();
+        }
+        std::vector<HostWrite> writes()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _writes;
+        }
+        void clearWrites()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _writes.clear();
+        }
+
+    private:
+        friend class File;
+        void waitAndLog(uint32_t offset, size_t len)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _released.wait(lock, [this]() { return !_hold; });
+            _writes.push_back({offset, len});
+        }
+
+        std::string _root;
+        std::mutex _mutex;
+        std::condition_variable _released;
+        bool _hold = false;
+        std::vector<HostWrite> _writes;
+};
+
+inline size_t File::write(const uint8_t *data, size_t len)
+{
+    if (!_f) return 0;
+    _fs->waitAndLog(ftell(_f.get()), len);
+    return fwrite(data, 1, len, _f.get());
+}
+
+}   // namespace fs
+
+using fs::FS;
+using fs::File;
@@ -0,0 +1,23 @@
+/**
+ * Header       SpiArbiter.h
+ *
+ * Purpose      SpiLease without a bus for the unit tests on the host, the
+ *              card of the tests is a directory.
+ */
+#pragma once
+#include <cstdint>
+
+enum class SpiClient : uint8_t { Touch, Sd, Other };
+
+class SpiArbiter
+{};
+
+class SpiLease
+{
+    public:
+        SpiLease(SpiArbiter *bus, SpiClient client)
+        {}
+
+        SpiLease(const SpiLease &) = delete;
+        SpiLease &operator=(const SpiLease &) = delete;
+};
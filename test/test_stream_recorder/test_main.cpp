@@ -0,0 +1,233 @@
+/**
+ * Purpose      Unit tests of StreamRecorder on the host (pio test -e native).
+ *              The card is the directory RECORDER_MOUNT, the stream a
+ *              sequence of MP3 frames whose payload never contains 0xFF,
+ *              so a frame header is found only where a frame starts.
+ *              The test is the audio path, the writer runs on its own
+ *              thread as on the target.
+ */
+#include <Arduino.h>
+#include <unity.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <vector>
+#include "StreamRecorder.h"
+
+const int FRAME_SIZE = 417;                 // 128 kbit/s, 44.1 kHz
+const int FRAMES     = 400;
+const int CHUNK      = 1024;                // bytes per write of the audio path
+const uint32_t RING  = RECORDER_BLOCKS * RECORDER_BLOCK_SIZE;
+
+class NullStream : public AudioStream
+{
+    public:
+        size_t write(const uint8_t *data, size_t len) override { return len; }
+};
+
+NullStream decoder;
+fs::FS sd(RECORDER_MOUNT);
+StreamRecorder recorder(decoder, sd);
+std::vector<uint8_t> stream;
+
+
+void makeStream()
+{
+    stream.resize(FRAME_SIZE * FRAMES);
+    for (size_t i = 0; i < stream.size(); i++)
+    {
+        int k = i % FRAME_SIZE;
+        const uint8_t header[] = {0xFF, 0xFB, 0x90, 0x64};
+        stream[i] = k < 4 ? header[k] : (i * 7) & 0x7F;
+    }
+}
+
+// Write a part of the stream in chunks like the copier of the audio path
+void feed(size_t from, size_t to)
+{
+    for (size_t i = from; i < to; i += CHUNK)
+    {
+        size_t n = min((size_t)CHUNK, to - i);
+        TEST_ASSERT_EQUAL(n, recorder.write(stream.data() + i, n));
+    }
+}
+
+template <typename Done>
+bool waitFor(Done done, uint32_t ms=5000)
+{
+    uint32_t t0 = millis();
+    while (!done())
+    {
+        if (millis() - t0 > ms) return false;
+        delay(1);
+    }
+    return true;
+}
+
+// Path on the card of the only recording
+std::string recording()
+{
+    std::string path;
+    DIR *dir = opendir(sd.hostPath(RECORDER_DIR).c_str());
+    if (dir == nullptr) return path;
+    while (dirent *e = readdir(dir))
+    {
+        if (e->d_name[0] != '.') path = std::string(RECORDER_DIR) + "/" + e->d_name;
+    }
+    closedir(dir);
+    return path;
+}
+
+long fileSize(const std::string &path)
+{
+    struct stat st;
+    return stat(sd.hostPath(path.c_str()).c_str(), &st) == 0 ? st.st_size : -1;
+}
+
+std::vector<uint8_t> fileData(const std::string &path)
+{
+    std::vector<uint8_t> data(max(fileSize(path), 0L));
+    FILE *f = fopen(sd.hostPath(path.c_str()).c_str(), "rb");
+    if (f == nullptr) return data;
+    data.resize(fread(data.data(), 1, data.size(), f));
+    fclose(f);
+    return data;
+}
+
+// Stop and wait until the writer has closed the file
+std::string stopRecording()
+{
+    recorder.stop();
+    std::string path = recording();
+    TEST_ASSERT_TRUE(waitFor([&]() { return !recorder.isWriting(path.c_str()); }));
+    return path;
+}
+
+// The data writes, without the bytes that extend the file
+std::vector<fs::HostWrite> dataWrites()
+{
+    std::vector<fs::HostWrite> writes;
+    for (const fs::HostWrite &w : sd.writes())
+    {
+        if (w.len > 1) writes.push_back(w);
+    }
+    return writes;
+}
+
+
+void setUp()
+{
+    mkdir(RECORDER_MOUNT, 0755);
+    std::string path;
+    while (!(path = recording()).empty()) sd.remove(path.c_str());
+    sd.clearWrites();
+    sd.hold(false);
+    recorder.resetStats();
+}
+
+void tearDown()
+{
+    sd.hold(false);
+    if (recorder.isRecording()) stopRecording();
+}
+
+
+// Whole blocks are written in slices at multiples of the block size
+void test_blocks_are_aligned()
+{
+    TEST_ASSERT_TRUE(recorder.start("Aligned"));
+    feed(0, 2 * RECORDER_BLOCK_SIZE);
+    TEST_ASSERT_TRUE(waitFor([]() { return recorder.bytesRecorded() >= RECORDER_BLOCK_SIZE; }));
+    feed(2 * RECORDER_BLOCK_SIZE, 3 * RECORDER_BLOCK_SIZE);
+    TEST_ASSERT_TRUE(waitFor([]() { return recorder.bytesRecorded() == 3 * RECORDER_BLOCK_SIZE; }));
+
+    std::vector<fs::HostWrite> writes = dataWrites();
+    TEST_ASSERT_EQUAL_UINT32(0, recorder.dropped());
+    TEST_ASSERT_EQUAL(3 * RECORDER_BLOCK_SIZE / RECORDER_SLICE, writes.size());
+    for (size_t i = 0; i < writes.size(); i++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(i * RECORDER_SLICE, writes[i].offset);
+        TEST_ASSERT_EQUAL(RECORDER_SLICE, writes[i].len);
+    }
+    stopRecording();
+}
+
+// The file is extended ahead of the data and cut to its length at the end
+void test_file_is_preallocated_and_truncated()
+{
+    TEST_ASSERT_TRUE(recorder.start("Preallocated"));
+    feed(0, 2 * RECORDER_BLOCK_SIZE);
+    TEST_ASSERT_TRUE(waitFor([]() { return recorder.bytesRecorded() == 2 * RECORDER_BLOCK_SIZE; }));
+    std::string path = recording();
+    TEST_ASSERT_EQUAL(RECORDER_PREALLOC, fileSize(path));
+
+    std::vector<fs::HostWrite> writes = sd.writes();
+    TEST_ASSERT_EQUAL_UINT32(RECORDER_PREALLOC - 1, writes[0].offset);
+    TEST_ASSERT_EQUAL(1, writes[0].len);
+
+    stopRecording();
+    TEST_ASSERT_EQUAL(2 * RECORDER_BLOCK_SIZE, fileSize(path));
+    std::vector<uint8_t> data = fileData(path);
+    TEST_ASSERT_EQUAL_MEMORY(stream.data(), data.data(), 2 * RECORDER_BLOCK_SIZE);
+}
+
+// A write that does not fit into the full ring is dropped, the file goes on at the next frame
+void test_full_ring_drops_and_resyncs()
+{
+    sd.hold(true);
+    TEST_ASSERT_TRUE(recorder.start("Dropped"));
+    feed(0, RING);
+    feed(RING, RING + CHUNK);
+    TEST_ASSERT_EQUAL_UINT32(CHUNK, recorder.dropped());
+
+    // no frame header while out of sync: ignored, not dropped
+    size_t frame = (RING + CHUNK) / FRAME_SIZE + 1;
+    TEST_ASSERT_EQUAL(100, recorder.write(stream.data() + frame * FRAME_SIZE + 10, 100));
+    TEST_ASSERT_EQUAL_UINT32(CHUNK, recorder.dropped());
+
+    sd.hold(false);
+    TEST_ASSERT_TRUE(waitFor([]() { return recorder.bytesRecorded() == RING; }));
+
+    // from the middle of the next frame, the recording resumes at the header after it
+    size_t from = (frame + 1) * FRAME_SIZE + 100;
+    size_t to = from + 4 * CHUNK;
+    feed(from, to);
+    size_t resync = (frame + 2) * FRAME_SIZE;
+
+    std::string path = stopRecording();
+    std::vector<uint8_t> data = fileData(path);
+    TEST_ASSERT_EQUAL(RING + to - resync, data.size());
+    TEST_ASSERT_EQUAL_MEMORY(stream.data(), data.data(), RING);
+    TEST_ASSERT_EQUAL_MEMORY(stream.data() + resync, data.data() + RING, to - resync);
+    TEST_ASSERT_EQUAL_UINT32(CHUNK, recorder.dropped());
+}
+
+// stop() writes the rest of less than a block
+void test_stop_flushes_the_rest()
+{
+    size_t len = RECORDER_BLOCK_SIZE + 5000;
+    TEST_ASSERT_TRUE(recorder.start("Flushed"));
+    feed(0, len);
+    TEST_ASSERT_TRUE(waitFor([]() { return recorder.bytesRecorded() == RECORDER_BLOCK_SIZE; }));
+
+    std::string path = stopRecording();
+    TEST_ASSERT_EQUAL(len, recorder.bytesRecorded());
+    std::vector<fs::HostWrite> writes = dataWrites();
+    TEST_ASSERT_EQUAL_UINT32(RECORDER_BLOCK_SIZE + RECORDER_SLICE, writes.back().offset);
+    TEST_ASSERT_EQUAL(len - RECORDER_BLOCK_SIZE - RECORDER_SLICE, writes.back().len);
+    std::vector<uint8_t> data = fileData(path);
+    TEST_ASSERT_EQUAL(len, data.size());
+    TEST_ASSERT_EQUAL_MEMORY(stream.data(), data.data(), len);
+}
+
+
+int main(int argc, char **argv)
+{
+    makeStream();
+    recorder.startWriter();
+    UNITY_BEGIN();
+    RUN_TEST(test_blocks_are_aligned);
+    RUN_TEST(test_file_is_preallocated_and_truncated);
+    RUN_TEST(test_full_ring_drops_and_resyncs);
+    RUN_TEST(test_stop_flushes_the_rest);
+    return UNITY_END();
+}
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+apibench.py     Measures the latency of the web API of the radio with
+                concurrent clients. Each client opens its own connections
+                and sends a mix of status requests and volume commands.
+                The volume is set to the value it had before, so the
+                radio plays on unchanged.
+
+Usage:          python tools/apibench.py cyd-radio.local
+                python tools/apibench.py 192.168.1.40 --clients 8 --requests 100 --commands 0.2
+
+                --clients   number of concurrent clients, default 4
+                --requests  requests per client, default 50
+                --commands  share of POST /api/volume, default 0.1
+
+                Prints count, errors and the latency percentiles per
+                endpoint. The device logs handler time and queue latency
+                with the render statistics once a minute.
+"""
+
+import argparse
+import http.client
+import json
+import random
+import statistics
+import threading
+import time
+
+
+def request(host, method, path, timeout):
+    conn = http.client.HTTPConnection(host, 80, timeout=timeout)
+    t0 = time.perf_counter()
+    try:
+        conn.request(method, path)
+        response = conn.getresponse()
+        body = response.read()
+        return response.status, time.perf_counter() - t0, body
+    except OSError:
+        return None, time.perf_counter() - t0, b''
+    finally:
+        conn.close()
+
+
+def client(args, volume, results, lock):
+    for _ in range(args.requests):
+        if random.random() < args.commands:
+            name, status, dt, _ = ('POST /api/volume',) + request(args.host, 'POST', f'/api/volume?value={volume:.3f}', args.timeout)
+            ok = status == 202
+        else:
+            name, status, dt, _ = ('GET /api/status',) + request(args.host, 'GET', '/api/status', args.timeout)
+            ok = status == 200
+        with lock:
+            results.setdefault(name, []).append((ok, status, dt))
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(p / 100 * len(values)))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Latency of the web API with concurrent clients')
+    parser.add_argument('host')
+    parser.add_argument('--clients', type=int, default=4)
+    parser.add_argument('--requests', type=int, default=50)
+    parser.add_argument('--commands', type=float, default=0.1)
+    parser.add_argument('--timeout', type=float, default=5.0)
+    args = parser.parse_args()
+
+    status, _, body = request(args.host, 'GET', '/api/status', args.timeout)
+    if status != 200:
+        raise SystemExit(f'{args.host}: /api/status not available ({status})')
+    volume = json.loads(body)['volume']
+    print(f'{args.host}: station {json.loads(body)["name"]}, volume {volume}')
+
+    results = {}
+    lock = threading.Lock()
+    threads = [threading.Thread(target=client, args=(args, volume, results, lock)) for _ in range(args.clients)]
+    t0 = time.perf_counter()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    elapsed = time.perf_counter() - t0
+
+    total = sum(len(r) for r in results.values())
+    print(f'{args.clients} clients, {total} requests in {elapsed:.1f} s, {total / elapsed:.1f} requests/s')
+    print(f'{"endpoint":20} {"count":>6} {"errors":>6} {"p50 ms":>8} {"p95 ms":>8} {"max ms":>8}')
+    for name, r in sorted(results.items()):
+        ms = [dt * 1000 for ok, status, dt in r if ok]
+        errors = len(r) - len(ms)
+        if ms:
+            print(f'{name:20} {len(r):6} {errors:6} {statistics.median(ms):8.1f} {percentile(ms, 95):8.1f} {max(ms):8.1f}')
+        else:
+            print(f'{name:20} {len(r):6} {errors:6}')
+        codes = sorted({status for ok, status, dt in r if not ok}, key=str)
+        if codes:
+            print(f'{"":20} failed with {codes}')
+
+
+if __name__ == '__main__':
+    main()
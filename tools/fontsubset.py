@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""
+fontsubset.py   Generates a compressed, subsetted font header for UiText
+                (UiRleFont) and replaces the hand-run fontconvert step.
+
+                The glyphs are taken either from a ttf font (needs the
+                freetype-py package) or from an existing Adafruit GFX
+                font header as produced by fontconvert. Only the
+                characters of the subset are written. Each glyph is
+                stored run-length encoded or as plain bits, whichever
+                is smaller.
+
+Usage:          python tools/fontsubset.py --gfx include/Calibri12pt8b.h --name Calibri12ptRle > include/Calibri12ptRle.h
+                python tools/fontsubset.py --ttf calibri.ttf --size 12 --name Calibri12ptRle > include/Calibri12ptRle.h
+                python tools/fontsubset.py --gfx include/Calibri8pt8b.h --name Calibri8ptRle --chars 32-126 --text titles.txt
+
+                --chars  Latin-1 code ranges, default 32-126,160-255
+                --text   file (UTF-8) whose characters are added to the subset
+
+                The size of the GFX font and of the generated font are
+                printed to stderr.
+"""
+
+import argparse
+import re
+import sys
+
+RLE = 0x01
+
+
+class Glyph:
+    def __init__(self, code, w, h, x_advance, x_offset, y_offset, pixels):
+        self.code = code
+        self.w = w
+        self.h = h
+        self.x_advance = x_advance
+        self.x_offset = x_offset
+        self.y_offset = y_offset
+        self.pixels = pixels  # list of 0/1, row-major, w*h
+
+
+def parse_gfx(path):
+    """Read the bitmaps and glyph table of a GFX font header."""
+    src = open(path, encoding="latin-1").read()
+    bitmaps = re.search(r"Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", src, re.S).group(1)
+    data = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", bitmaps)]
+    table = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\}\s*;", src, re.S).group(1)
+    rows = re.findall(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", table)
+    tail = re.search(r"\(GFXglyph\s*\*\)\w+,\s*(0x[0-9A-Fa-f]+|\d+),\s*(0x[0-9A-Fa-f]+|\d+),\s*(\d+)", src)
+    first, last, y_advance = int(tail.group(1), 0), int(tail.group(2), 0), int(tail.group(3))
+
+    glyphs = {}
+    for i, row in enumerate(rows):
+        offset, w, h, xa, xo, yo = map(int, row)
+        bits = []
+        for n in range(w * h):
+            byte = data[offset + n // 8]
+            bits.append((byte >> (7 - n % 8)) & 1)
+        glyphs[first + i] = Glyph(first + i, w, h, xa, xo, yo, bits)
+    gfx_size = len(data) + 7 * len(rows) + 12
+    return glyphs, y_advance, gfx_size
+
+
+def render_ttf(path, size, codes):
+    """Render the glyphs of a ttf font with freetype at 141 dpi like fontconvert."""
+    import freetype
+    face = freetype.Face(path)
+    face.set_char_size(size << 6, 0, 141, 0)
+    glyphs = {}
+    for code in codes:
+        face.load_char(bytes([code]).decode("latin-1"), freetype.FT_LOAD_TARGET_MONO | freetype.FT_LOAD_RENDER)
+        g = face.glyph
+        bm = g.bitmap
+        bits = []
+        for y in range(bm.rows):
+            for x in range(bm.width):
+                bits.append((bm.buffer[y * bm.pitch + x // 8] >> (7 - x % 8)) & 1)
+        glyphs[code] = Glyph(code, bm.width, bm.rows, g.advance.x >> 6, g.bitmap_left, 1 - g.bitmap_top, bits)
+    y_advance = face.size.height >> 6
+    return glyphs, y_advance, None
+
+
+def parse_chars(spec):
+    codes = set()
+    for part in spec.split(","):
+        lo, _, hi = part.partition("-")
+        codes.update(range(int(lo, 0), int(hi or lo, 0) + 1))
+    return codes
+
+
+def encode_rle(bits):
+    """Alternating runs starting with background, one nibble per run.
+       A nibble of 15 continues the run with the same color."""
+    nibbles = []
+    color, i = 0, 0
+    while i < len(bits):
+        run = 0
+        while i < len(bits) and bits[i] == color:
+            run += 1
+            i += 1
+        while run >= 15:
+            nibbles.append(15)
+            run -= 15
+        nibbles.append(run)
+        color ^= 1
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [(nibbles[n] << 4) | nibbles[n + 1] for n in range(0, len(nibbles), 2)]
+
+
+def encode_bits(bits):
+    out = []
+    for n in range(0, len(bits), 8):
+        byte = 0
+        for k, b in enumerate(bits[n:n + 8]):
+            byte |= b << (7 - k)
+        out.append(byte)
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Generate a compressed UiRleFont header")
+    src = ap.add_mutually_exclusive_group(required=True)
+    src.add_argument("--gfx", help="GFX font header produced by fontconvert")
+    src.add_argument("--ttf", help="ttf font file")
+    ap.add_argument("--size", type=int, default=12, help="point size for --ttf")
+    ap.add_argument("--name", required=True, help="name of the generated font")
+    ap.add_argument("--chars", default="32-126,160-255", help="Latin-1 code ranges")
+    ap.add_argument("--text", help="UTF-8 text file whose characters are added")
+    args = ap.parse_args()
+
+    codes = parse_chars(args.chars)
+    if args.text:
+        codes.update(ord(c) for c in open(args.text, encoding="utf-8").read() if 32 <= ord(c) <= 255)
+    codes.add(ord("?"))  # replacement for characters missing in the subset
+
+    if args.gfx:
+        glyphs, y_advance, gfx_size = parse_gfx(args.gfx)
+    else:
+        glyphs, y_advance, gfx_size = render_ttf(args.ttf, args.size, sorted(codes))
+    codes = sorted(c for c in codes if c in glyphs)
+
+    ascent = max(-glyphs[c].y_offset for c in codes if glyphs[c].h)
+    descent = max(glyphs[c].y_offset + glyphs[c].h for c in codes if glyphs[c].h)
+    max_advance = max(glyphs[c].x_advance for c in codes)
+    first, last = codes[0], codes[-1]
+
+    data, table, n_rle = [], [], 0
+    for c in codes:
+        g = glyphs[c]
+        rle, raw = encode_rle(g.pixels), encode_bits(g.pixels)
+        flags = RLE if len(rle) < len(raw) else 0
+        n_rle += flags
+        table.append((len(data), g, flags))
+        data.extend(rle if flags else raw)
+    index = [0xFF] * (last - first + 1)
+    for i, c in enumerate(codes):
+        index[c - first] = i
+
+    size = len(data) + 8 * len(table) + len(index) + 20
+    out = sys.stdout
+    out.write("// Generated by tools/fontsubset.py from %s\n" % (args.gfx or args.ttf))
+    out.write("// %d glyphs, %d run-length encoded\n\n" % (len(codes), n_rle))
+    out.write("#pragma once\n#include \"UiText.h\"\n\n")
+    out.write("const uint8_t %sData[] PROGMEM = {\n" % args.name)
+    for n in range(0, len(data), 12):
+        out.write("  " + ", ".join("0x%02X" % b for b in data[n:n + 12]) + ",\n")
+    out.write("};\n\n")
+    out.write("const UiRleGlyph %sGlyphs[] PROGMEM = {\n" % args.name)
+    for offset, g, flags in table:
+        ch = chr(g.code) if 32 < g.code < 127 and g.code != 0x5C else ""
+        out.write("  { %5d, %3d, %3d, %3d, %4d, %4d, %d },   // 0x%02X %s\n"
+                  % (offset, g.w, g.h, g.x_advance, g.x_offset, g.y_offset, flags, g.code, ch))
+    out.write("};\n\n")
+    out.write("const uint8_t %sIndex[] PROGMEM = {\n" % args.name)
+    for n in range(0, len(index), 16):
+        out.write("  " + ", ".join("%3d" % b for b in index[n:n + 16]) + ",\n")
+    out.write("};\n\n")
+    out.write("const UiRleFont %s PROGMEM = {\n" % args.name)
+    out.write("  %sData, %sGlyphs, %sIndex,\n" % (args.name, args.name, args.name))
+    out.write("  0x%02X, 0x%02X, %d, %d, %d, %d };\n\n" % (first, last, ascent, descent, y_advance, max_advance))
+    out.write("// Approx. %d bytes\n" % size)
+
+    if gfx_size:
+        print("%s: GFX font %d bytes, subset font %d bytes (%d%%), %d glyphs, %d RLE"
+              % (args.name, gfx_size, size, 100 * size // gfx_size, len(codes), n_rle), file=sys.stderr)
+    else:
+        print("%s: subset font %d bytes, %d glyphs, %d RLE" % (args.name, size, len(codes), n_rle), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""
+podcastserver.py  A local stand-in for a podcast host, to test the
+                  episode playback of the radio without the internet.
+                  It serves an RSS feed of the MP3 files of a directory
+                  and the files themselves with Range requests, and can
+                  misbehave on purpose.
+
+Usage:          python tools/podcastserver.py --dir ~/Music/podcast
+                python tools/podcastserver.py --dir . --drop 300000 --redirect --rate 40
+
+                --port      port, default 8000
+                --dir       directory with the .mp3 files, newest first in the feed
+                --drop      close every file download after this many bytes,
+                            the radio has to resume with a Range request
+                --redirect  the enclosures point to /r/<file>, which redirects
+                            with 302 to /media/<file>, like the CDNs do
+                --rate      KB/s per download, default unlimited
+                --no-range  ignore Range and always send the whole file
+
+                Build the radio with
+                -D PODCAST_TEST_FEED=\\"http://<this pc>:8000/feed.xml\\"
+                and select the test feed with POST /api/podcast?id=<n>.
+                Every request is printed with its range and the bytes sent.
+"""
+
+import argparse
+import html
+import os
+import re
+import time
+import urllib.parse
+from email.utils import formatdate
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+
+def episodes(directory):
+    files = [f for f in os.listdir(directory) if f.lower().endswith('.mp3')]
+    return sorted(files, key=lambda f: os.path.getmtime(os.path.join(directory, f)), reverse=True)
+
+
+def feed(args, host):
+    items = []
+    for name in episodes(args.dir):
+        path = os.path.join(args.dir, name)
+        prefix = '/r/' if args.redirect else '/media/'
+        url = f'http://{host}{prefix}{urllib.parse.quote(name)}'
+        title = os.path.splitext(name)[0].replace('_', ' ')
+        items.append(f'''  <item>
+    <title>{html.escape(title)}</title>
+    <description><![CDATA[<p>Local file {name}</p>]]></description>
+    <pubDate>{formatdate(os.path.getmtime(path), usegmt=True)}</pubDate>
+    <enclosure url="{html.escape(url)}" length="{os.path.getsize(path)}" type="audio/mpeg"/>
+  </item>''')
+    return f'''<?xml version="1.0" encoding="UTF-8"?>
+<!-- generated by podcastserver.py -->
+<rss version="2.0" xmlns:itunes="http://www.itunes.com/dtds/podcast-1.0.dtd">
+<channel>
+  <title>Local test feed &amp; files</title>
+  <link>http://{host}/</link>
+{chr(10).join(items)}
+</channel>
+</rss>
+'''.encode()
+
+
+class Handler(BaseHTTPRequestHandler):
+    args = None
+
+    def do_GET(self):
+        path = urllib.parse.unquote(urllib.parse.urlparse(self.path).path)
+        if path == '/feed.xml':
+            body = feed(self.args, self.headers.get('Host', 'localhost'))
+            self.answer(200, 'application/rss+xml', body)
+        elif path.startswith('/r/'):
+            self.send_response(302)
+            self.send_header('Location', '/media/' + urllib.parse.quote(path[3:]))
+            self.send_header('Content-Length', '0')
+            self.end_headers()
+        elif path.startswith('/media/'):
+            self.media(os.path.basename(path[7:]))
+        else:
+            self.answer(404, 'text/plain', b'not found\n')
+
+    def answer(self, code, mime, body):
+        self.send_response(code)
+        self.send_header('Content-Type', mime)
+        self.send_header('Content-Length', str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def media(self, name):
+        path = os.path.join(self.args.dir, name)
+        if not os.path.isfile(path):
+            self.answer(404, 'text/plain', b'not found\n')
+            return
+        size = os.path.getsize(path)
+        start, end = 0, size - 1
+        match = re.fullmatch(r'bytes=(\d*)-(\d*)', self.headers.get('Range', ''))
+        if match and not self.args.no_range:
+            if match[1]:
+                start = int(match[1])
+                end = int(match[2]) if match[2] else size - 1
+            elif match[2]:
+                start = max(0, size - int(match[2]))
+            if start >= size or start > end:
+                self.send_response(416)
+                self.send_header('Content-Range', f'bytes */{size}')
+                self.send_header('Content-Length', '0')
+                self.end_headers()
+                return
+            end = min(end, size - 1)
+            self.send_response(206)
+            self.send_header('Content-Range', f'bytes {start}-{end}/{size}')
+        else:
+            self.send_response(200)
+        self.send_header('Content-Type', 'audio/mpeg')
+        self.send_header('Content-Length', str(end - start + 1))
+        if not self.args.no_range:
+            self.send_header('Accept-Ranges', 'bytes')
+        self.end_headers()
+
+        sent = 0
+        t0 = time.perf_counter()
+        with open(path, 'rb') as f:
+            f.seek(start)
+            left = end - start + 1
+            try:
+                while left > 0:
+                    n = min(left, 4096)
+                    if self.args.drop:
+                        n = min(n, self.args.drop - sent)
+                        if n <= 0:
+                            print(f'  dropped after {sent} bytes')
+                            break
+                    self.wfile.write(f.read(n))
+                    sent += n
+                    left -= n
+                    if self.args.rate:
+                        time.sleep(max(0.0, sent / (self.args.rate * 1024) - (time.perf_counter() - t0)))
+            except (BrokenPipeError, ConnectionResetError):
+                print(f'  closed by the client after {sent} bytes')
+        self.close_connection = True
+
+    def log_message(self, format, *args):
+        print(f'{self.address_string()} {self.command} {self.path} '
+              f'range {self.headers.get("Range", "-")} -> {args[1] if len(args) > 1 else ""}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='RSS feed and MP3 files with Range requests for the radio')
+    parser.add_argument('--port', type=int, default=8000)
+    parser.add_argument('--dir', default='.')
+    parser.add_argument('--drop', type=int, default=0)
+    parser.add_argument('--redirect', action='store_true')
+    parser.add_argument('--rate', type=float, default=0)
+    parser.add_argument('--no-range', action='store_true')
+    args = parser.parse_args()
+
+    Handler.args = args
+    files = episodes(args.dir)
+    print(f'{len(files)} episodes in {args.dir}, feed at http://<this pc>:{args.port}/feed.xml')
+    ThreadingHTTPServer(('', args.port), Handler).serve_forever()
+
+
+if __name__ == '__main__':
+    main()
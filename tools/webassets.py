@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+webassets.py    Compiles the pages in web/ into flash arrays for the
+                WebAssets library and replaces the hand-written raw string
+                literals of the pages.
+
+                Every file becomes a WebAsset with its URL, MIME type and
+                a strong ETag (hash of the stored bytes). Static files are
+                stored gzip-compressed and served as they are with
+                Content-Encoding: gzip. Templates (name.tmpl.ext) are
+                stored as plain text, their {{key}} fields are filled in
+                while the page is streamed.
+
+                URLs: web/index.html -> /, web/mirror.html -> /mirror,
+                web/query.tmpl.html -> /query, web/app.js -> /app.js
+
+Usage:          python tools/webassets.py
+                python tools/webassets.py --src web --out lib/WebAssets/WebAssetsData.cpp
+
+                Also runs as a PlatformIO pre-build script
+                (extra_scripts = pre:tools/webassets.py). The output is
+                only rewritten when it changes, so an unchanged web/
+                does not trigger a rebuild. Sizes are printed to stderr.
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import sys
+
+MIME = {
+    '.html': 'text/html',
+    '.css':  'text/css',
+    '.js':   'application/javascript',
+    '.json': 'application/json',
+    '.svg':  'image/svg+xml',
+    '.png':  'image/png',
+    '.ico':  'image/x-icon',
+}
+
+
+def url_of(name):
+    base, ext = os.path.splitext(name.replace('.tmpl', ''))
+    if ext == '.html':
+        return '/' if base == 'index' else '/' + base
+    return '/' + base + ext
+
+
+def symbol_of(name):
+    return 'asset_' + ''.join(c if c.isalnum() else '_' for c in name)
+
+
+def c_array(symbol, data):
+    lines = [f'static const uint8_t {symbol}[] PROGMEM =', '{']
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join(f'0x{b:02x}' for b in data[i:i + 16]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def generate(src, out):
+    assets = []
+    for name in sorted(os.listdir(src)):
+        path = os.path.join(src, name)
+        ext = os.path.splitext(name)[1]
+        if not os.path.isfile(path) or ext not in MIME:
+            continue
+        with open(path, 'rb') as f:
+            raw = f.read()
+        template = '.tmpl.' in name
+        data = raw if template else gzip.compress(raw, 9, mtime=0)
+        etag = '"' + hashlib.sha1(data).hexdigest()[:16] + '"'
+        assets.append((name, url_of(name), MIME[ext], data, etag, template))
+        print(f'{name:24} {url_of(name):16} {len(raw):7} -> {len(data):7} bytes'
+              f'{" (template)" if template else ""}', file=sys.stderr)
+
+    parts = [
+        '// Generated by tools/webassets.py from ' + os.path.basename(os.path.normpath(src)) + '/, do not edit',
+        '#include "WebAssets.h"',
+        '',
+    ]
+    for name, url, mime, data, etag, template in assets:
+        parts.append(c_array(symbol_of(name), data))
+        parts.append('')
+    parts.append('const WebAsset webAssets[] =')
+    parts.append('{')
+    for name, url, mime, data, etag, template in assets:
+        etag_c = etag.replace('"', '\\"')
+        parts.append(f'    {{ "{url}", "{mime}", {symbol_of(name)}, {len(data)}, "{etag_c}", '
+                     f'{"false" if template else "true"} }},')
+    parts.append('};')
+    parts.append('const int nbrWebAssets = sizeof(webAssets) / sizeof(webAssets[0]);')
+    text = '\n'.join(parts) + '\n'
+
+    old = None
+    if os.path.exists(out):
+        with open(out) as f:
+            old = f.read()
+    if text != old:
+        with open(out, 'w') as f:
+            f.write(text)
+        print(f'{out} written, {sum(len(a[3]) for a in assets)} bytes of flash', file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compile web/ into flash arrays')
+    parser.add_argument('--src', default='web')
+    parser.add_argument('--out', default='lib/WebAssets/WebAssetsData.cpp')
+    args = parser.parse_args()
+    generate(args.src, args.out)
+
+
+try:
+    Import('env')       # noqa: F821, defined when PlatformIO runs the script
+except NameError:
+    env = None
+
+if env is not None:
+    project = env['PROJECT_DIR']
+    generate(os.path.join(project, 'web'), os.path.join(project, 'lib', 'WebAssets', 'WebAssetsData.cpp'))
+elif __name__ == '__main__':
+    main()